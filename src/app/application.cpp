@@ -36,9 +36,7 @@
 #endif
 
 #ifdef Q_OS_WIN
-#include <memory>
 #include <windows.h>
-#include <shellapi.h>
 #elif defined(Q_OS_UNIX)
 #include <sys/resource.h>
 #endif
@@ -47,7 +45,6 @@
 #include <QDebug>
 #include <QLibraryInfo>
 #include <QMetaObject>
-#include <QProcess>
 
 #ifndef DISABLE_GUI
 #include <QAbstractButton>
@@ -68,8 +65,10 @@
 #include "base/bittorrent/session.h"
 #include "base/bittorrent/torrent.h"
 #include "base/exceptions.h"
+#include "base/externalprogramrunner.h"
 #include "base/global.h"
 #include "base/logger.h"
+#include "base/memoryusagetracker.h"
 #include "base/net/downloadmanager.h"
 #include "base/net/geoipmanager.h"
 #include "base/net/proxyconfigurationmanager.h"
@@ -88,6 +87,7 @@
 #include "base/version.h"
 #include "applicationinstancemanager.h"
 #include "filelogger.h"
+#include "notificationmailer.h"
 #include "upgrade.h"
 
 #ifndef DISABLE_GUI
@@ -258,6 +258,8 @@ Application::Application(int &argc, char **argv)
     , m_storeFileLoggerAge(FILELOGGER_SETTINGS_KEY(u"Age"_s))
     , m_storeFileLoggerAgeType(FILELOGGER_SETTINGS_KEY(u"AgeType"_s))
     , m_storeFileLoggerPath(FILELOGGER_SETTINGS_KEY(u"Path"_s))
+    , m_storeFileLoggerFormat(FILELOGGER_SETTINGS_KEY(u"Format"_s))
+    , m_storeFileLoggerCompressBackups(FILELOGGER_SETTINGS_KEY(u"CompressBackups"_s))
     , m_storeMemoryWorkingSetLimit(SETTINGS_KEY(u"MemoryWorkingSetLimit"_s))
 #ifdef Q_OS_WIN
     , m_processMemoryPriority(SETTINGS_KEY(u"ProcessMemoryPriority"_s))
@@ -279,6 +281,7 @@ Application::Application(int &argc, char **argv)
     QPixmapCache::setCacheLimit(PIXMAP_CACHE_SIZE);
 #endif
 
+    MemoryUsageTracker::initInstance();
     Logger::initInstance();
 
     const auto portableProfilePath = Path(QCoreApplication::applicationDirPath()) / DEFAULT_PORTABLE_MODE_PROFILE_DIR;
@@ -307,6 +310,8 @@ Application::Application(int &argc, char **argv)
 
     initializeTranslation();
 
+    m_notificationMailer = new NotificationMailer(this);
+
     connect(this, &QCoreApplication::aboutToQuit, this, &Application::cleanup);
     connect(m_instanceManager, &ApplicationInstanceManager::messageReceived, this, &Application::processMessage);
 #if defined(Q_OS_WIN) && !defined(DISABLE_GUI)
@@ -327,7 +332,8 @@ Application::Application(int &argc, char **argv)
     }
 
     if (isFileLoggerEnabled())
-        m_fileLogger = new FileLogger(fileLoggerPath(), isFileLoggerBackup(), fileLoggerMaxSize(), isFileLoggerDeleteOld(), fileLoggerAge(), static_cast<FileLogger::FileLogAgeType>(fileLoggerAgeType()));
+        m_fileLogger = new FileLogger(fileLoggerPath(), isFileLoggerBackup(), fileLoggerMaxSize(), isFileLoggerDeleteOld(), fileLoggerAge(), static_cast<FileLogger::FileLogAgeType>(fileLoggerAgeType())
+            , static_cast<FileLogger::FileLogFormat>(fileLoggerFormat()), isFileLoggerCompressBackups());
 
     if (m_commandLineArgs.webUIPort > 0) // it will be -1 when user did not set any value
         Preferences::instance()->setWebUIPort(m_commandLineArgs.webUIPort);
@@ -424,7 +430,8 @@ bool Application::isFileLoggerEnabled() const
 void Application::setFileLoggerEnabled(const bool value)
 {
     if (value && !m_fileLogger)
-        m_fileLogger = new FileLogger(fileLoggerPath(), isFileLoggerBackup(), fileLoggerMaxSize(), isFileLoggerDeleteOld(), fileLoggerAge(), static_cast<FileLogger::FileLogAgeType>(fileLoggerAgeType()));
+        m_fileLogger = new FileLogger(fileLoggerPath(), isFileLoggerBackup(), fileLoggerMaxSize(), isFileLoggerDeleteOld(), fileLoggerAge(), static_cast<FileLogger::FileLogAgeType>(fileLoggerAgeType())
+            , static_cast<FileLogger::FileLogFormat>(fileLoggerFormat()), isFileLoggerCompressBackups());
     else if (!value)
         delete m_fileLogger;
     m_storeFileLoggerEnabled = value;
@@ -502,6 +509,32 @@ void Application::setFileLoggerAgeType(const int value)
     m_storeFileLoggerAgeType = ((value < 0) || (value > 2)) ? 1 : value;
 }
 
+int Application::fileLoggerFormat() const
+{
+    const int val = m_storeFileLoggerFormat.get(FileLogger::TEXT);
+    return ((val < FileLogger::TEXT) || (val > FileLogger::JSON)) ? FileLogger::TEXT : val;
+}
+
+void Application::setFileLoggerFormat(const int value)
+{
+    const int format = ((value < FileLogger::TEXT) || (value > FileLogger::JSON)) ? FileLogger::TEXT : value;
+    if (m_fileLogger)
+        m_fileLogger->setFormat(static_cast<FileLogger::FileLogFormat>(format));
+    m_storeFileLoggerFormat = format;
+}
+
+bool Application::isFileLoggerCompressBackups() const
+{
+    return m_storeFileLoggerCompressBackups.get(false);
+}
+
+void Application::setFileLoggerCompressBackups(const bool value)
+{
+    if (m_fileLogger)
+        m_fileLogger->setCompressBackups(value);
+    m_storeFileLoggerCompressBackups = value;
+}
+
 void Application::processMessage(const QString &message)
 {
 #ifndef DISABLE_GUI
@@ -535,183 +568,6 @@ void Application::processMessage(const QString &message)
         m_paramsQueue.append(params);
 }
 
-void Application::runExternalProgram(const QString &programTemplate, const BitTorrent::Torrent *torrent) const
-{
-    // Cannot give users shell environment by default, as doing so could
-    // enable command injection via torrent name and other arguments
-    // (especially when some automated download mechanism has been setup).
-    // See: https://github.com/qbittorrent/qBittorrent/issues/10925
-
-    const auto replaceVariables = [torrent](QString str) -> QString
-    {
-        for (qsizetype i = (str.length() - 2); i >= 0; --i)
-        {
-            if (str[i] != u'%')
-                continue;
-
-            const ushort specifier = str[i + 1].unicode();
-            switch (specifier)
-            {
-            case u'C':
-                str.replace(i, 2, QString::number(torrent->filesCount()));
-                break;
-            case u'D':
-                str.replace(i, 2, torrent->savePath().toString());
-                break;
-            case u'F':
-                str.replace(i, 2, torrent->contentPath().toString());
-                break;
-            case u'G':
-                str.replace(i, 2, Utils::String::joinIntoString(torrent->tags(), u","_s));
-                break;
-            case u'I':
-                str.replace(i, 2, (torrent->infoHash().v1().isValid() ? torrent->infoHash().v1().toString() : u"-"_s));
-                break;
-            case u'J':
-                str.replace(i, 2, (torrent->infoHash().v2().isValid() ? torrent->infoHash().v2().toString() : u"-"_s));
-                break;
-            case u'K':
-                str.replace(i, 2, torrent->id().toString());
-                break;
-            case u'L':
-                str.replace(i, 2, torrent->category());
-                break;
-            case u'M':
-                str.replace(i, 2, torrent->comment());
-                break;
-            case u'N':
-                str.replace(i, 2, torrent->name());
-                break;
-            case u'R':
-                str.replace(i, 2, torrent->rootPath().toString());
-                break;
-            case u'T':
-                str.replace(i, 2, torrent->currentTracker());
-                break;
-            case u'Z':
-                str.replace(i, 2, QString::number(torrent->totalSize()));
-                break;
-            default:
-                // do nothing
-                break;
-            }
-
-            // decrement `i` to avoid unwanted replacement, example pattern: "%%N"
-            --i;
-        }
-
-        return str;
-    };
-
-    const QString logMsg = tr("Running external program. Torrent: \"%1\". Command: `%2`");
-    const QString logMsgError = tr("Failed to run external program. Torrent: \"%1\". Command: `%2`");
-
-    // The processing sequence is different for Windows and other OS, this is intentional
-#if defined(Q_OS_WIN)
-    const QString program = replaceVariables(programTemplate);
-    const std::wstring programWStr = program.toStdWString();
-
-    // Need to split arguments manually because QProcess::startDetached(QString)
-    // will strip off empty parameters.
-    // E.g. `python.exe "1" "" "3"` will become `python.exe "1" "3"`
-    int argCount = 0;
-    std::unique_ptr<LPWSTR[], decltype(&::LocalFree)> args {::CommandLineToArgvW(programWStr.c_str(), &argCount), ::LocalFree};
-
-    if (argCount <= 0)
-        return;
-
-    QStringList argList;
-    for (int i = 1; i < argCount; ++i)
-        argList += QString::fromWCharArray(args[i]);
-
-    QProcess proc;
-    proc.setProgram(QString::fromWCharArray(args[0]));
-    proc.setArguments(argList);
-    proc.setCreateProcessArgumentsModifier([](QProcess::CreateProcessArguments *args)
-    {
-        if (Preferences::instance()->isAutoRunConsoleEnabled())
-        {
-            args->flags |= CREATE_NEW_CONSOLE;
-            args->flags &= ~(CREATE_NO_WINDOW | DETACHED_PROCESS);
-        }
-        else
-        {
-            args->flags |= CREATE_NO_WINDOW;
-            args->flags &= ~(CREATE_NEW_CONSOLE | DETACHED_PROCESS);
-        }
-        args->inheritHandles = false;
-        args->startupInfo->dwFlags &= ~STARTF_USESTDHANDLES;
-        ::CloseHandle(args->startupInfo->hStdInput);
-        ::CloseHandle(args->startupInfo->hStdOutput);
-        ::CloseHandle(args->startupInfo->hStdError);
-        args->startupInfo->hStdInput = nullptr;
-        args->startupInfo->hStdOutput = nullptr;
-        args->startupInfo->hStdError = nullptr;
-    });
-
-    if (proc.startDetached())
-        LogMsg(logMsg.arg(torrent->name(), program));
-    else
-        LogMsg(logMsgError.arg(torrent->name(), program));
-#else // Q_OS_WIN
-    QStringList args = Utils::String::splitCommand(programTemplate);
-
-    if (args.isEmpty())
-        return;
-
-    for (QString &arg : args)
-    {
-        // strip redundant quotes
-        if (arg.startsWith(u'"') && arg.endsWith(u'"'))
-        {
-#if QT_VERSION >= QT_VERSION_CHECK(6, 8, 0)
-            arg.slice(1, (arg.size() - 2));
-#else
-            arg.removeLast().removeFirst();
-#endif
-        }
-
-        arg = replaceVariables(arg);
-    }
-
-    const QString command = args.takeFirst();
-    QProcess proc;
-    proc.setProgram(command);
-    proc.setArguments(args);
-    proc.setUnixProcessParameters(QProcess::UnixProcessFlag::CloseFileDescriptors);
-
-    if (proc.startDetached())
-    {
-        // show intended command in log
-        LogMsg(logMsg.arg(torrent->name(), replaceVariables(programTemplate)));
-    }
-    else
-    {
-        // show intended command in log
-        LogMsg(logMsgError.arg(torrent->name(), replaceVariables(programTemplate)));
-    }
-#endif
-}
-
-void Application::sendNotificationEmail(const BitTorrent::Torrent *torrent)
-{
-    // Prepare mail content
-    const QString content = tr("Torrent name: %1").arg(torrent->name()) + u'\n'
-        + tr("Torrent size: %1").arg(Utils::Misc::friendlyUnit(torrent->wantedSize())) + u'\n'
-        + tr("Save path: %1").arg(torrent->savePath().toString()) + u"\n\n"
-        + tr("The torrent was downloaded in %1.", "The torrent was downloaded in 1 hour and 20 seconds")
-            .arg(Utils::Misc::userFriendlyDuration(torrent->activeTime())) + u"\n\n\n"
-        + tr("Thank you for using qBittorrent.") + u'\n';
-
-    // Send the notification email
-    const Preferences *pref = Preferences::instance();
-    auto *smtp = new Net::Smtp(this);
-    smtp->sendMail(pref->getMailNotificationSender(),
-                     pref->getMailNotificationEmail(),
-                     tr("Torrent \"%1\" has finished downloading").arg(torrent->name()),
-                     content);
-}
-
 void Application::sendTestEmail() const
 {
     const Preferences *pref = Preferences::instance();
@@ -721,7 +577,7 @@ void Application::sendTestEmail() const
         const QString content = tr("This is a test email.") + u'\n'
             + tr("Thank you for using qBittorrent.") + u'\n';
 
-        // Send the notification email
+        // Test email is sent over its own connection so that it checks the current settings
         auto *smtp = new Net::Smtp();
         smtp->sendMail(pref->getMailNotificationSender(),
                         pref->getMailNotificationEmail(),
@@ -736,7 +592,7 @@ void Application::torrentAdded(const BitTorrent::Torrent *torrent) const
 
     // AutoRun program
     if (pref->isAutoRunOnTorrentAddedEnabled())
-        runExternalProgram(pref->getAutoRunOnTorrentAddedProgram().trimmed(), torrent);
+        m_externalProgramRunner->run(pref->getAutoRunOnTorrentAddedProgram().trimmed(), torrent);
 }
 
 void Application::torrentFinished(const BitTorrent::Torrent *torrent)
@@ -745,13 +601,13 @@ void Application::torrentFinished(const BitTorrent::Torrent *torrent)
 
     // AutoRun program
     if (pref->isAutoRunOnTorrentFinishedEnabled())
-        runExternalProgram(pref->getAutoRunOnTorrentFinishedProgram().trimmed(), torrent);
+        m_externalProgramRunner->run(pref->getAutoRunOnTorrentFinishedProgram().trimmed(), torrent);
 
     // Mail notification
     if (pref->isMailNotificationEnabled())
     {
         LogMsg(tr("Torrent: %1, sending mail notification").arg(torrent->name()));
-        sendNotificationEmail(torrent);
+        m_notificationMailer->notifyTorrentFinished(torrent);
     }
 
 #ifndef DISABLE_GUI
@@ -833,11 +689,21 @@ void Application::processParams(const QBtCommandLineParameters &params)
     AddTorrentOption addTorrentOption = AddTorrentOption::Default;
     if (params.skipDialog.has_value())
         addTorrentOption = params.skipDialog.value() ? AddTorrentOption::SkipDialog : AddTorrentOption::ShowDialog;
-    for (const QString &torrentSource : params.torrentSources)
-        m_addTorrentManager->addTorrent(torrentSource, params.addTorrentParams, addTorrentOption);
+    else if (!Preferences::instance()->isAddNewTorrentDialogEnabled())
+        addTorrentOption = AddTorrentOption::SkipDialog;
+
+    // Torrents which don't need the dialog are loaded in bulk
+    if (addTorrentOption == AddTorrentOption::SkipDialog)
+    {
+        m_addTorrentManager->addTorrents(params.torrentSources, params.addTorrentParams);
+    }
+    else
+    {
+        for (const QString &torrentSource : params.torrentSources)
+            m_addTorrentManager->addTorrent(torrentSource, params.addTorrentParams, addTorrentOption);
+    }
 #else
-    for (const QString &torrentSource : params.torrentSources)
-        m_addTorrentManager->addTorrent(torrentSource, params.addTorrentParams);
+    m_addTorrentManager->addTorrents(params.torrentSources, params.addTorrentParams);
 #endif
 }
 
@@ -903,6 +769,7 @@ int Application::exec()
         connect(BitTorrent::Session::instance(), &BitTorrent::Session::allTorrentsFinished, this, &Application::allTorrentsFinished, Qt::QueuedConnection);
 
         m_addTorrentManager = new AddTorrentManagerImpl(this, BitTorrent::Session::instance(), this);
+        m_externalProgramRunner = new ExternalProgramRunner(this);
 
         Net::GeoIPManager::initInstance();
         TorrentFilesWatcher::initInstance();
@@ -1393,6 +1260,9 @@ void Application::cleanup()
 
     TorrentFilesWatcher::freeInstance();
     delete m_addTorrentManager;
+    delete m_externalProgramRunner;
+    m_notificationMailer->flush();
+    delete m_notificationMailer;
     BitTorrent::Session::freeInstance();
     Net::GeoIPManager::freeInstance();
     Net::DownloadManager::freeInstance();
@@ -1405,6 +1275,7 @@ void Application::cleanup()
     LogMsg(tr("qBittorrent is now ready to exit"));
     Logger::freeInstance();
     delete m_fileLogger;
+    MemoryUsageTracker::freeInstance();
 
 #ifndef DISABLE_GUI
     if (m_window)
@@ -1432,6 +1303,11 @@ AddTorrentManagerImpl *Application::addTorrentManager() const
     return m_addTorrentManager;
 }
 
+ExternalProgramRunner *Application::externalProgramRunner() const
+{
+    return m_externalProgramRunner;
+}
+
 #ifndef DISABLE_WEBUI
 WebUI *Application::webUI() const
 {
@@ -54,7 +54,9 @@
 #endif
 
 class ApplicationInstanceManager;
+class ExternalProgramRunner;
 class FileLogger;
+class NotificationMailer;
 
 namespace BitTorrent
 {
@@ -123,6 +125,10 @@ public:
     void setFileLoggerAge(int value) override;
     int fileLoggerAgeType() const override;
     void setFileLoggerAgeType(int value) override;
+    int fileLoggerFormat() const override;
+    void setFileLoggerFormat(int value) override;
+    bool isFileLoggerCompressBackups() const override;
+    void setFileLoggerCompressBackups(bool value) override;
 
     int memoryWorkingSetLimit() const override;
     void setMemoryWorkingSetLimit(int size) override;
@@ -158,14 +164,13 @@ private slots:
 
 private:
     AddTorrentManagerImpl *addTorrentManager() const override;
+    ExternalProgramRunner *externalProgramRunner() const override;
 #ifndef DISABLE_WEBUI
     WebUI *webUI() const override;
 #endif
 
     void initializeTranslation();
     void processParams(const QBtCommandLineParameters &params);
-    void runExternalProgram(const QString &programTemplate, const BitTorrent::Torrent *torrent) const;
-    void sendNotificationEmail(const BitTorrent::Torrent *torrent);
 
 #if defined(QBT_USES_LIBTORRENT2) && !defined(Q_OS_MACOS)
     void applyMemoryWorkingSetLimit() const;
@@ -207,6 +212,8 @@ private:
     SettingValue<int> m_storeFileLoggerAge;
     SettingValue<int> m_storeFileLoggerAgeType;
     SettingValue<Path> m_storeFileLoggerPath;
+    SettingValue<int> m_storeFileLoggerFormat;
+    SettingValue<bool> m_storeFileLoggerCompressBackups;
     SettingValue<int> m_storeMemoryWorkingSetLimit;
 
 #ifdef Q_OS_WIN
@@ -214,6 +221,8 @@ private:
 #endif
 
     AddTorrentManagerImpl *m_addTorrentManager = nullptr;
+    ExternalProgramRunner *m_externalProgramRunner = nullptr;
+    NotificationMailer *m_notificationMailer = nullptr;
 
 #ifndef DISABLE_GUI
     SettingValue<WindowState> m_startUpWindowState;
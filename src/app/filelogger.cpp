@@ -28,33 +28,141 @@
 
 #include "filelogger.h"
 
+#include <algorithm>
 #include <chrono>
+#include <utility>
 
+#include <QByteArray>
 #include <QDateTime>
+#include <QDeadlineTimer>
 #include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QList>
-#include <QTextStream>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
 
 #include "base/global.h"
 #include "base/logger.h"
 #include "base/utils/fs.h"
+#include "base/utils/gzip.h"
 
 namespace
 {
-    const std::chrono::seconds FLUSH_INTERVAL {2};
+    // Messages are collected for up to BATCH_INTERVAL (or until BATCH_SIZE of them
+    // are pending) and then written and flushed by the worker thread at once
+    const std::chrono::seconds BATCH_INTERVAL {1};
+    const qsizetype BATCH_SIZE = 512;
+
+    struct LogFileSettings
+    {
+        Path path;
+        bool backup = true;
+        int maxSize = 0;
+        FileLogger::FileLogFormat format = FileLogger::TEXT;
+        bool compressBackups = false;
+    };
+
+    QString msgTypeName(const Log::MsgType type)
+    {
+        switch (type)
+        {
+        case Log::INFO:
+            return u"info"_s;
+        case Log::WARNING:
+            return u"warning"_s;
+        case Log::CRITICAL:
+            return u"critical"_s;
+        default:
+            return u"normal"_s;
+        }
+    }
+
+    QByteArray formatMessage(const Log::Msg &msg, const FileLogger::FileLogFormat format)
+    {
+        const QString timestamp = QDateTime::fromSecsSinceEpoch(msg.timestamp).toString(Qt::ISODate);
+
+        if (format == FileLogger::JSON)
+        {
+            const QJsonObject jsonMsg {
+                {u"id"_s, msg.id},
+                {u"timestamp"_s, timestamp},
+                {u"type"_s, msgTypeName(msg.type)},
+                {u"message"_s, msg.message}
+            };
+            return QJsonDocument(jsonMsg).toJson(QJsonDocument::Compact).append('\n');
+        }
+
+        QString typeMark;
+        switch (msg.type)
+        {
+        case Log::INFO:
+            typeMark = u"(I) "_s;
+            break;
+        case Log::WARNING:
+            typeMark = u"(W) "_s;
+            break;
+        case Log::CRITICAL:
+            typeMark = u"(C) "_s;
+            break;
+        default:
+            typeMark = u"(N) "_s;
+        }
+
+        const QString line = typeMark + timestamp + u" - " + msg.message + u'\n';
+        return line.toUtf8();
+    }
 }
 
+class FileLogger::Worker final : public QThread
+{
+    Q_DISABLE_COPY_MOVE(Worker)
+
+public:
+    explicit Worker(const LogFileSettings &settings, QObject *parent = nullptr);
+
+    void run() override;
+    void requestInterruption();
+
+    void addMessage(const Log::Msg &msg);
+    void changePath(const Path &path);
+    void setBackup(bool value);
+    void setMaxSize(int value);
+    void setFormat(FileLogFormat format);
+    void setCompressBackups(bool value);
+
+private:
+    void updateSettings(const LogFileSettings &settings);
+    void writeMessages(const QList<Log::Msg> &messages);
+    void writeLogFile(const QByteArray &data);
+    void rotateLogFile();
+    void compressBackup(const Path &backupPath) const;
+    int findNextBackupIndex() const;
+    void openLogFile();
+    void closeLogFile();
+
+    QMutex m_mutex;
+    QWaitCondition m_waitCondition;
+    QList<Log::Msg> m_pendingMessages;
+    LogFileSettings m_pendingSettings;
+    bool m_settingsChanged = true;
+
+    // accessed from worker thread only
+    LogFileSettings m_settings;
+    QFile m_logFile;
+    qint64 m_logFileSize = 0;
+    int m_nextBackupIndex = 0;
+};
+
 FileLogger::FileLogger(const Path &path, const bool backup
                        , const int maxSize, const bool deleteOld, const int age
-                       , const FileLogAgeType ageType)
-    : m_backup(backup)
-    , m_maxSize(maxSize)
+                       , const FileLogAgeType ageType, const FileLogFormat format
+                       , const bool compressBackups)
+    : m_path {path / Path(u"qbittorrent.log"_s)}
+    , m_worker {new Worker({.path = m_path, .backup = backup, .maxSize = maxSize, .format = format, .compressBackups = compressBackups}, this)}
 {
-    m_flusher.setInterval(FLUSH_INTERVAL);
-    m_flusher.setSingleShot(true);
-    connect(&m_flusher, &QTimer::timeout, this, &FileLogger::flushLog);
-
-    changePath(path);
     if (deleteOld)
         this->deleteOld(age, ageType);
 
@@ -63,11 +171,14 @@ FileLogger::FileLogger(const Path &path, const bool backup
         addLogMessage(msg);
 
     connect(logger, &Logger::newLogMessage, this, &FileLogger::addLogMessage);
+
+    m_worker->start(QThread::LowPriority);
 }
 
 FileLogger::~FileLogger()
 {
-    closeLogFile();
+    m_worker->requestInterruption();
+    m_worker->wait();
 }
 
 void FileLogger::changePath(const Path &newPath)
@@ -76,13 +187,8 @@ void FileLogger::changePath(const Path &newPath)
     if (newPath.data() == m_path.parentPath().data())
         return;
 
-    closeLogFile();
-
     m_path = newPath / Path(u"qbittorrent.log"_s);
-    m_logFile.setFileName(m_path.data());
-
-    Utils::Fs::mkpath(newPath);
-    openLogFile();
+    m_worker->changePath(m_path);
 }
 
 void FileLogger::deleteOld(const int age, const FileLogAgeType ageType)
@@ -114,80 +220,242 @@ void FileLogger::deleteOld(const int age, const FileLogAgeType ageType)
 
 void FileLogger::setBackup(const bool value)
 {
-    m_backup = value;
+    m_worker->setBackup(value);
 }
 
 void FileLogger::setMaxSize(const int value)
 {
-    m_maxSize = value;
+    m_worker->setMaxSize(value);
+}
+
+void FileLogger::setFormat(const FileLogFormat format)
+{
+    m_worker->setFormat(format);
+}
+
+void FileLogger::setCompressBackups(const bool value)
+{
+    m_worker->setCompressBackups(value);
 }
 
 void FileLogger::addLogMessage(const Log::Msg &msg)
 {
-    if (!m_logFile.isOpen()) return;
+    m_worker->addMessage(msg);
+}
 
-    QTextStream stream(&m_logFile);
+FileLogger::Worker::Worker(const LogFileSettings &settings, QObject *parent)
+    : QThread(parent)
+    , m_pendingSettings {settings}
+{
+}
 
-    switch (msg.type)
+void FileLogger::Worker::run()
+{
+    while (true)
     {
-    case Log::INFO:
-        stream << QStringView(u"(I) ");
-        break;
-    case Log::WARNING:
-        stream << QStringView(u"(W) ");
-        break;
-    case Log::CRITICAL:
-        stream << QStringView(u"(C) ");
-        break;
-    default:
-        stream << QStringView(u"(N) ");
+        QList<Log::Msg> messages;
+        LogFileSettings settings;
+        bool settingsChanged = false;
+        bool interruptionRequested = false;
+
+        {
+            QMutexLocker locker {&m_mutex};
+
+            while (m_pendingMessages.isEmpty() && !m_settingsChanged && !isInterruptionRequested())
+                m_waitCondition.wait(&m_mutex);
+
+            const QDeadlineTimer batchDeadline {BATCH_INTERVAL};
+            while (!m_pendingMessages.isEmpty() && (m_pendingMessages.size() < BATCH_SIZE) && !isInterruptionRequested())
+            {
+                if (!m_waitCondition.wait(&m_mutex, batchDeadline))
+                    break;
+            }
+
+            messages.swap(m_pendingMessages);
+            settings = m_pendingSettings;
+            settingsChanged = std::exchange(m_settingsChanged, false);
+            interruptionRequested = isInterruptionRequested();
+        }
+
+        if (settingsChanged)
+            updateSettings(settings);
+
+        if (!messages.isEmpty())
+            writeMessages(messages);
+
+        if (interruptionRequested)
+            break;
     }
 
-    stream << QDateTime::fromSecsSinceEpoch(msg.timestamp).toString(Qt::ISODate) << QStringView(u" - ") << msg.message << QChar(u'\n');
+    closeLogFile();
+}
 
-    if (m_backup && (m_logFile.size() >= m_maxSize))
+void FileLogger::Worker::requestInterruption()
+{
+    const QMutexLocker locker {&m_mutex};
+    QThread::requestInterruption();
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::addMessage(const Log::Msg &msg)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingMessages.append(msg);
+    // wake up the worker to start a new batch or to write the full one
+    if ((m_pendingMessages.size() == 1) || (m_pendingMessages.size() == BATCH_SIZE))
+        m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::changePath(const Path &path)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingSettings.path = path;
+    m_settingsChanged = true;
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::setBackup(const bool value)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingSettings.backup = value;
+    m_settingsChanged = true;
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::setMaxSize(const int value)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingSettings.maxSize = value;
+    m_settingsChanged = true;
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::setFormat(const FileLogFormat format)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingSettings.format = format;
+    m_settingsChanged = true;
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::setCompressBackups(const bool value)
+{
+    const QMutexLocker locker {&m_mutex};
+    m_pendingSettings.compressBackups = value;
+    m_settingsChanged = true;
+    m_waitCondition.wakeAll();
+}
+
+void FileLogger::Worker::updateSettings(const LogFileSettings &settings)
+{
+    const bool pathChanged = (settings.path != m_settings.path);
+    m_settings = settings;
+
+    if (pathChanged)
     {
         closeLogFile();
-        int counter = 0;
-        Path backupLogFilename = m_path + u".bak";
+        Utils::Fs::mkpath(m_settings.path.parentPath());
+        m_nextBackupIndex = findNextBackupIndex();
+        openLogFile();
+    }
+}
+
+void FileLogger::Worker::writeMessages(const QList<Log::Msg> &messages)
+{
+    if (!m_logFile.isOpen())
+        return;
 
-        while (backupLogFilename.exists())
+    QByteArray data;
+    for (const Log::Msg &msg : messages)
+    {
+        data.append(formatMessage(msg, m_settings.format));
+
+        if (m_settings.backup && ((m_logFileSize + data.size()) >= m_settings.maxSize))
         {
-            ++counter;
-            backupLogFilename = m_path + u".bak" + QString::number(counter);
-        }
+            writeLogFile(data);
+            data.clear();
 
-        Utils::Fs::renameFile(m_path, backupLogFilename);
-        openLogFile();
+            rotateLogFile();
+            if (!m_logFile.isOpen())
+                return;
+        }
     }
+
+    writeLogFile(data);
+    m_logFile.flush();
+}
+
+void FileLogger::Worker::writeLogFile(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+
+    const qint64 bytesWritten = m_logFile.write(data);
+    if (bytesWritten > 0)
+        m_logFileSize += bytesWritten;
+}
+
+void FileLogger::Worker::rotateLogFile()
+{
+    closeLogFile();
+
+    const Path backupPath = m_settings.path + u".bak"
+            + ((m_nextBackupIndex > 0) ? QString::number(m_nextBackupIndex) : QString());
+    ++m_nextBackupIndex;
+
+    Utils::Fs::renameFile(m_settings.path, backupPath);
+    openLogFile();
+
+    if (m_settings.compressBackups)
+        compressBackup(backupPath);
+}
+
+void FileLogger::Worker::compressBackup(const Path &backupPath) const
+{
+    const Path compressedPath = backupPath + u".gz";
+    if (Utils::Gzip::compressFile(backupPath, compressedPath))
+        Utils::Fs::removeFile(backupPath);
     else
-    {
-        if (!m_flusher.isActive())
-            m_flusher.start();
-    }
+        Utils::Fs::removeFile(compressedPath);
 }
 
-void FileLogger::flushLog()
+int FileLogger::Worker::findNextBackupIndex() const
 {
-    if (m_logFile.isOpen())
-        m_logFile.flush();
+    const QString backupPrefix = m_settings.path.filename() + u".bak";
+    const QDir dir {m_settings.path.parentPath().data()};
+
+    int nextIndex = 0;
+    for (const QString &fileName : asConst(dir.entryList({backupPrefix + u'*'}, QDir::Files)))
+    {
+        QStringView suffix = QStringView(fileName).sliced(backupPrefix.size());
+        if (suffix.endsWith(u".gz"))
+            suffix.chop(3);
+
+        bool ok = true;
+        const int index = suffix.isEmpty() ? 0 : suffix.toInt(&ok);
+        if (ok)
+            nextIndex = std::max(nextIndex, (index + 1));
+    }
+
+    return nextIndex;
 }
 
-void FileLogger::openLogFile()
+void FileLogger::Worker::openLogFile()
 {
+    m_logFile.setFileName(m_settings.path.data());
     if (!m_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
     {
-        LogMsg(tr("An error occurred while trying to open the log file. Logging to file is disabled. File: \"%1\". Error: \"%2\".")
+        LogMsg(FileLogger::tr("An error occurred while trying to open the log file. Logging to file is disabled. File: \"%1\". Error: \"%2\".")
             .arg(m_logFile.fileName(), m_logFile.errorString()), Log::CRITICAL);
         return;
     }
 
     // best effort, don't report error
     m_logFile.setPermissions(QFile::ReadOwner | QFile::WriteOwner);
+    m_logFileSize = m_logFile.size();
 }
 
-void FileLogger::closeLogFile()
+void FileLogger::Worker::closeLogFile()
 {
-    m_flusher.stop();
     m_logFile.close();
 }
@@ -28,9 +28,7 @@
 
 #pragma once
 
-#include <QFile>
 #include <QObject>
-#include <QTimer>
 
 #include "base/path.h"
 
@@ -52,25 +50,29 @@ public:
         YEARS
     };
 
-    FileLogger(const Path &path, bool backup, int maxSize, bool deleteOld, int age, FileLogAgeType ageType);
+    enum FileLogFormat
+    {
+        TEXT,
+        JSON
+    };
+
+    FileLogger(const Path &path, bool backup, int maxSize, bool deleteOld, int age, FileLogAgeType ageType
+               , FileLogFormat format, bool compressBackups);
     ~FileLogger();
 
     void changePath(const Path &newPath);
     void deleteOld(int age, FileLogAgeType ageType);
     void setBackup(bool value);
     void setMaxSize(int value);
+    void setFormat(FileLogFormat format);
+    void setCompressBackups(bool value);
 
 private slots:
     void addLogMessage(const Log::Msg &msg);
-    void flushLog();
 
 private:
-    void openLogFile();
-    void closeLogFile();
+    class Worker;
 
     Path m_path;
-    bool m_backup;
-    int m_maxSize;
-    QFile m_logFile;
-    QTimer m_flusher;
+    Worker *m_worker = nullptr;
 };
@@ -0,0 +1,196 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "notificationmailer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QEventLoop>
+#include <QTimer>
+
+#include "base/bittorrent/torrent.h"
+#include "base/global.h"
+#include "base/logger.h"
+#include "base/net/smtp.h"
+#include "base/preferences.h"
+#include "base/utils/misc.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    const int MAX_ATTEMPTS = 5;
+    const std::chrono::seconds RETRY_DELAY = 1min;
+    const std::chrono::seconds MAX_RETRY_DELAY = 1h;
+    const std::chrono::seconds FLUSH_TIMEOUT = 10s;
+}
+
+NotificationMailer::NotificationMailer(QObject *parent)
+    : QObject(parent)
+    , m_digestTimer {new QTimer(this)}
+    , m_retryTimer {new QTimer(this)}
+{
+    m_digestTimer->setSingleShot(true);
+    connect(m_digestTimer, &QTimer::timeout, this, &NotificationMailer::sendDigest);
+
+    m_retryTimer->setSingleShot(true);
+    connect(m_retryTimer, &QTimer::timeout, this, &NotificationMailer::sendQueuedMails);
+}
+
+void NotificationMailer::notifyTorrentFinished(const BitTorrent::Torrent *torrent)
+{
+    const QString description = tr("Torrent name: %1").arg(torrent->name()) + u'\n'
+        + tr("Torrent size: %1").arg(Utils::Misc::friendlyUnit(torrent->wantedSize())) + u'\n'
+        + tr("Save path: %1").arg(torrent->savePath().toString()) + u"\n\n"
+        + tr("The torrent was downloaded in %1.", "The torrent was downloaded in 1 hour and 20 seconds")
+            .arg(Utils::Misc::userFriendlyDuration(torrent->activeTime()));
+    m_digestEntries.append({.torrentName = torrent->name(), .description = description});
+
+    const int digestInterval = Preferences::instance()->getMailNotificationDigestInterval();
+    if (digestInterval <= 0)
+        sendDigest();
+    else if (!m_digestTimer->isActive())
+        m_digestTimer->start(std::chrono::minutes(digestInterval));
+}
+
+// Sends the collected digest immediately and waits (for limited time) until the queued mails are sent.
+// It is intended to be used on exit so that the notifications aren't lost.
+void NotificationMailer::flush()
+{
+    sendDigest();
+    if (!isSending())
+        return;
+
+    QEventLoop loop;
+    m_flushLoop = &loop;
+    QTimer::singleShot(FLUSH_TIMEOUT, &loop, &QEventLoop::quit);
+    loop.exec(QEventLoop::ExcludeUserInputEvents);
+    m_flushLoop = nullptr;
+}
+
+bool NotificationMailer::isSending() const
+{
+    // the mails waiting for retry aren't considered
+    return !m_sendingMails.isEmpty() || (!m_queue.isEmpty() && !m_retryTimer->isActive());
+}
+
+void NotificationMailer::enqueue(const Mail &mail)
+{
+    m_queue.enqueue(mail);
+    sendQueuedMails();
+}
+
+void NotificationMailer::sendDigest()
+{
+    m_digestTimer->stop();
+    if (m_digestEntries.isEmpty())
+        return;
+
+    const QString subject = (m_digestEntries.size() == 1)
+        ? tr("Torrent \"%1\" has finished downloading").arg(m_digestEntries.first().torrentName)
+        : tr("%1 torrents have finished downloading").arg(m_digestEntries.size());
+
+    QString content;
+    for (const DigestEntry &entry : asConst(m_digestEntries))
+        content += entry.description + u"\n\n\n";
+    content += tr("Thank you for using qBittorrent.") + u'\n';
+
+    m_digestEntries.clear();
+    enqueue({.subject = subject, .body = content});
+}
+
+void NotificationMailer::sendQueuedMails()
+{
+    if (m_queue.isEmpty() || m_retryTimer->isActive())
+        return;
+
+    // wait until the closing session ends, the queued mails are sent over the new one
+    if (m_smtp && !m_smtp->canSendMail())
+        return;
+
+    if (!m_smtp)
+    {
+        m_smtp = new Net::Smtp(this);
+        connect(m_smtp, &Net::Smtp::mailSent, this, &NotificationMailer::handleMailSent);
+        connect(m_smtp, &QObject::destroyed, this, &NotificationMailer::handleSessionEnded);
+    }
+
+    const Preferences *pref = Preferences::instance();
+    while (!m_queue.isEmpty())
+    {
+        const Mail mail = m_queue.dequeue();
+        m_smtp->sendMail(pref->getMailNotificationSender(), pref->getMailNotificationEmail(), mail.subject, mail.body);
+        m_sendingMails.enqueue(mail);
+    }
+}
+
+void NotificationMailer::handleMailSent()
+{
+    m_sendingMails.dequeue();
+    m_failureCount = 0;
+
+    if (m_flushLoop && !isSending())
+        m_flushLoop->quit();
+}
+
+void NotificationMailer::handleSessionEnded()
+{
+    if (!m_sendingMails.isEmpty())
+    {
+        ++m_failureCount;
+
+        // put the failed mails back in front of the queue preserving their order
+        while (!m_sendingMails.isEmpty())
+        {
+            Mail mail = m_sendingMails.takeLast();
+            ++mail.attempts;
+            if (mail.attempts >= MAX_ATTEMPTS)
+            {
+                LogMsg(tr("Failed to send notification email. Giving up after %1 attempts. Subject: \"%2\"")
+                    .arg(QString::number(mail.attempts), mail.subject), Log::WARNING);
+                continue;
+            }
+
+            m_queue.prepend(mail);
+        }
+
+        if (!m_queue.isEmpty())
+        {
+            const auto retryDelay = std::min((RETRY_DELAY * (1 << std::min((m_failureCount - 1), 10))), MAX_RETRY_DELAY);
+            LogMsg(tr("Failed to send notification emails. Retrying in %1 seconds. Queued emails: %2")
+                .arg(QString::number(retryDelay.count()), QString::number(m_queue.size())), Log::WARNING);
+            m_retryTimer->start(retryDelay);
+        }
+    }
+
+    sendQueuedMails();
+
+    if (m_flushLoop && !isSending())
+        m_flushLoop->quit();
+}
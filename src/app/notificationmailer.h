@@ -0,0 +1,94 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQueue>
+#include <QString>
+
+class QEventLoop;
+class QTimer;
+
+namespace BitTorrent
+{
+    class Torrent;
+}
+
+namespace Net
+{
+    class Smtp;
+}
+
+// Queues the notification emails so that they are sent over single SMTP connection.
+// Notifications about finished torrents can be collected into periodic digests.
+// The messages which failed to be sent are retried with increasing delay.
+class NotificationMailer final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(NotificationMailer)
+
+public:
+    explicit NotificationMailer(QObject *parent = nullptr);
+
+    void notifyTorrentFinished(const BitTorrent::Torrent *torrent);
+    void flush();
+
+private:
+    struct Mail
+    {
+        QString subject;
+        QString body;
+        int attempts = 0;
+    };
+
+    struct DigestEntry
+    {
+        QString torrentName;
+        QString description;
+    };
+
+    bool isSending() const;
+    void enqueue(const Mail &mail);
+    void sendDigest();
+    void sendQueuedMails();
+    void handleMailSent();
+    void handleSessionEnded();
+
+    QList<DigestEntry> m_digestEntries;
+    QTimer *m_digestTimer = nullptr;
+    QTimer *m_retryTimer = nullptr;
+    QQueue<Mail> m_queue;
+    // mails passed to the current SMTP session which are not confirmed to be sent yet
+    QQueue<Mail> m_sendingMails;
+    QPointer<Net::Smtp> m_smtp;
+    int m_failureCount = 0;
+    QEventLoop *m_flushLoop = nullptr;
+};
@@ -29,6 +29,13 @@
 
 #include "addtorrentmanager.h"
 
+#include <algorithm>
+
+#include <QByteArray>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+
 #include "base/bittorrent/addtorrenterror.h"
 #include "base/bittorrent/infohash.h"
 #include "base/bittorrent/session.h"
@@ -37,11 +44,32 @@
 #include "base/net/downloadmanager.h"
 #include "base/preferences.h"
 
+namespace
+{
+    // Max number of loaded torrents submitted to the session per event loop iteration
+    const int SUBMIT_BATCH_SIZE = 100;
+
+    Path sourceToPath(const QString &source)
+    {
+        return Path(source.startsWith(u"file://", Qt::CaseInsensitive)
+                ? QUrl::fromEncoded(source.toLocal8Bit()).toLocalFile() : source);
+    }
+}
+
 AddTorrentManager::AddTorrentManager(IApplication *app, BitTorrent::Session *btSession, QObject *parent)
     : ApplicationComponent(app, parent)
     , m_btSession {btSession}
+    , m_loadingThreadPool {new QThreadPool(this)}
+    , m_submitTimer {new QTimer(this)}
 {
     Q_ASSERT(btSession);
+
+    m_loadingThreadPool->setObjectName("AddTorrentManager m_loadingThreadPool");
+
+    m_submitTimer->setSingleShot(true);
+    m_submitTimer->setInterval(0);
+    connect(m_submitTimer, &QTimer::timeout, this, &AddTorrentManager::submitLoadedTorrents);
+
     connect(btSession, &BitTorrent::Session::torrentAdded, this, &AddTorrentManager::onSessionTorrentAdded);
     connect(btSession, &BitTorrent::Session::addTorrentFailed, this, &AddTorrentManager::onSessionAddTorrentFailed);
 }
@@ -79,8 +107,7 @@ bool AddTorrentManager::addTorrent(const QString &source, const BitTorrent::AddT
         return false;
     }
 
-    const Path decodedPath {source.startsWith(u"file://", Qt::CaseInsensitive)
-            ? QUrl::fromEncoded(source.toLocal8Bit()).toLocalFile() : source};
+    const Path decodedPath = sourceToPath(source);
     auto torrentFileGuard = std::make_shared<TorrentFileGuard>(decodedPath);
     if (const auto loadResult = BitTorrent::TorrentDescriptor::loadFromFile(decodedPath))
     {
@@ -96,6 +123,54 @@ bool AddTorrentManager::addTorrent(const QString &source, const BitTorrent::AddT
     return false;
 }
 
+void AddTorrentManager::addTorrents(const QStringList &sources, const BitTorrent::AddTorrentParams &params)
+{
+    for (const QString &source : sources)
+    {
+        if (source.isEmpty())
+            continue;
+
+        // Only local .torrent files are worth offloading. Other sources are
+        // either cheap to parse or are processed asynchronously anyway.
+        if (Net::DownloadManager::hasSupportedScheme(source) || source.startsWith(u"magnet:", Qt::CaseInsensitive)
+                || BitTorrent::TorrentDescriptor::parse(source))
+        {
+            addTorrent(source, params);
+            continue;
+        }
+
+        loadTorrent(source, sourceToPath(source), {}, params);
+    }
+
+    if (m_bulkTotalCount > m_bulkProcessedCount)
+        emit addTorrentsProgress(m_bulkProcessedCount, m_bulkTotalCount);
+}
+
+void AddTorrentManager::addTorrentsData(const QHash<QString, QByteArray> &torrentsData, const BitTorrent::AddTorrentParams &params)
+{
+    for (auto it = torrentsData.cbegin(); it != torrentsData.cend(); ++it)
+        loadTorrent(it.key(), {}, it.value(), params);
+
+    if (m_bulkTotalCount > m_bulkProcessedCount)
+        emit addTorrentsProgress(m_bulkProcessedCount, m_bulkTotalCount);
+}
+
+void AddTorrentManager::loadTorrent(const QString &source, const Path &path, const QByteArray &data
+        , const BitTorrent::AddTorrentParams &params)
+{
+    ++m_bulkTotalCount;
+    m_loadingThreadPool->start([this, source, path, data, params]
+    {
+        LoadedTorrent loadedTorrent {source, path
+                , (path.isEmpty() ? BitTorrent::TorrentDescriptor::load(data) : BitTorrent::TorrentDescriptor::loadFromFile(path))
+                , params};
+        QMetaObject::invokeMethod(this, [this, loadedTorrent = std::move(loadedTorrent)]() mutable
+        {
+            handleTorrentFileLoaded(std::move(loadedTorrent));
+        }, Qt::QueuedConnection);
+    });
+}
+
 bool AddTorrentManager::addTorrentToSession(const QString &source, const BitTorrent::TorrentDescriptor &torrentDescr
         , const BitTorrent::AddTorrentParams &addTorrentParams)
 {
@@ -139,6 +214,10 @@ void AddTorrentManager::onSessionTorrentAdded(BitTorrent::Torrent *torrent)
             torrentFileGuard->markAsAddedToSession();
         emit torrentAdded(source, torrent);
     }
+
+    const QList<DuplicateTorrent> duplicates = m_pendingDuplicates.take(torrent->infoHash());
+    for (const DuplicateTorrent &duplicate : duplicates)
+        handleDuplicateTorrent(duplicate.source, duplicate.torrentDescr, torrent);
 }
 
 void AddTorrentManager::onSessionAddTorrentFailed(const BitTorrent::InfoHash &infoHash, const BitTorrent::AddTorrentError &reason)
@@ -150,6 +229,16 @@ void AddTorrentManager::onSessionAddTorrentFailed(const BitTorrent::InfoHash &in
             torrentFileGuard->setAutoRemove(false);
         emit addTorrentFailed(source, reason);
     }
+
+    // The torrent can still be added by one of its duplicates
+    const QList<DuplicateTorrent> duplicates = m_pendingDuplicates.take(infoHash);
+    for (const DuplicateTorrent &duplicate : duplicates)
+    {
+        if (m_sourcesByInfoHash.contains(infoHash))
+            m_pendingDuplicates[infoHash].append(duplicate);
+        else
+            processTorrent(duplicate.source, duplicate.torrentDescr, duplicate.addTorrentParams);
+    }
 }
 
 void AddTorrentManager::handleAddTorrentFailed(const QString &source, const QString &reason)
@@ -201,6 +290,62 @@ std::shared_ptr<TorrentFileGuard> AddTorrentManager::releaseTorrentFileGuard(con
     return m_guardedTorrentFiles.take(source);
 }
 
+void AddTorrentManager::handleTorrentFileLoaded(LoadedTorrent loadedTorrent)
+{
+    m_loadedTorrents.append(std::move(loadedTorrent));
+    if (!m_submitTimer->isActive())
+        m_submitTimer->start();
+}
+
+void AddTorrentManager::submitLoadedTorrents()
+{
+    const qsizetype batchSize = std::min<qsizetype>(m_loadedTorrents.size(), SUBMIT_BATCH_SIZE);
+    const QList<LoadedTorrent> batch = m_loadedTorrents.first(batchSize);
+    m_loadedTorrents.remove(0, batchSize);
+
+    for (const LoadedTorrent &loadedTorrent : batch)
+    {
+        if (!loadedTorrent.loadResult)
+        {
+            handleAddTorrentFailed(loadedTorrent.source, loadedTorrent.loadResult.error());
+            continue;
+        }
+
+        const BitTorrent::TorrentDescriptor &torrentDescr = loadedTorrent.loadResult.value();
+        const BitTorrent::InfoHash infoHash = torrentDescr.infoHash();
+        if (m_sourcesByInfoHash.contains(infoHash))
+        {
+            // Torrent is still being added to the session so it isn't known to it yet.
+            // Duplicate is handled once the torrent is added.
+            m_pendingDuplicates[infoHash].append({loadedTorrent.source, torrentDescr, loadedTorrent.addTorrentParams});
+            continue;
+        }
+
+        if (!loadedTorrent.path.isEmpty())
+            setTorrentFileGuard(loadedTorrent.source, std::make_shared<TorrentFileGuard>(loadedTorrent.path));
+        if (!processTorrent(loadedTorrent.source, torrentDescr, loadedTorrent.addTorrentParams))
+            releaseTorrentFileGuard(loadedTorrent.source);
+    }
+
+    advanceBulkProgress(batch.size());
+
+    if (!m_loadedTorrents.isEmpty())
+        m_submitTimer->start();
+}
+
+void AddTorrentManager::advanceBulkProgress(const int count)
+{
+    m_bulkProcessedCount += count;
+    emit addTorrentsProgress(m_bulkProcessedCount, m_bulkTotalCount);
+
+    if (m_bulkProcessedCount >= m_bulkTotalCount)
+    {
+        LogMsg(tr("Finished loading torrent files. Count: %1").arg(m_bulkTotalCount));
+        m_bulkProcessedCount = 0;
+        m_bulkTotalCount = 0;
+    }
+}
+
 bool AddTorrentManager::processTorrent(const QString &source, const BitTorrent::TorrentDescriptor &torrentDescr
         , const BitTorrent::AddTorrentParams &addTorrentParams)
 {
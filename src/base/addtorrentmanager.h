@@ -32,10 +32,13 @@
 #include <memory>
 
 #include <QHash>
+#include <QList>
 #include <QObject>
 
 #include "base/applicationcomponent.h"
 #include "base/bittorrent/addtorrentparams.h"
+#include "base/bittorrent/torrentdescriptor.h"
+#include "base/path.h"
 #include "base/torrentfileguard.h"
 
 namespace BitTorrent
@@ -43,7 +46,6 @@ namespace BitTorrent
     class InfoHash;
     class Session;
     class Torrent;
-    class TorrentDescriptor;
     struct AddTorrentError;
 }
 
@@ -52,7 +54,10 @@ namespace Net
     struct DownloadResult;
 }
 
+class QByteArray;
 class QString;
+class QThreadPool;
+class QTimer;
 
 class AddTorrentManager : public ApplicationComponent<QObject>
 {
@@ -64,10 +69,19 @@ public:
 
     BitTorrent::Session *btSession() const;
     bool addTorrent(const QString &source, const BitTorrent::AddTorrentParams &params = {});
+    // Bulk version of addTorrent(). Local .torrent files are loaded by worker threads
+    // and the results are submitted to the session in batches.
+    void addTorrents(const QStringList &sources, const BitTorrent::AddTorrentParams &params = {});
+    // Same as addTorrents() for the content of .torrent files, e.g. uploaded ones.
+    // Keys of `torrentsData` are used as the sources of the torrents.
+    void addTorrentsData(const QHash<QString, QByteArray> &torrentsData, const BitTorrent::AddTorrentParams &params = {});
 
 signals:
     void torrentAdded(const QString &source, BitTorrent::Torrent *torrent);
     void addTorrentFailed(const QString &source, const BitTorrent::AddTorrentError &reason);
+    // Reports the progress of torrents being loaded in bulk, `processedCount` reaches
+    // `totalCount` once all of them are submitted to the session
+    void addTorrentsProgress(int processedCount, int totalCount);
 
 protected:
     bool addTorrentToSession(const QString &source, const BitTorrent::TorrentDescriptor &torrentDescr
@@ -78,14 +92,41 @@ protected:
     std::shared_ptr<TorrentFileGuard> releaseTorrentFileGuard(const QString &source);
 
 private:
+    struct LoadedTorrent
+    {
+        QString source;
+        Path path;
+        nonstd::expected<BitTorrent::TorrentDescriptor, QString> loadResult;
+        BitTorrent::AddTorrentParams addTorrentParams;
+    };
+
+    struct DuplicateTorrent
+    {
+        QString source;
+        BitTorrent::TorrentDescriptor torrentDescr;
+        BitTorrent::AddTorrentParams addTorrentParams;
+    };
+
     void onDownloadFinished(const Net::DownloadResult &result);
     void onSessionTorrentAdded(BitTorrent::Torrent *torrent);
     void onSessionAddTorrentFailed(const BitTorrent::InfoHash &infoHash, const BitTorrent::AddTorrentError &reason);
     bool processTorrent(const QString &source, const BitTorrent::TorrentDescriptor &torrentDescr
             , const BitTorrent::AddTorrentParams &addTorrentParams);
+    void loadTorrent(const QString &source, const Path &path, const QByteArray &data, const BitTorrent::AddTorrentParams &params);
+    void handleTorrentFileLoaded(LoadedTorrent loadedTorrent);
+    void submitLoadedTorrents();
+    void advanceBulkProgress(int count);
 
     BitTorrent::Session *m_btSession = nullptr;
     QHash<QString, BitTorrent::AddTorrentParams> m_downloadedTorrents;
     QHash<BitTorrent::InfoHash, QString> m_sourcesByInfoHash;
     QHash<QString, std::shared_ptr<TorrentFileGuard>> m_guardedTorrentFiles;
+
+    QThreadPool *m_loadingThreadPool = nullptr;
+    QTimer *m_submitTimer = nullptr;
+    QList<LoadedTorrent> m_loadedTorrents;
+    // Duplicates of torrents which are still being added to the session
+    QHash<BitTorrent::InfoHash, QList<DuplicateTorrent>> m_pendingDuplicates;
+    int m_bulkTotalCount = 0;
+    int m_bulkProcessedCount = 0;
 };
@@ -87,7 +87,13 @@ void BitTorrent::AbstractFileStorage::renameFolder(const Path &oldFolderPath, co
     if (renamingFileIndexes.isEmpty())
         throw RuntimeError(tr("No such folder: '%1'.").arg(oldFolderPath.toString()));
 
-    for (const int index : renamingFileIndexes)
+    renameFolderFiles(renamingFileIndexes, oldFolderPath, newFolderPath);
+}
+
+void BitTorrent::AbstractFileStorage::renameFolderFiles(const QList<int> &fileIndexes
+        , const Path &oldFolderPath, const Path &newFolderPath)
+{
+    for (const int index : fileIndexes)
     {
         const Path newFilePath = newFolderPath / oldFolderPath.relativePathOf(filePath(index));
         renameFile(index, newFilePath);
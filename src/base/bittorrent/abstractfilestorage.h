@@ -29,6 +29,7 @@
 #pragma once
 
 #include <QCoreApplication>
+#include <QtContainerFwd>
 
 #include "base/pathfwd.h"
 
@@ -51,5 +52,10 @@ namespace BitTorrent
 
         void renameFile(const Path &oldPath, const Path &newPath);
         void renameFolder(const Path &oldFolderPath, const Path &newFolderPath);
+
+    protected:
+        // Renames all the files of the folder at once, they are already checked to be renamable.
+        // Default implementation renames them one by one.
+        virtual void renameFolderFiles(const QList<int> &fileIndexes, const Path &oldFolderPath, const Path &newFolderPath);
     };
 }
@@ -0,0 +1,70 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "bandwidthgroup.h"
+
+#include <algorithm>
+#include <numeric>
+
+QList<int> BitTorrent::shareBandwidth(const int limit, const QList<int> &demands)
+{
+    const qsizetype count = demands.size();
+    if (count == 0)
+        return {};
+
+    QList<qsizetype> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [&demands](const qsizetype left, const qsizetype right)
+    {
+        return demands[left] < demands[right];
+    });
+
+    QList<int> shares(count, 0);
+    qint64 remaining = limit;
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        const qsizetype index = order[i];
+        const qint64 equalShare = remaining / (count - i);
+        const qint64 share = std::min<qint64>(std::max(demands[index], 0), equalShare);
+        shares[index] = static_cast<int>(share);
+        remaining -= share;
+    }
+
+    if (remaining > 0)
+    {
+        const qint64 extraShare = remaining / count;
+        for (int &share : shares)
+            share += static_cast<int>(extraShare);
+    }
+
+    // libtorrent treats zero as "unlimited"
+    for (int &share : shares)
+        share = std::max(share, 1);
+
+    return shares;
+}
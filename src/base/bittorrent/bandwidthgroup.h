@@ -0,0 +1,66 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <QtTypes>
+#include <QList>
+#include <QString>
+
+namespace BitTorrent
+{
+    enum class BandwidthGroupType
+    {
+        Category,
+        Tag
+    };
+
+    struct BandwidthGroupLimits
+    {
+        int downloadLimit = 0;
+        int uploadLimit = 0;
+
+        friend bool operator==(const BandwidthGroupLimits &, const BandwidthGroupLimits &) = default;
+    };
+
+    struct BandwidthGroupStatus
+    {
+        BandwidthGroupType type = BandwidthGroupType::Category;
+        QString name;
+        BandwidthGroupLimits limits;
+        int torrentsCount = 0;
+        qint64 downloadRate = 0;
+        qint64 uploadRate = 0;
+    };
+
+    // Shares the group limit between members using max-min fairness: members that
+    // demand less than an equal share get their demand, the remaining bandwidth is
+    // shared equally by the others. Bandwidth left unused is spread over all members
+    // so that they are able to increase their rates.
+    QList<int> shareBandwidth(int limit, const QList<int> &demands);
+}
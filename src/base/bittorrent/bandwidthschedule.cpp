@@ -0,0 +1,250 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "bandwidthschedule.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+#include <QTimeZone>
+
+#include "base/global.h"
+
+using namespace BitTorrent;
+
+namespace
+{
+    const QString OPTION_DAYS = u"days"_s;
+    const QString OPTION_START = u"start"_s;
+    const QString OPTION_END = u"end"_s;
+    const QString OPTION_SCOPE = u"scope"_s;
+    const QString OPTION_NAME = u"name"_s;
+    const QString OPTION_DOWNLOADLIMIT = u"dl_limit"_s;
+    const QString OPTION_UPLOADLIMIT = u"up_limit"_s;
+
+    const QString SCOPE_GLOBAL = u"global"_s;
+    const QString SCOPE_CATEGORY = u"category"_s;
+    const QString SCOPE_TAG = u"tag"_s;
+
+    const QString TIME_FORMAT = u"HH:mm"_s;
+
+    bool isDayIncluded(const int days, const QDate &date)
+    {
+        return (days & (1 << (date.dayOfWeek() - 1)));
+    }
+
+    QDateTime rangeEnd(const QDate &startDate, const QTime &startTime, const QTime &endTime, const QTimeZone &timeZone)
+    {
+        return {((endTime > startTime) ? startDate : startDate.addDays(1)), endTime, timeZone};
+    }
+
+    void mergeLimits(BandwidthScheduleLimits &limits, const BandwidthScheduleLimits &other)
+    {
+        if (other.downloadLimit >= 0)
+            limits.downloadLimit = other.downloadLimit;
+        if (other.uploadLimit >= 0)
+            limits.uploadLimit = other.uploadLimit;
+    }
+
+    int rampLimit(const int from, const int to, const double progress)
+    {
+        if ((from <= 0) || (to <= 0) || (progress >= 1))
+            return to;
+
+        return static_cast<int>(std::lround(from + ((to - from) * progress)));
+    }
+
+    BandwidthScheduleLimits rampLimits(const BandwidthScheduleLimits &from, const BandwidthScheduleLimits &to, const double progress)
+    {
+        return {
+            .downloadLimit = rampLimit(from.downloadLimit, to.downloadLimit, progress),
+            .uploadLimit = rampLimit(from.uploadLimit, to.uploadLimit, progress)
+        };
+    }
+
+    QHash<QString, BandwidthScheduleLimits> rampGroupLimits(const QHash<QString, BandwidthScheduleLimits> &from
+            , const QHash<QString, BandwidthScheduleLimits> &to, const double progress)
+    {
+        QHash<QString, BandwidthScheduleLimits> result;
+        result.reserve(to.size());
+        for (auto it = to.cbegin(); it != to.cend(); ++it)
+            result.insert(it.key(), rampLimits(from.value(it.key()), it.value(), progress));
+        return result;
+    }
+}
+
+bool BandwidthScheduleRule::isActiveAt(const QDateTime &dateTime) const
+{
+    // the range that started yesterday can still be in progress
+    for (const QDate &date : {dateTime.date().addDays(-1), dateTime.date()})
+    {
+        if (!isDayIncluded(days, date))
+            continue;
+
+        const QDateTime start {date, startTime, dateTime.timeRepresentation()};
+        if ((start <= dateTime) && (dateTime < rangeEnd(date, startTime, endTime, dateTime.timeRepresentation())))
+            return true;
+    }
+
+    return false;
+}
+
+BandwidthScheduleRule BandwidthScheduleRule::fromJSON(const QJsonObject &jsonObj)
+{
+    BandwidthScheduleRule rule;
+
+    if (const QJsonValue daysValue = jsonObj.value(OPTION_DAYS); daysValue.isArray())
+    {
+        rule.days = 0;
+        for (const QJsonValue &dayValue : asConst(daysValue.toArray()))
+        {
+            if (const int day = dayValue.toInt(); (day >= 1) && (day <= 7))
+                rule.days |= (1 << (day - 1));
+        }
+    }
+
+    if (const QTime startTime = QTime::fromString(jsonObj.value(OPTION_START).toString(), TIME_FORMAT); startTime.isValid())
+        rule.startTime = startTime;
+    if (const QTime endTime = QTime::fromString(jsonObj.value(OPTION_END).toString(), TIME_FORMAT); endTime.isValid())
+        rule.endTime = endTime;
+
+    const QString scope = jsonObj.value(OPTION_SCOPE).toString();
+    if (scope == SCOPE_CATEGORY)
+        rule.scope = BandwidthScheduleScope::Category;
+    else if (scope == SCOPE_TAG)
+        rule.scope = BandwidthScheduleScope::Tag;
+    if (rule.scope != BandwidthScheduleScope::Global)
+        rule.groupName = jsonObj.value(OPTION_NAME).toString();
+
+    rule.limits.downloadLimit = std::max(-1, jsonObj.value(OPTION_DOWNLOADLIMIT).toInt(-1));
+    rule.limits.uploadLimit = std::max(-1, jsonObj.value(OPTION_UPLOADLIMIT).toInt(-1));
+
+    return rule;
+}
+
+QJsonObject BandwidthScheduleRule::toJSON() const
+{
+    QJsonArray daysArray;
+    for (int day = 1; day <= 7; ++day)
+    {
+        if (days & (1 << (day - 1)))
+            daysArray.append(day);
+    }
+
+    QJsonObject jsonObj {
+        {OPTION_DAYS, daysArray},
+        {OPTION_START, startTime.toString(TIME_FORMAT)},
+        {OPTION_END, endTime.toString(TIME_FORMAT)},
+        {OPTION_DOWNLOADLIMIT, limits.downloadLimit},
+        {OPTION_UPLOADLIMIT, limits.uploadLimit}
+    };
+
+    switch (scope)
+    {
+    case BandwidthScheduleScope::Global:
+        jsonObj[OPTION_SCOPE] = SCOPE_GLOBAL;
+        break;
+    case BandwidthScheduleScope::Category:
+        jsonObj[OPTION_SCOPE] = SCOPE_CATEGORY;
+        jsonObj[OPTION_NAME] = groupName;
+        break;
+    case BandwidthScheduleScope::Tag:
+        jsonObj[OPTION_SCOPE] = SCOPE_TAG;
+        jsonObj[OPTION_NAME] = groupName;
+        break;
+    }
+
+    return jsonObj;
+}
+
+BandwidthScheduleState BitTorrent::scheduledLimits(const QList<BandwidthScheduleRule> &rules, const QDateTime &dateTime)
+{
+    BandwidthScheduleState state;
+    for (const BandwidthScheduleRule &rule : rules)
+    {
+        if (!rule.isActiveAt(dateTime))
+            continue;
+
+        switch (rule.scope)
+        {
+        case BandwidthScheduleScope::Global:
+            mergeLimits(state.global, rule.limits);
+            break;
+        case BandwidthScheduleScope::Category:
+            mergeLimits(state.categories[rule.groupName], rule.limits);
+            break;
+        case BandwidthScheduleScope::Tag:
+            mergeLimits(state.tags[rule.groupName], rule.limits);
+            break;
+        }
+    }
+
+    return state;
+}
+
+QDateTime BitTorrent::nextScheduleTransition(const QList<BandwidthScheduleRule> &rules, const QDateTime &dateTime)
+{
+    const QTimeZone timeZone = dateTime.timeRepresentation();
+    QDateTime nextTransition;
+    const auto consider = [&dateTime, &nextTransition](const QDateTime &candidate)
+    {
+        if ((candidate > dateTime) && (!nextTransition.isValid() || (candidate < nextTransition)))
+            nextTransition = candidate;
+    };
+
+    for (const BandwidthScheduleRule &rule : rules)
+    {
+        if ((rule.days & BandwidthScheduleRule::EVERY_DAY) == 0)
+            continue;
+
+        for (int offset = -1; offset <= 7; ++offset)
+        {
+            const QDate date = dateTime.date().addDays(offset);
+            if (!isDayIncluded(rule.days, date))
+                continue;
+
+            consider({date, rule.startTime, timeZone});
+            consider(rangeEnd(date, rule.startTime, rule.endTime, timeZone));
+        }
+    }
+
+    return nextTransition;
+}
+
+BandwidthScheduleState BitTorrent::rampScheduledLimits(const BandwidthScheduleState &from, const BandwidthScheduleState &to, const double progress)
+{
+    return {
+        .global = rampLimits(from.global, to.global, progress),
+        .categories = rampGroupLimits(from.categories, to.categories, progress),
+        .tags = rampGroupLimits(from.tags, to.tags, progress)
+    };
+}
@@ -0,0 +1,95 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <QtContainerFwd>
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+#include <QTime>
+
+class QJsonObject;
+
+namespace BitTorrent
+{
+    enum class BandwidthScheduleScope
+    {
+        Global,
+        Category,
+        Tag
+    };
+
+    // Limit values: -1 leaves the configured limit in effect, 0 means unlimited
+    struct BandwidthScheduleLimits
+    {
+        int downloadLimit = -1;
+        int uploadLimit = -1;
+
+        friend bool operator==(const BandwidthScheduleLimits &, const BandwidthScheduleLimits &) = default;
+    };
+
+    struct BandwidthScheduleRule
+    {
+        static constexpr int EVERY_DAY = 0x7F;
+
+        // Days of week the time range starts on, Monday is the lowest bit
+        int days = EVERY_DAY;
+        QTime startTime {0, 0};
+        // The time range ends on the next day if it isn't after the start time
+        QTime endTime {0, 0};
+        BandwidthScheduleScope scope = BandwidthScheduleScope::Global;
+        QString groupName;
+        BandwidthScheduleLimits limits;
+
+        bool isActiveAt(const QDateTime &dateTime) const;
+
+        static BandwidthScheduleRule fromJSON(const QJsonObject &jsonObj);
+        QJsonObject toJSON() const;
+
+        friend bool operator==(const BandwidthScheduleRule &, const BandwidthScheduleRule &) = default;
+    };
+
+    struct BandwidthScheduleState
+    {
+        BandwidthScheduleLimits global;
+        QHash<QString, BandwidthScheduleLimits> categories;
+        QHash<QString, BandwidthScheduleLimits> tags;
+
+        friend bool operator==(const BandwidthScheduleState &, const BandwidthScheduleState &) = default;
+    };
+
+    // Rules listed later take precedence over the earlier ones
+    BandwidthScheduleState scheduledLimits(const QList<BandwidthScheduleRule> &rules, const QDateTime &dateTime);
+    // Returns the closest moment after `dateTime` when some rule starts or ends,
+    // or invalid QDateTime if there is no such moment within a week
+    QDateTime nextScheduleTransition(const QList<BandwidthScheduleRule> &rules, const QDateTime &dateTime);
+    // Intermediate state of a transition, `progress` is in range [0, 1].
+    // Only the changes between two explicit limits are ramped, others take effect immediately.
+    BandwidthScheduleState rampScheduledLimits(const BandwidthScheduleState &from, const BandwidthScheduleState &to, double progress);
+}
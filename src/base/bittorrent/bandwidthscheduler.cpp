@@ -29,7 +29,7 @@
 
 #include "bandwidthscheduler.h"
 
-#include <chrono>
+#include <algorithm>
 #include <utility>
 
 #include <QDate>
@@ -39,31 +39,72 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+    // Wake up regularly anyway to accommodate for external system clock changes
+    // eg from the user or from a timesync utility
+    const std::chrono::milliseconds MAX_INTERVAL = 10min;
+}
+
 BandwidthScheduler::BandwidthScheduler(QObject *parent)
     : QObject(parent)
 {
+    m_timer.setSingleShot(true);
+    m_timer.setTimerType(Qt::PreciseTimer);
     connect(&m_timer, &QTimer::timeout, this, &BandwidthScheduler::onTimeout);
+    // the schedule of alternative limits is stored in preferences
+    connect(Preferences::instance(), &Preferences::changed, this, [this]
+    {
+        if (m_timer.isActive())
+            update();
+    });
 }
 
 void BandwidthScheduler::start()
 {
-    m_lastAlternative = isTimeForAlternative();
-    emit bandwidthLimitRequested(m_lastAlternative);
+    update(true);
+}
 
-    // Timeout regularly to accommodate for external system clock changes
-    // eg from the user or from a timesync utility
-    m_timer.start(30s);
+void BandwidthScheduler::setAlternativeScheduleEnabled(const bool enabled)
+{
+    if (enabled == m_isAlternativeScheduleEnabled)
+        return;
+
+    m_isAlternativeScheduleEnabled = enabled;
+    m_lastAlternative.reset();
+    if (m_timer.isActive())
+        update();
+}
+
+void BandwidthScheduler::setRules(const QList<BitTorrent::BandwidthScheduleRule> &rules)
+{
+    if (rules == m_rules)
+        return;
+
+    m_rules = rules;
+    if (m_timer.isActive())
+        update();
 }
 
-bool BandwidthScheduler::isTimeForAlternative() const
+void BandwidthScheduler::setRampTime(const std::chrono::seconds rampTime)
+{
+    if (rampTime == m_rampTime)
+        return;
+
+    m_rampTime = rampTime;
+    if (m_timer.isActive())
+        update();
+}
+
+bool BandwidthScheduler::isTimeForAlternative(const QDateTime &nowDateTime) const
 {
     const Preferences *const pref = Preferences::instance();
 
     QTime start = pref->getSchedulerStartTime();
     QTime end = pref->getSchedulerEndTime();
-    const QTime now = QTime::currentTime();
+    const QTime now = nowDateTime.time();
     const Scheduler::Days schedulerDays = pref->getSchedulerDays();
-    const int day = QDate::currentDate().dayOfWeek();
+    const int day = nowDateTime.date().dayOfWeek();
     bool alternative = false;
 
     if (start > end)
@@ -110,13 +151,92 @@ bool BandwidthScheduler::isTimeForAlternative() const
     return alternative;
 }
 
+QDateTime BandwidthScheduler::nextAlternativeTransition(const QDateTime &now) const
+{
+    const Preferences *const pref = Preferences::instance();
+    const QTime start = pref->getSchedulerStartTime();
+    const QTime end = pref->getSchedulerEndTime();
+    const QDate today = now.date();
+
+    // the result may also change at midnight when the day of week is changed
+    QDateTime nextTransition {today.addDays(1), QTime(0, 0)};
+    for (const QDateTime &candidate : {QDateTime(today, start), QDateTime(today, end)})
+    {
+        if ((candidate > now) && (candidate < nextTransition))
+            nextTransition = candidate;
+    }
+
+    return nextTransition;
+}
+
 void BandwidthScheduler::onTimeout()
 {
-    const bool alternative = isTimeForAlternative();
+    update();
+}
 
-    if (alternative != m_lastAlternative)
+void BandwidthScheduler::update(const bool initial)
+{
+    const QDateTime now = QDateTime::currentDateTime();
+
+    if (m_isAlternativeScheduleEnabled)
+    {
+        const bool alternative = isTimeForAlternative(now);
+        if (initial || (alternative != m_lastAlternative))
+        {
+            m_lastAlternative = alternative;
+            emit bandwidthLimitRequested(alternative);
+        }
+    }
+
+    const BitTorrent::BandwidthScheduleState targetState = BitTorrent::scheduledLimits(m_rules, now);
+    if (initial)
     {
-        m_lastAlternative = alternative;
-        emit bandwidthLimitRequested(alternative);
+        m_rampStartState = targetState;
+        m_targetState = targetState;
+        m_rampStartTime = {};
     }
+    else if (targetState != m_targetState)
+    {
+        // start the transition from the limits that are currently in effect,
+        // even if the previous transition isn't finished yet
+        m_rampStartState = m_currentState;
+        m_targetState = targetState;
+        m_rampStartTime = now;
+    }
+
+    BitTorrent::BandwidthScheduleState state = m_targetState;
+    bool isRamping = false;
+    if ((m_rampTime > 0s) && m_rampStartTime.isValid())
+    {
+        const std::chrono::milliseconds elapsed {m_rampStartTime.msecsTo(now)};
+        if ((elapsed >= 0ms) && (elapsed < m_rampTime))
+        {
+            const double progress = static_cast<double>(elapsed.count()) / std::chrono::milliseconds(m_rampTime).count();
+            state = BitTorrent::rampScheduledLimits(m_rampStartState, m_targetState, progress);
+            isRamping = (state != m_targetState);
+        }
+    }
+
+    if (initial || (state != m_currentState))
+    {
+        m_currentState = state;
+        emit scheduledLimitsChanged(m_currentState);
+    }
+
+    std::chrono::milliseconds interval = MAX_INTERVAL;
+    if (isRamping)
+    {
+        interval = std::clamp<std::chrono::milliseconds>((m_rampTime / 30), 1s, 30s);
+    }
+    else
+    {
+        const QDateTime alternativeTransition = m_isAlternativeScheduleEnabled ? nextAlternativeTransition(now) : QDateTime();
+        for (const QDateTime &transition : {BitTorrent::nextScheduleTransition(m_rules, now), alternativeTransition})
+        {
+            if (transition.isValid())
+                interval = std::min(interval, std::chrono::milliseconds(now.msecsTo(transition)));
+        }
+    }
+
+    m_timer.start(std::max<std::chrono::milliseconds>(interval, 100ms));
 }
@@ -29,9 +29,16 @@
 
 #pragma once
 
+#include <chrono>
+#include <optional>
+
+#include <QDateTime>
+#include <QList>
 #include <QObject>
 #include <QTimer>
 
+#include "bandwidthschedule.h"
+
 class BandwidthScheduler : public QObject
 {
     Q_OBJECT
@@ -41,13 +48,28 @@ public:
     explicit BandwidthScheduler(QObject *parent = nullptr);
     void start();
 
+    void setAlternativeScheduleEnabled(bool enabled);
+    void setRules(const QList<BitTorrent::BandwidthScheduleRule> &rules);
+    void setRampTime(std::chrono::seconds rampTime);
+
 signals:
     void bandwidthLimitRequested(bool alternative);
+    void scheduledLimitsChanged(const BitTorrent::BandwidthScheduleState &state);
 
 private:
-    bool isTimeForAlternative() const;
+    bool isTimeForAlternative(const QDateTime &now) const;
+    QDateTime nextAlternativeTransition(const QDateTime &now) const;
     void onTimeout();
+    void update(bool initial = false);
 
     QTimer m_timer;
-    bool m_lastAlternative = false;
+    bool m_isAlternativeScheduleEnabled = true;
+    std::optional<bool> m_lastAlternative;
+
+    QList<BitTorrent::BandwidthScheduleRule> m_rules;
+    std::chrono::seconds m_rampTime {0};
+    BitTorrent::BandwidthScheduleState m_currentState;
+    BitTorrent::BandwidthScheduleState m_rampStartState;
+    BitTorrent::BandwidthScheduleState m_targetState;
+    QDateTime m_rampStartTime;
 };
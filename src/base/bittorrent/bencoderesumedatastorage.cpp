@@ -35,10 +35,12 @@
 #include <libtorrent/write_resume_data.hpp>
 
 #include <QByteArray>
+#include <QDateTime>
 #include <QDebug>
 #include <QFile>
 #include <QRegularExpression>
 #include <QThread>
+#include <QTimeZone>
 
 #include "base/exceptions.h"
 #include "base/global.h"
@@ -65,6 +67,7 @@ namespace BitTorrent
         void store(const TorrentID &id, const LoadTorrentParams &resumeData) const;
         void remove(const TorrentID &id) const;
         void storeQueue(const QList<TorrentID> &queue) const;
+        void storeSwarmStats(const QHash<TorrentID, SwarmStats> &stats) const;
 
     private:
         const Path m_resumeDataDir;
@@ -77,6 +80,8 @@ namespace
     const char KEY_SSL_PRIVATE_KEY[] = "qBt-sslPrivateKey";
     const char KEY_SSL_DH_PARAMS[] = "qBt-sslDhParams";
 
+    const QString SWARM_STATS_FILENAME = u"swarm_stats"_s;
+
     template <typename LTStr>
     QString fromLTString(const LTStr &str)
     {
@@ -362,6 +367,8 @@ void BitTorrent::BencodeResumeDataStorage::store(const TorrentID &id, LoadTorren
 
 void BitTorrent::BencodeResumeDataStorage::remove(const TorrentID &id) const
 {
+    m_swarmStats.remove(id);
+
     QMetaObject::invokeMethod(m_asyncWorker, [this, id]()
     {
         m_asyncWorker->remove(id);
@@ -376,6 +383,62 @@ void BitTorrent::BencodeResumeDataStorage::storeQueue(const QList<TorrentID> &qu
     });
 }
 
+QHash<BitTorrent::TorrentID, BitTorrent::SwarmStats> BitTorrent::BencodeResumeDataStorage::loadSwarmStats() const
+{
+    const int lineMaxLength = 128;
+
+    m_swarmStats.clear();
+
+    QFile statsFile {(path() / Path(SWARM_STATS_FILENAME)).data()};
+    if (!statsFile.exists())
+        return {};
+
+    if (!statsFile.open(QFile::ReadOnly))
+    {
+        LogMsg(tr("Couldn't load swarm statistics: %1").arg(statsFile.errorString()), Log::WARNING);
+        return {};
+    }
+
+    // Each line is "<torrent ID> <seeds> <leechers> <downloaded> <update time>"
+    while (true)
+    {
+        const QByteArray line = statsFile.readLine(lineMaxLength).trimmed();
+        if (line.isEmpty())
+            break;
+
+        const QList<QByteArray> fields = line.split(' ');
+        if (fields.size() != 5)
+            continue;
+
+        const auto torrentID = TorrentID::fromString(QString::fromLatin1(fields[0]));
+        const qint64 updateTime = fields[4].toLongLong();
+        if (!torrentID.isValid() || (updateTime <= 0))
+            continue;
+
+        m_swarmStats.insert(torrentID, {
+            .seedsCount = fields[1].toInt(),
+            .leechersCount = fields[2].toInt(),
+            .downloadedCount = fields[3].toInt(),
+            .updateTime = QDateTime::fromSecsSinceEpoch(updateTime, QTimeZone::UTC)
+        });
+    }
+
+    return m_swarmStats;
+}
+
+void BitTorrent::BencodeResumeDataStorage::storeSwarmStats(const QHash<TorrentID, SwarmStats> &changedStats) const
+{
+    if (changedStats.isEmpty())
+        return;
+
+    m_swarmStats.insert(changedStats);
+
+    QMetaObject::invokeMethod(m_asyncWorker, [this, stats = m_swarmStats]()
+    {
+        m_asyncWorker->storeSwarmStats(stats);
+    });
+}
+
 BitTorrent::BencodeResumeDataStorage::Worker::Worker(const Path &resumeDataDir)
     : m_resumeDataDir {resumeDataDir}
 {
@@ -490,3 +553,26 @@ void BitTorrent::BencodeResumeDataStorage::Worker::storeQueue(const QList<Torren
             .arg(filepath.toString(), result.error()), Log::CRITICAL);
     }
 }
+
+void BitTorrent::BencodeResumeDataStorage::Worker::storeSwarmStats(const QHash<TorrentID, SwarmStats> &stats) const
+{
+    QByteArray data;
+    data.reserve(80 * stats.size());
+    for (auto it = stats.cbegin(); it != stats.cend(); ++it)
+    {
+        const SwarmStats &torrentStats = it.value();
+        data += it.key().toString().toLatin1() + ' '
+                + QByteArray::number(torrentStats.seedsCount) + ' '
+                + QByteArray::number(torrentStats.leechersCount) + ' '
+                + QByteArray::number(torrentStats.downloadedCount) + ' '
+                + QByteArray::number(torrentStats.updateTime.toSecsSinceEpoch()) + '\n';
+    }
+
+    const Path filepath = m_resumeDataDir / Path(SWARM_STATS_FILENAME);
+    const nonstd::expected<void, QString> result = Utils::IO::saveToFile(filepath, data);
+    if (!result)
+    {
+        LogMsg(tr("Couldn't save data to '%1'. Error: %2")
+            .arg(filepath.toString(), result.error()), Log::CRITICAL);
+    }
+}
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <QDir>
+#include <QHash>
 #include <QList>
 
 #include "base/pathfwd.h"
@@ -53,6 +54,8 @@ namespace BitTorrent
         void store(const TorrentID &id, LoadTorrentParams resumeData) const override;
         void remove(const TorrentID &id) const override;
         void storeQueue(const QList<TorrentID> &queue) const override;
+        QHash<TorrentID, SwarmStats> loadSwarmStats() const override;
+        void storeSwarmStats(const QHash<TorrentID, SwarmStats> &changedStats) const override;
 
     private:
         void doLoadAll() const override;
@@ -60,6 +63,8 @@ namespace BitTorrent
         LoadResumeDataResult loadTorrentResumeData(const QByteArray &data, const QByteArray &metadata) const;
 
         QList<TorrentID> m_registeredTorrents;
+        // Swarm stats are small enough to be always written in full
+        mutable QHash<TorrentID, SwarmStats> m_swarmStats;
         Utils::Thread::UniquePtr m_ioThread;
 
         class Worker;
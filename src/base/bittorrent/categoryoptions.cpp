@@ -28,6 +28,8 @@
 
 #include "categoryoptions.h"
 
+#include <algorithm>
+
 #include <QJsonObject>
 #include <QJsonValue>
 
@@ -35,6 +37,8 @@
 
 const QString OPTION_SAVEPATH = u"save_path"_s;
 const QString OPTION_DOWNLOADPATH = u"download_path"_s;
+const QString OPTION_DOWNLOADLIMIT = u"download_limit"_s;
+const QString OPTION_UPLOADLIMIT = u"upload_limit"_s;
 
 BitTorrent::CategoryOptions BitTorrent::CategoryOptions::fromJSON(const QJsonObject &jsonObj)
 {
@@ -47,6 +51,9 @@ BitTorrent::CategoryOptions BitTorrent::CategoryOptions::fromJSON(const QJsonObj
     else if (downloadPathValue.isString())
         options.downloadPath = {true, Path(downloadPathValue.toString())};
 
+    options.downloadLimit = std::max(0, jsonObj.value(OPTION_DOWNLOADLIMIT).toInt());
+    options.uploadLimit = std::max(0, jsonObj.value(OPTION_UPLOADLIMIT).toInt());
+
     return options;
 }
 
@@ -63,12 +70,16 @@ QJsonObject BitTorrent::CategoryOptions::toJSON() const
 
     return {
         {OPTION_SAVEPATH, savePath.data()},
-        {OPTION_DOWNLOADPATH, downloadPathValue}
+        {OPTION_DOWNLOADPATH, downloadPathValue},
+        {OPTION_DOWNLOADLIMIT, downloadLimit},
+        {OPTION_UPLOADLIMIT, uploadLimit}
     };
 }
 
 bool BitTorrent::operator==(const BitTorrent::CategoryOptions &left, const BitTorrent::CategoryOptions &right)
 {
     return ((left.savePath == right.savePath)
-            && (left.downloadPath == right.downloadPath));
+            && (left.downloadPath == right.downloadPath)
+            && (left.downloadLimit == right.downloadLimit)
+            && (left.uploadLimit == right.uploadLimit));
 }
@@ -43,6 +43,9 @@ namespace BitTorrent
     {
         Path savePath;
         std::optional<DownloadPathOption> downloadPath;
+        // Speed limits shared by all the torrents of the category (including subcategories)
+        int downloadLimit = 0;
+        int uploadLimit = 0;
 
         static CategoryOptions fromJSON(const QJsonObject &jsonObj);
         QJsonObject toJSON() const;
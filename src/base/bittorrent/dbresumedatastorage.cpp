@@ -40,7 +40,9 @@
 #include <libtorrent/write_resume_data.hpp>
 
 #include <QByteArray>
+#include <QDateTime>
 #include <QDebug>
+#include <QHash>
 #include <QList>
 #include <QMutex>
 #include <QSet>
@@ -49,6 +51,7 @@
 #include <QSqlQuery>
 #include <QSqlRecord>
 #include <QThread>
+#include <QTimeZone>
 #include <QWaitCondition>
 
 #include "base/exceptions.h"
@@ -62,15 +65,17 @@
 #include "base/utils/string.h"
 #include "infohash.h"
 #include "loadtorrentparams.h"
+#include "queuepositions.h"
 
 namespace
 {
     const QString DB_CONNECTION_NAME = u"ResumeDataStorage"_s;
 
-    const int DB_VERSION = 9;
+    const int DB_VERSION = 10;
 
     const QString DB_TABLE_META = u"meta"_s;
     const QString DB_TABLE_TORRENTS = u"torrents"_s;
+    const QString DB_TABLE_SWARM_STATS = u"swarm_stats"_s;
 
     const QString META_VERSION = u"version"_s;
 
@@ -86,12 +91,13 @@ namespace
     class StoreJob final : public Job
     {
     public:
-        StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData);
+        StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData, qint64 queuePosition);
         void perform(QSqlDatabase db) override;
 
     private:
         const TorrentID m_torrentID;
         const LoadTorrentParams m_resumeData;
+        const qint64 m_queuePosition;
     };
 
     class RemoveJob final : public Job
@@ -107,11 +113,21 @@ namespace
     class StoreQueueJob final : public Job
     {
     public:
-        explicit StoreQueueJob(const QList<TorrentID> &queue);
+        explicit StoreQueueJob(const QueuePositions &positions);
         void perform(QSqlDatabase db) override;
 
     private:
-        const QList<TorrentID> m_queue;
+        const QueuePositions m_positions;
+    };
+
+    class StoreSwarmStatsJob final : public Job
+    {
+    public:
+        explicit StoreSwarmStatsJob(const QHash<TorrentID, SwarmStats> &stats);
+        void perform(QSqlDatabase db) override;
+
+    private:
+        const QHash<TorrentID, SwarmStats> m_stats;
     };
 
     struct Column
@@ -150,6 +166,10 @@ namespace
     const Column DB_COLUMN_RESUMEDATA = makeColumn(u"libtorrent_resume_data"_s);
     const Column DB_COLUMN_METADATA = makeColumn(u"metadata"_s);
     const Column DB_COLUMN_VALUE = makeColumn(u"value"_s);
+    const Column DB_COLUMN_SEEDS = makeColumn(u"seeds"_s);
+    const Column DB_COLUMN_LEECHERS = makeColumn(u"leechers"_s);
+    const Column DB_COLUMN_DOWNLOADED = makeColumn(u"downloaded"_s);
+    const Column DB_COLUMN_UPDATE_TIME = makeColumn(u"update_time"_s);
 
     template <typename LTStr>
     QString fromLTString(const LTStr &str)
@@ -218,6 +238,21 @@ namespace
     {
         return u"%1 %2"_s.arg(quoted(column.name), definition);
     }
+
+    void createSwarmStatsTable(QSqlQuery &query)
+    {
+        const QStringList tableSwarmStatsItems = {
+            makeColumnDefinition(DB_COLUMN_TORRENT_ID, u"BLOB PRIMARY KEY"_s),
+            makeColumnDefinition(DB_COLUMN_SEEDS, u"INTEGER NOT NULL"_s),
+            makeColumnDefinition(DB_COLUMN_LEECHERS, u"INTEGER NOT NULL"_s),
+            makeColumnDefinition(DB_COLUMN_DOWNLOADED, u"INTEGER NOT NULL"_s),
+            makeColumnDefinition(DB_COLUMN_UPDATE_TIME, u"INTEGER NOT NULL"_s)
+        };
+        const QString createTableSwarmStatsQuery = u"CREATE TABLE IF NOT EXISTS %1 (%2);"_s
+                .arg(quoted(DB_TABLE_SWARM_STATS), tableSwarmStatsItems.join(u','));
+        if (!query.exec(createTableSwarmStatsQuery))
+            throw RuntimeError(query.lastError().text());
+    }
 }
 
 namespace BitTorrent
@@ -232,9 +267,10 @@ namespace BitTorrent
         void run() override;
         void requestInterruption();
 
-        void store(const TorrentID &id, LoadTorrentParams resumeData);
+        void store(const TorrentID &id, LoadTorrentParams resumeData, qint64 queuePosition);
         void remove(const TorrentID &id);
-        void storeQueue(const QList<TorrentID> &queue);
+        void storeQueue(const QueuePositions &positions);
+        void storeSwarmStats(const QHash<TorrentID, SwarmStats> &stats);
 
     private:
         void addJob(std::unique_ptr<Job> job);
@@ -270,6 +306,8 @@ BitTorrent::DBResumeDataStorage::DBResumeDataStorage(const Path &dbPath, QObject
             updateDB(dbVersion);
     }
 
+    loadQueuePositions();
+
     m_asyncWorker = new Worker(dbPath, m_dbLock, this);
     m_asyncWorker->start();
 }
@@ -330,17 +368,62 @@ BitTorrent::LoadResumeDataResult BitTorrent::DBResumeDataStorage::load(const Tor
 
 void BitTorrent::DBResumeDataStorage::store(const TorrentID &id, LoadTorrentParams resumeData) const
 {
-    m_asyncWorker->store(id, std::move(resumeData));
+    // The position is stored along with the resume data since the row of a new torrent
+    // doesn't exist yet when its position is assigned by storeQueue()
+    m_asyncWorker->store(id, std::move(resumeData), m_queuePositions.value(id, -1));
 }
 
 void BitTorrent::DBResumeDataStorage::remove(const BitTorrent::TorrentID &id) const
 {
+    m_queuePositions.remove(id);
     m_asyncWorker->remove(id);
 }
 
 void BitTorrent::DBResumeDataStorage::storeQueue(const QList<TorrentID> &queue) const
 {
-    m_asyncWorker->storeQueue(queue);
+    QList<TorrentID> queuedTorrents = queue;
+    queuedTorrents.removeIf([](const TorrentID &torrentID) { return !torrentID.isValid(); });
+
+    const QueuePositions changedPositions = updateQueuePositions(m_queuePositions, queuedTorrents);
+    if (!changedPositions.isEmpty())
+        m_asyncWorker->storeQueue(changedPositions);
+}
+
+QHash<BitTorrent::TorrentID, BitTorrent::SwarmStats> BitTorrent::DBResumeDataStorage::loadSwarmStats() const
+{
+    const auto selectSwarmStatsStatement = u"SELECT %1, %2, %3, %4, %5 FROM %6;"_s
+            .arg(quoted(DB_COLUMN_TORRENT_ID.name), quoted(DB_COLUMN_SEEDS.name), quoted(DB_COLUMN_LEECHERS.name)
+                    , quoted(DB_COLUMN_DOWNLOADED.name), quoted(DB_COLUMN_UPDATE_TIME.name), quoted(DB_TABLE_SWARM_STATS));
+
+    auto db = QSqlDatabase::database(DB_CONNECTION_NAME);
+    QSqlQuery query {db};
+
+    const QReadLocker locker {&m_dbLock};
+
+    if (!query.exec(selectSwarmStatsStatement))
+    {
+        LogMsg(tr("Couldn't load swarm statistics. Error: %1").arg(query.lastError().text()), Log::WARNING);
+        return {};
+    }
+
+    QHash<TorrentID, SwarmStats> stats;
+    while (query.next())
+    {
+        stats.insert(TorrentID::fromString(query.value(0).toString()), {
+            .seedsCount = query.value(1).toInt(),
+            .leechersCount = query.value(2).toInt(),
+            .downloadedCount = query.value(3).toInt(),
+            .updateTime = QDateTime::fromSecsSinceEpoch(query.value(4).toLongLong(), QTimeZone::UTC)
+        });
+    }
+
+    return stats;
+}
+
+void BitTorrent::DBResumeDataStorage::storeSwarmStats(const QHash<TorrentID, SwarmStats> &changedStats) const
+{
+    if (!changedStats.isEmpty())
+        m_asyncWorker->storeSwarmStats(changedStats);
 }
 
 void BitTorrent::DBResumeDataStorage::doLoadAll() const
@@ -491,6 +574,8 @@ void BitTorrent::DBResumeDataStorage::createDB() const
         if (!query.exec(createTorrentsQueuePositionIndexQuery))
             throw RuntimeError(query.lastError().text());
 
+        createSwarmStatsTable(query);
+
         if (!db.commit())
             throw RuntimeError(db.lastError().text());
     }
@@ -583,6 +668,9 @@ void BitTorrent::DBResumeDataStorage::updateDB(const int fromVersion) const
         if (fromVersion <= 8)
             addColumn(DB_TABLE_TORRENTS, DB_COLUMN_COMMENT, u"TEXT"_s);
 
+        if (fromVersion <= 9)
+            createSwarmStatsTable(query);
+
         const QString updateMetaVersionQuery = makeUpdateStatement(DB_TABLE_META, {DB_COLUMN_NAME, DB_COLUMN_VALUE});
         if (!query.prepare(updateMetaVersionQuery))
             throw RuntimeError(query.lastError().text());
@@ -619,6 +707,21 @@ void BitTorrent::DBResumeDataStorage::enableWALMode() const
         throw RuntimeError(tr("WAL mode is probably unsupported due to filesystem limitations."));
 }
 
+void BitTorrent::DBResumeDataStorage::loadQueuePositions()
+{
+    const auto selectQueuePositionsStatement = u"SELECT %1, %2 FROM %3 WHERE %2 >= 0;"_s
+            .arg(quoted(DB_COLUMN_TORRENT_ID.name), quoted(DB_COLUMN_QUEUE_POSITION.name), quoted(DB_TABLE_TORRENTS));
+
+    auto db = QSqlDatabase::database(DB_CONNECTION_NAME);
+    QSqlQuery query {db};
+
+    if (!query.exec(selectQueuePositionsStatement))
+        throw RuntimeError(query.lastError().text());
+
+    while (query.next())
+        m_queuePositions.insert(TorrentID::fromString(query.value(0).toString()), query.value(1).toLongLong());
+}
+
 LoadResumeDataResult DBResumeDataStorage::parseQueryResultRow(const QSqlQuery &query) const
 {
     LoadTorrentParams resumeData;
@@ -775,9 +878,9 @@ void DBResumeDataStorage::Worker::requestInterruption()
     m_waitCondition.wakeAll();
 }
 
-void BitTorrent::DBResumeDataStorage::Worker::store(const TorrentID &id, LoadTorrentParams resumeData)
+void BitTorrent::DBResumeDataStorage::Worker::store(const TorrentID &id, LoadTorrentParams resumeData, const qint64 queuePosition)
 {
-    addJob(std::make_unique<StoreJob>(id, std::move(resumeData)));
+    addJob(std::make_unique<StoreJob>(id, std::move(resumeData), queuePosition));
 }
 
 void BitTorrent::DBResumeDataStorage::Worker::remove(const TorrentID &id)
@@ -785,9 +888,14 @@ void BitTorrent::DBResumeDataStorage::Worker::remove(const TorrentID &id)
     addJob(std::make_unique<RemoveJob>(id));
 }
 
-void BitTorrent::DBResumeDataStorage::Worker::storeQueue(const QList<TorrentID> &queue)
+void BitTorrent::DBResumeDataStorage::Worker::storeQueue(const QueuePositions &positions)
 {
-    addJob(std::make_unique<StoreQueueJob>(queue));
+    addJob(std::make_unique<StoreQueueJob>(positions));
+}
+
+void BitTorrent::DBResumeDataStorage::Worker::storeSwarmStats(const QHash<TorrentID, SwarmStats> &stats)
+{
+    addJob(std::make_unique<StoreSwarmStatsJob>(stats));
 }
 
 void BitTorrent::DBResumeDataStorage::Worker::addJob(std::unique_ptr<Job> job)
@@ -803,9 +911,10 @@ namespace
 {
     using namespace BitTorrent;
 
-StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
+StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData, const qint64 queuePosition)
         : m_torrentID {torrentID}
         , m_resumeData {std::move(resumeData)}
+        , m_queuePosition {queuePosition}
     {
     }
 
@@ -856,7 +965,8 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
             DB_COLUMN_SSL_CERTIFICATE,
             DB_COLUMN_SSL_PRIVATE_KEY,
             DB_COLUMN_SSL_DH_PARAMS,
-            DB_COLUMN_RESUMEDATA
+            DB_COLUMN_RESUMEDATA,
+            DB_COLUMN_QUEUE_POSITION
         };
 
         lt::entry data = lt::write_resume_data(p);
@@ -928,6 +1038,7 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
             }
 
             query.bindValue(DB_COLUMN_RESUMEDATA.placeholder, bencodedResumeData);
+            query.bindValue(DB_COLUMN_QUEUE_POSITION.placeholder, m_queuePosition);
             if (!bencodedMetadata.isEmpty())
                 query.bindValue(DB_COLUMN_METADATA.placeholder, bencodedMetadata);
 
@@ -950,17 +1061,22 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
     {
         const auto deleteTorrentStatement = u"DELETE FROM %1 WHERE %2 = %3;"_s
                 .arg(quoted(DB_TABLE_TORRENTS), quoted(DB_COLUMN_TORRENT_ID.name), DB_COLUMN_TORRENT_ID.placeholder);
+        const auto deleteSwarmStatsStatement = u"DELETE FROM %1 WHERE %2 = %3;"_s
+                .arg(quoted(DB_TABLE_SWARM_STATS), quoted(DB_COLUMN_TORRENT_ID.name), DB_COLUMN_TORRENT_ID.placeholder);
 
         QSqlQuery query {db};
         try
         {
-            if (!query.prepare(deleteTorrentStatement))
-                throw RuntimeError(query.lastError().text());
+            for (const QString &statement : {deleteTorrentStatement, deleteSwarmStatsStatement})
+            {
+                if (!query.prepare(statement))
+                    throw RuntimeError(query.lastError().text());
 
-            query.bindValue(DB_COLUMN_TORRENT_ID.placeholder, m_torrentID.toString());
+                query.bindValue(DB_COLUMN_TORRENT_ID.placeholder, m_torrentID.toString());
 
-            if (!query.exec())
-                throw RuntimeError(query.lastError().text());
+                if (!query.exec())
+                    throw RuntimeError(query.lastError().text());
+            }
         }
         catch (const RuntimeError &err)
         {
@@ -969,8 +1085,8 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
         }
     }
 
-    StoreQueueJob::StoreQueueJob(const QList<TorrentID> &queue)
-        : m_queue {queue}
+    StoreQueueJob::StoreQueueJob(const QueuePositions &positions)
+        : m_positions {positions}
     {
     }
 
@@ -987,11 +1103,10 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
             if (!query.prepare(updateQueuePosStatement))
                 throw RuntimeError(query.lastError().text());
 
-            int pos = 0;
-            for (const TorrentID &torrentID : m_queue)
+            for (const auto &[torrentID, position] : m_positions)
             {
                 query.bindValue(DB_COLUMN_TORRENT_ID.placeholder, torrentID.toString());
-                query.bindValue(DB_COLUMN_QUEUE_POSITION.placeholder, pos++);
+                query.bindValue(DB_COLUMN_QUEUE_POSITION.placeholder, position);
                 if (!query.exec())
                     throw RuntimeError(query.lastError().text());
             }
@@ -1002,4 +1117,41 @@ StoreJob::StoreJob(const TorrentID &torrentID, LoadTorrentParams resumeData)
                     .arg(err.message()), Log::CRITICAL);
         }
     }
+
+    StoreSwarmStatsJob::StoreSwarmStatsJob(const QHash<TorrentID, SwarmStats> &stats)
+        : m_stats {stats}
+    {
+    }
+
+    void StoreSwarmStatsJob::perform(QSqlDatabase db)
+    {
+        const QList<Column> columns {DB_COLUMN_TORRENT_ID, DB_COLUMN_SEEDS, DB_COLUMN_LEECHERS, DB_COLUMN_DOWNLOADED, DB_COLUMN_UPDATE_TIME};
+        const QString insertSwarmStatsStatement = makeInsertStatement(DB_TABLE_SWARM_STATS, columns)
+                + makeOnConflictUpdateStatement(DB_COLUMN_TORRENT_ID, columns);
+
+        try
+        {
+            QSqlQuery query {db};
+
+            if (!query.prepare(insertSwarmStatsStatement))
+                throw RuntimeError(query.lastError().text());
+
+            for (auto it = m_stats.cbegin(); it != m_stats.cend(); ++it)
+            {
+                const SwarmStats &stats = it.value();
+                query.bindValue(DB_COLUMN_TORRENT_ID.placeholder, it.key().toString());
+                query.bindValue(DB_COLUMN_SEEDS.placeholder, stats.seedsCount);
+                query.bindValue(DB_COLUMN_LEECHERS.placeholder, stats.leechersCount);
+                query.bindValue(DB_COLUMN_DOWNLOADED.placeholder, stats.downloadedCount);
+                query.bindValue(DB_COLUMN_UPDATE_TIME.placeholder, stats.updateTime.toSecsSinceEpoch());
+                if (!query.exec())
+                    throw RuntimeError(query.lastError().text());
+            }
+        }
+        catch (const RuntimeError &err)
+        {
+            LogMsg(ResumeDataStorage::tr("Couldn't store swarm statistics. Error: %1")
+                    .arg(err.message()), Log::CRITICAL);
+        }
+    }
 }
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <QHash>
 #include <QReadWriteLock>
 
 #include "base/pathfwd.h"
@@ -52,6 +53,8 @@ namespace BitTorrent
         void store(const TorrentID &id, LoadTorrentParams resumeData) const override;
         void remove(const TorrentID &id) const override;
         void storeQueue(const QList<TorrentID> &queue) const override;
+        QHash<TorrentID, SwarmStats> loadSwarmStats() const override;
+        void storeSwarmStats(const QHash<TorrentID, SwarmStats> &changedStats) const override;
 
     private:
         void doLoadAll() const override;
@@ -59,11 +62,14 @@ namespace BitTorrent
         void createDB() const;
         void updateDB(int fromVersion) const;
         void enableWALMode() const;
+        void loadQueuePositions();
         LoadResumeDataResult parseQueryResultRow(const QSqlQuery &query) const;
 
         class Worker;
         Worker *m_asyncWorker = nullptr;
 
         mutable QReadWriteLock m_dbLock;
+        // Sparse queue position keys as they are currently stored in the database
+        mutable QHash<TorrentID, qint64> m_queuePositions;
     };
 }
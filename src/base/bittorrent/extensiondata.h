@@ -47,4 +47,6 @@ struct ExtensionData
     lt::torrent_status status;
     std::vector<lt::announce_entry> trackers;
     std::set<std::string> urlSeeds;
+    // Session slot of the torrent, allows resolving handles without ID lookup
+    int slotIndex = -1;
 };
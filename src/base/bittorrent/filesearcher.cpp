@@ -28,25 +28,101 @@
 
 #include "filesearcher.h"
 
+#include <memory>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QHash>
 #include <QPromise>
+#include <QSet>
+#include <QThreadPool>
 
 #include "base/bittorrent/common.h"
+#include "base/logger.h"
+
+using namespace std::chrono_literals;
 
 namespace
 {
+    // Checking a few files with separate `stat()` calls is cheaper than listing
+    // a directory that can contain lots of unrelated entries (e.g. the default save path)
+    const qsizetype MIN_FILES_TO_LIST_DIR = 8;
+    const std::chrono::milliseconds SLOW_SEARCH_THRESHOLD = 1s;
+
+    // Names which can refer to the same file on case-insensitive or normalization-insensitive
+    // file systems (e.g. the default ones of Windows and macOS) share the same key
+    QString entryKey(const QString &fileName)
+    {
+        return fileName.normalized(QString::NormalizationForm_C).toCaseFolded();
+    }
+
+    class DirectoryListingCache
+    {
+    public:
+        bool exists(const Path &dirPath, const QString &fileName)
+        {
+            auto iter = m_entries.find(dirPath);
+            if (iter == m_entries.end())
+            {
+                const QStringList entryList = QDir(dirPath.data()).entryList((QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot), QDir::Unsorted);
+
+                Entries entries;
+                entries.names = {entryList.cbegin(), entryList.cend()};
+                entries.keys.reserve(entryList.size());
+                for (const QString &entry : entryList)
+                    entries.keys.insert(entryKey(entry));
+
+                iter = m_entries.insert(dirPath, entries);
+            }
+
+            if (iter->names.contains(fileName))
+                return true;
+
+            // Whether the name matches an entry that differs in case or normalization
+            // depends on the file system, so it is left to the file system to decide
+            if (iter->keys.contains(entryKey(fileName)))
+                return (dirPath / Path(fileName)).exists();
+
+            return false;
+        }
+
+    private:
+        struct Entries
+        {
+            QSet<QString> names;
+            QSet<QString> keys;
+        };
+
+        QHash<Path, Entries> m_entries;
+    };
+
     bool findInDir(const Path &dirPath, PathList &fileNames, const bool forceAppendExt)
     {
+        QHash<Path, qsizetype> filesCountByDir;
+        for (const Path &fileName : fileNames)
+            ++filesCountByDir[(dirPath / fileName).parentPath()];
+
+        DirectoryListingCache listingCache;
+        const auto exists = [&listingCache, &filesCountByDir](const Path &filePath) -> bool
+        {
+            const Path parentPath = filePath.parentPath();
+            if (filesCountByDir.value(parentPath) < MIN_FILES_TO_LIST_DIR)
+                return filePath.exists();
+
+            return listingCache.exists(parentPath, filePath.filename());
+        };
+
         bool found = false;
         for (Path &fileName : fileNames)
         {
-            if ((dirPath / fileName).exists())
+            if (exists(dirPath / fileName))
             {
                 found = true;
             }
             else
             {
                 const Path incompleteFilename = fileName + QB_EXT;
-                if ((dirPath / incompleteFilename).exists())
+                if (exists(dirPath / incompleteFilename))
                 {
                     found = true;
                     fileName = incompleteFilename;
@@ -62,17 +138,40 @@ namespace
     }
 }
 
+FileSearcher::FileSearcher(QObject *parent)
+    : QObject(parent)
+    , m_threadPool {new QThreadPool(this)}
+{
+    m_threadPool->setObjectName("FileSearcher m_threadPool");
+}
+
 void FileSearcher::search(const PathList &originalFileNames, const Path &savePath
-        , const Path &downloadPath, const bool forceAppendExt, QPromise<FileSearchResult> &promise)
+        , const Path &downloadPath, const bool forceAppendExt, QPromise<FileSearchResult> promise)
 {
-    Path usedPath = savePath;
-    PathList adjustedFileNames = originalFileNames;
-    const bool found = findInDir(usedPath, adjustedFileNames, (forceAppendExt && downloadPath.isEmpty()));
-    if (!found && !downloadPath.isEmpty())
+    // `QThreadPool::start()` requires copyable callable
+    auto sharedPromise = std::make_shared<QPromise<FileSearchResult>>(std::move(promise));
+    m_threadPool->start([originalFileNames, savePath, downloadPath, forceAppendExt, sharedPromise]
     {
-        usedPath = downloadPath;
-        findInDir(usedPath, adjustedFileNames, forceAppendExt);
-    }
+        QElapsedTimer elapsedTimer;
+        elapsedTimer.start();
+
+        Path usedPath = savePath;
+        PathList adjustedFileNames = originalFileNames;
+        const bool found = findInDir(usedPath, adjustedFileNames, (forceAppendExt && downloadPath.isEmpty()));
+        if (!found && !downloadPath.isEmpty())
+        {
+            usedPath = downloadPath;
+            findInDir(usedPath, adjustedFileNames, forceAppendExt);
+        }
+
+        const std::chrono::milliseconds elapsed {elapsedTimer.elapsed()};
+        if (elapsed >= SLOW_SEARCH_THRESHOLD)
+        {
+            LogMsg(tr("Searching for existing files took too long. Save path: \"%1\". Files: %2. Elapsed: %3 ms")
+                    .arg(savePath.toString(), QString::number(originalFileNames.size()), QString::number(elapsed.count())), Log::WARNING);
+        }
 
-    promise.addResult(FileSearchResult {.savePath = usedPath, .fileNames = adjustedFileNames});
+        sharedPromise->addResult(FileSearchResult {.savePath = usedPath, .fileNames = adjustedFileNames, .elapsed = elapsed});
+        sharedPromise->finish();
+    });
 }
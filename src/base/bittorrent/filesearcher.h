@@ -28,16 +28,21 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <QObject>
 
 #include "base/path.h"
 
 template <typename T> class QPromise;
 
+class QThreadPool;
+
 struct FileSearchResult
 {
     Path savePath;
     PathList fileNames;
+    std::chrono::milliseconds elapsed {};
 };
 
 class FileSearcher final : public QObject
@@ -46,8 +51,12 @@ class FileSearcher final : public QObject
     Q_DISABLE_COPY_MOVE(FileSearcher)
 
 public:
-    using QObject::QObject;
+    explicit FileSearcher(QObject *parent = nullptr);
 
+    // Searches are performed concurrently, the promise is finished once the result is available
     void search(const PathList &originalFileNames, const Path &savePath
-            , const Path &downloadPath, bool forceAppendExt, QPromise<FileSearchResult> &promise);
+            , const Path &downloadPath, bool forceAppendExt, QPromise<FileSearchResult> promise);
+
+private:
+    QThreadPool *m_threadPool = nullptr;
 };
@@ -0,0 +1,126 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "queuepositions.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+BitTorrent::QueuePositions BitTorrent::updateQueuePositions(QHash<TorrentID, qint64> &positions, const QList<TorrentID> &queue)
+{
+    const qsizetype count = queue.size();
+    QList<qint64> keys;
+    keys.reserve(count);
+    for (const TorrentID &torrentID : queue)
+        keys.append(positions.value(torrentID, -1));
+
+    // Find the longest strictly increasing subsequence of the existing keys
+    QList<qsizetype> tails;
+    QList<qsizetype> predecessors(count, -1);
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        if (keys[i] < 0)
+            continue;
+
+        const auto iter = std::lower_bound(tails.cbegin(), tails.cend(), keys[i]
+                , [&keys](const qsizetype index, const qint64 key) { return keys[index] < key; });
+        if (iter != tails.cbegin())
+            predecessors[i] = *std::prev(iter);
+        if (iter == tails.cend())
+            tails.append(i);
+        else
+            tails[iter - tails.cbegin()] = i;
+    }
+
+    QList<bool> kept(count, false);
+    for (qsizetype i = (tails.isEmpty() ? -1 : tails.last()); i >= 0; i = predecessors[i])
+        kept[i] = true;
+
+    // Assign new keys to the runs of moved (or new) torrents between the kept ones
+    QList<qint64> newKeys = keys;
+    bool renumber = false;
+    for (qsizetype i = 0; (i < count) && !renumber; ++i)
+    {
+        if (kept[i])
+            continue;
+
+        qsizetype runEnd = i;
+        while ((runEnd < count) && !kept[runEnd])
+            ++runEnd;
+
+        const qint64 runSize = runEnd - i;
+        const qint64 lowerKey = (i > 0) ? newKeys[i - 1] : 0;
+        if (runEnd == count)
+        {
+            const qint64 firstKey = (i > 0) ? (lowerKey + QUEUE_POSITION_STEP) : QUEUE_POSITION_BASE;
+            for (qint64 j = 0; j < runSize; ++j)
+                newKeys[i + j] = firstKey + (j * QUEUE_POSITION_STEP);
+        }
+        else
+        {
+            const qint64 upperKey = newKeys[runEnd];
+            if ((i == 0) && ((upperKey - (runSize * QUEUE_POSITION_STEP)) > 0))
+            {
+                for (qint64 j = 0; j < runSize; ++j)
+                    newKeys[i + j] = upperKey - ((runSize - j) * QUEUE_POSITION_STEP);
+            }
+            else if ((upperKey - lowerKey) > runSize)
+            {
+                const qint64 step = (upperKey - lowerKey) / (runSize + 1);
+                for (qint64 j = 0; j < runSize; ++j)
+                    newKeys[i + j] = lowerKey + ((j + 1) * step);
+            }
+            else
+            {
+                renumber = true;
+            }
+        }
+
+        i = runEnd - 1;
+    }
+
+    if (renumber)
+    {
+        for (qsizetype i = 0; i < count; ++i)
+            newKeys[i] = QUEUE_POSITION_BASE + (i * QUEUE_POSITION_STEP);
+    }
+
+    QueuePositions changedPositions;
+    QHash<TorrentID, qint64> updatedPositions;
+    updatedPositions.reserve(count);
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        if (newKeys[i] != keys[i])
+            changedPositions.append({queue[i], newKeys[i]});
+        updatedPositions.insert(queue[i], newKeys[i]);
+    }
+
+    positions = std::move(updatedPositions);
+    return changedPositions;
+}
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <QtContainerFwd>
+#include <QHash>
 #include <QList>
 #include <QMutex>
 #include <QObject>
@@ -37,6 +38,7 @@
 #include "base/path.h"
 #include "infohash.h"
 #include "loadtorrentparams.h"
+#include "swarmstats.h"
 
 namespace BitTorrent
 {
@@ -63,6 +65,8 @@ namespace BitTorrent
         virtual void store(const TorrentID &id, LoadTorrentParams resumeData) const = 0;
         virtual void remove(const TorrentID &id) const = 0;
         virtual void storeQueue(const QList<TorrentID> &queue) const = 0;
+        virtual QHash<TorrentID, SwarmStats> loadSwarmStats() const = 0;
+        virtual void storeSwarmStats(const QHash<TorrentID, SwarmStats> &changedStats) const = 0;
 
         void loadAll() const;
         QList<LoadedResumeData> fetchLoadedResumeData() const;
@@ -0,0 +1,130 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "seedingoptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std::chrono_literals;
+using namespace BitTorrent;
+
+namespace
+{
+    // Active torrent isn't rotated out until it gets a chance to connect to the swarm
+    const std::chrono::seconds MIN_ACTIVE_TIME = 30min;
+    // Active torrent is replaced only by the one that is noticeably better to avoid flapping
+    const qreal ACTIVE_SCORE_BONUS = 1.25;
+    const qreal UPLOAD_RATE_SMOOTHING = 0.3;
+    const qreal UPLOAD_RATE_UNIT = 10 * 1024;
+    const qreal RATIO_REACHED_WEIGHT = 0.1;
+}
+
+qreal SeedingOptimizer::score(const SeedingCandidate &candidate, const qreal averageUploadRate)
+{
+    const qreal demand = std::max(0, candidate.leechersCount) / (std::max(0, candidate.seedsCount) + 1.0);
+    // logarithmic so that a single fast torrent doesn't outweigh the demand of the others
+    const qreal history = std::log1p(averageUploadRate / UPLOAD_RATE_UNIT);
+
+    // torrents far from their ratio target are preferred, ones that reached it are the last resort
+    qreal ratioWeight = 1;
+    if (candidate.ratioLimit >= 0)
+    {
+        ratioWeight = (candidate.ratio >= candidate.ratioLimit)
+                ? RATIO_REACHED_WEIGHT
+                : (2 - (candidate.ratio / candidate.ratioLimit));
+    }
+
+    return (demand + history) * ratioWeight;
+}
+
+SeedingPlan SeedingOptimizer::plan(const QList<SeedingCandidate> &candidates, const int slotsCount, const std::chrono::seconds now)
+{
+    struct RankedCandidate
+    {
+        const SeedingCandidate *candidate = nullptr;
+        qreal score = 0;
+        bool isLocked = false;
+    };
+
+    QHash<TorrentID, History> history;
+    history.reserve(candidates.size());
+    QList<RankedCandidate> rankedCandidates;
+    rankedCandidates.reserve(candidates.size());
+    for (const SeedingCandidate &candidate : candidates)
+    {
+        History torrentHistory = m_history.value(candidate.id);
+        if (candidate.isActive)
+        {
+            torrentHistory.averageUploadRate += UPLOAD_RATE_SMOOTHING * (candidate.uploadRate - torrentHistory.averageUploadRate);
+            if (torrentHistory.activeSince < 0s)
+                torrentHistory.activeSince = now;
+        }
+        else
+        {
+            torrentHistory.activeSince = -1s;
+        }
+        history.insert(candidate.id, torrentHistory);
+
+        RankedCandidate rankedCandidate {.candidate = &candidate, .score = score(candidate, torrentHistory.averageUploadRate)};
+        if (candidate.isActive)
+        {
+            rankedCandidate.score *= ACTIVE_SCORE_BONUS;
+            rankedCandidate.isLocked = ((now - torrentHistory.activeSince) < MIN_ACTIVE_TIME);
+        }
+        rankedCandidates.append(rankedCandidate);
+    }
+    // forget the torrents that are no longer seeding
+    m_history = std::move(history);
+
+    std::stable_sort(rankedCandidates.begin(), rankedCandidates.end()
+            , [](const RankedCandidate &left, const RankedCandidate &right)
+    {
+        if (left.isLocked != right.isLocked)
+            return left.isLocked;
+        return (left.score > right.score);
+    });
+
+    SeedingPlan seedingPlan;
+    for (qsizetype i = 0; i < rankedCandidates.size(); ++i)
+    {
+        const SeedingCandidate *candidate = rankedCandidates[i].candidate;
+        const bool shouldBeActive = (i < slotsCount);
+        if (shouldBeActive && !candidate->isActive)
+            seedingPlan.activate.append(candidate->id);
+        else if (!shouldBeActive && candidate->isActive)
+            seedingPlan.deactivate.append(candidate->id);
+    }
+
+    return seedingPlan;
+}
+
+void SeedingOptimizer::reset()
+{
+    m_history.clear();
+}
@@ -0,0 +1,102 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <QtContainerFwd>
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+
+#include "infohash.h"
+
+namespace BitTorrent
+{
+    enum class SeedingSlot
+    {
+        // the torrent is queued by libtorrent as usual
+        Unmanaged,
+        Active,
+        Queued
+    };
+
+    struct SeedingCandidate
+    {
+        TorrentID id;
+        int seedsCount = 0;
+        int leechersCount = 0;
+        int uploadRate = 0;
+        qreal ratio = 0;
+        // negative if there is no ratio limit
+        qreal ratioLimit = -1;
+        bool isActive = false;
+    };
+
+    struct SeedingPlan
+    {
+        QList<TorrentID> activate;
+        QList<TorrentID> deactivate;
+    };
+
+    struct SeedingOptimizerStatus
+    {
+        bool isEnabled = false;
+        bool isSimulation = false;
+        QDateTime lastRunTime;
+        qint64 lastRunDuration = 0;
+        int candidatesCount = 0;
+        int slotsCount = 0;
+        int activeCount = 0;
+        // active torrents which have no leechers to upload to
+        int idleActiveCount = 0;
+        SeedingPlan lastPlan;
+        qint64 totalRotations = 0;
+    };
+
+    // Ranks seeding torrents by the demand of their swarms and picks the ones
+    // that should occupy the active seeding slots
+    class SeedingOptimizer
+    {
+    public:
+        static qreal score(const SeedingCandidate &candidate, qreal averageUploadRate);
+
+        SeedingPlan plan(const QList<SeedingCandidate> &candidates, int slotsCount, std::chrono::seconds now);
+        void reset();
+
+    private:
+        struct History
+        {
+            qreal averageUploadRate = 0;
+            std::chrono::seconds activeSince {-1};
+        };
+
+        QHash<TorrentID, History> m_history;
+    };
+}
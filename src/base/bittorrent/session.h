@@ -43,6 +43,7 @@
 #include "trackerentrystatus.h"
 
 class QString;
+class TorrentFilterIndex;
 
 namespace BitTorrent
 {
@@ -51,7 +52,14 @@ namespace BitTorrent
     class TorrentDescriptor;
     class TorrentID;
     class TorrentInfo;
+    class TrackerIndex;
+    struct BandwidthGroupLimits;
+    struct BandwidthGroupStatus;
+    struct BandwidthScheduleRule;
     struct CacheStatus;
+    struct MoveStorageJobStatus;
+    struct RecheckQueueStatus;
+    struct SeedingOptimizerStatus;
     struct SessionStatus;
 
     enum class TorrentRemoveOption
@@ -178,6 +186,12 @@ namespace BitTorrent
         virtual bool addTag(const Tag &tag) = 0;
         virtual bool removeTag(const Tag &tag) = 0;
 
+        // Categories (see CategoryOptions) and tags may limit the total speed of their torrents.
+        // Each such limit forms a bandwidth group which shares it between the active torrents.
+        virtual BandwidthGroupLimits tagSpeedLimits(const Tag &tag) const = 0;
+        virtual void setTagSpeedLimits(const Tag &tag, const BandwidthGroupLimits &limits) = 0;
+        virtual QList<BandwidthGroupStatus> bandwidthGroups() const = 0;
+
         // Torrent Management Mode subsystem (TMM)
         //
         // Each torrent can be either in Manual mode or in Automatic mode
@@ -260,6 +274,12 @@ namespace BitTorrent
         virtual void setAltGlobalSpeedLimitEnabled(bool enabled) = 0;
         virtual bool isBandwidthSchedulerEnabled() const = 0;
         virtual void setBandwidthSchedulerEnabled(bool enabled) = 0;
+        virtual QList<BandwidthScheduleRule> bandwidthSchedulerRules() const = 0;
+        virtual void setBandwidthSchedulerRules(const QList<BandwidthScheduleRule> &rules) = 0;
+        virtual bool isBandwidthSchedulerRulesEnabled() const = 0;
+        virtual void setBandwidthSchedulerRulesEnabled(bool enabled) = 0;
+        virtual int bandwidthSchedulerRampTime() const = 0;
+        virtual void setBandwidthSchedulerRampTime(int seconds) = 0;
 
         virtual bool isPerformanceWarningEnabled() const = 0;
         virtual void setPerformanceWarningEnabled(bool enable) = 0;
@@ -285,6 +305,8 @@ namespace BitTorrent
         virtual void setEncryption(int state) = 0;
         virtual int maxActiveCheckingTorrents() const = 0;
         virtual void setMaxActiveCheckingTorrents(int val) = 0;
+        virtual int recheckJobsPerDevice() const = 0;
+        virtual void setRecheckJobsPerDevice(int count) = 0;
         virtual bool isI2PEnabled() const = 0;
         virtual void setI2PEnabled(bool enabled) = 0;
         virtual QString I2PAddress() const = 0;
@@ -379,6 +401,19 @@ namespace BitTorrent
         virtual void setUploadRateForSlowTorrents(int rateInKibiBytes) = 0;
         virtual int slowTorrentsInactivityTimer() const = 0;
         virtual void setSlowTorrentsInactivityTimer(int timeInSeconds) = 0;
+        virtual bool isSeedingOptimizerEnabled() const = 0;
+        virtual void setSeedingOptimizerEnabled(bool enabled) = 0;
+        virtual bool isSeedingOptimizerSimulationEnabled() const = 0;
+        virtual void setSeedingOptimizerSimulationEnabled(bool enabled) = 0;
+        virtual int seedingOptimizerInterval() const = 0;
+        virtual void setSeedingOptimizerInterval(int minutes) = 0;
+        virtual SeedingOptimizerStatus seedingOptimizerStatus() const = 0;
+        virtual bool isSwarmStatsScrapingEnabled() const = 0;
+        virtual void setSwarmStatsScrapingEnabled(bool enabled) = 0;
+        virtual int swarmStatsTTL() const = 0;
+        virtual void setSwarmStatsTTL(int minutes) = 0;
+        virtual bool isMetadataUnloadingEnabled() const = 0;
+        virtual void setMetadataUnloadingEnabled(bool enabled) = 0;
         virtual int outgoingPortsMin() const = 0;
         virtual void setOutgoingPortsMin(int min) = 0;
         virtual int outgoingPortsMax() const = 0;
@@ -462,6 +497,12 @@ namespace BitTorrent
         virtual Torrent *findTorrent(const InfoHash &infoHash) const = 0;
         virtual QList<Torrent *> torrents() const = 0;
         virtual qsizetype torrentsCount() const = 0;
+        // Torrents occupy dense slots in range [0, torrentSlotsCount()),
+        // unused slots (of removed torrents) return nullptr
+        virtual Torrent *torrentAt(int slotIndex) const = 0;
+        virtual int torrentSlotsCount() const = 0;
+        virtual const TrackerIndex *trackerIndex() const = 0;
+        virtual const TorrentFilterIndex *torrentFilterIndex() const = 0;
         virtual const SessionStatus &status() const = 0;
         virtual const CacheStatus &cacheStatus() const = 0;
         virtual bool isListening() const = 0;
@@ -479,6 +520,15 @@ namespace BitTorrent
         virtual void topTorrentsQueuePos(const QList<TorrentID> &ids) = 0;
         virtual void bottomTorrentsQueuePos(const QList<TorrentID> &ids) = 0;
 
+        virtual QList<MoveStorageJobStatus> moveStorageJobs() const = 0;
+        // Queued jobs with higher priority are started first
+        virtual void setMoveStorageJobPriority(const TorrentID &id, int priority) = 0;
+
+        virtual RecheckQueueStatus recheckQueueStatus() const = 0;
+        // Paused queue doesn't start new checks and suspends the running ones
+        virtual bool isRecheckQueuePaused() const = 0;
+        virtual void setRecheckQueuePaused(bool paused) = 0;
+
         virtual QString lastExternalIPv4Address() const = 0;
         virtual QString lastExternalIPv6Address() const = 0;
 
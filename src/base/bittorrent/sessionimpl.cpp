@@ -33,6 +33,8 @@
 #include <concepts>
 #include <cstdint>
 #include <ctime>
+#include <iterator>
+#include <limits>
 #include <ranges>
 #include <string>
 
@@ -68,7 +70,6 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonValue>
-#include <QMutexLocker>
 #include <QNetworkAddressEntry>
 #include <QNetworkInterface>
 #include <QPromise>
@@ -82,10 +83,12 @@
 #include "base/freediskspacechecker.h"
 #include "base/global.h"
 #include "base/logger.h"
+#include "base/memoryusagetracker.h"
 #include "base/net/downloadmanager.h"
 #include "base/net/proxyconfigurationmanager.h"
 #include "base/preferences.h"
 #include "base/profile.h"
+#include "base/torrentfilterindex.h"
 #include "base/unicodestrings.h"
 #include "base/utils/fs.h"
 #include "base/utils/io.h"
@@ -113,12 +116,15 @@
 #include "tracker.h"
 #include "trackerentry.h"
 #include "trackerentrystatus.h"
+#include "trackerindex.h"
+#include "trackerscraper.h"
 
 
 using namespace std::chrono_literals;
 using namespace BitTorrent;
 
 const Path CATEGORIES_FILE_NAME {u"categories.json"_s};
+const Path BANDWIDTH_SCHEDULE_FILE_NAME {u"bandwidth_schedule.json"_s};
 const int MAX_PROCESSING_RESUMEDATA_COUNT = 50;
 const std::chrono::seconds FREEDISKSPACE_CHECK_TIMEOUT = 30s;
 
@@ -482,6 +488,12 @@ SessionImpl::SessionImpl(QObject *parent)
     , m_downloadRateForSlowTorrents(BITTORRENT_SESSION_KEY(u"SlowTorrentsDownloadRate"_s), 2)
     , m_uploadRateForSlowTorrents(BITTORRENT_SESSION_KEY(u"SlowTorrentsUploadRate"_s), 2)
     , m_slowTorrentsInactivityTimer(BITTORRENT_SESSION_KEY(u"SlowTorrentsInactivityTimer"_s), 60)
+    , m_isSeedingOptimizerEnabled(BITTORRENT_SESSION_KEY(u"SeedingOptimizerEnabled"_s), false)
+    , m_isSeedingOptimizerSimulationEnabled(BITTORRENT_SESSION_KEY(u"SeedingOptimizerSimulation"_s), false)
+    , m_seedingOptimizerInterval(BITTORRENT_SESSION_KEY(u"SeedingOptimizerInterval"_s), 5, lowerLimited(1))
+    , m_isSwarmStatsScrapingEnabled(BITTORRENT_SESSION_KEY(u"SwarmStatsScrapingEnabled"_s), false)
+    , m_swarmStatsTTL(BITTORRENT_SESSION_KEY(u"SwarmStatsTTL"_s), 60, lowerLimited(5))
+    , m_isMetadataUnloadingEnabled(BITTORRENT_SESSION_KEY(u"MetadataUnloadingEnabled"_s), false)
     , m_outgoingPortsMin(BITTORRENT_SESSION_KEY(u"OutgoingPortsMin"_s), 0)
     , m_outgoingPortsMax(BITTORRENT_SESSION_KEY(u"OutgoingPortsMax"_s), 0)
     , m_UPnPLeaseDuration(BITTORRENT_SESSION_KEY(u"UPnPLeaseDuration"_s), 0)
@@ -533,6 +545,8 @@ SessionImpl::SessionImpl(QObject *parent)
     , m_altGlobalUploadSpeedLimit(BITTORRENT_SESSION_KEY(u"AlternativeGlobalUPSpeedLimit"_s), 10, lowerLimited(0))
     , m_isAltGlobalSpeedLimitEnabled(BITTORRENT_SESSION_KEY(u"UseAlternativeGlobalSpeedLimit"_s), false)
     , m_isBandwidthSchedulerEnabled(BITTORRENT_SESSION_KEY(u"BandwidthSchedulerEnabled"_s), false)
+    , m_isBandwidthSchedulerRulesEnabled(BITTORRENT_SESSION_KEY(u"BandwidthSchedulerRulesEnabled"_s), false)
+    , m_bandwidthSchedulerRampTime(BITTORRENT_SESSION_KEY(u"BandwidthSchedulerRampTime"_s), 0, lowerLimited(0))
     , m_isPerformanceWarningEnabled(BITTORRENT_SESSION_KEY(u"PerformanceWarning"_s), false)
     , m_saveResumeDataInterval(BITTORRENT_SESSION_KEY(u"SaveResumeDataInterval"_s), 60)
     , m_saveStatisticsInterval(BITTORRENT_SESSION_KEY(u"SaveStatisticsInterval"_s), 15)
@@ -545,12 +559,14 @@ SessionImpl::SessionImpl(QObject *parent)
     , m_networkInterfaceAddress(BITTORRENT_SESSION_KEY(u"InterfaceAddress"_s))
     , m_encryption(BITTORRENT_SESSION_KEY(u"Encryption"_s), 0)
     , m_maxActiveCheckingTorrents(BITTORRENT_SESSION_KEY(u"MaxActiveCheckingTorrents"_s), 1)
+    , m_recheckJobsPerDevice(BITTORRENT_SESSION_KEY(u"RecheckJobsPerDevice"_s), 1, lowerLimited(1))
     , m_isProxyPeerConnectionsEnabled(BITTORRENT_SESSION_KEY(u"ProxyPeerConnections"_s), false)
     , m_chokingAlgorithm(BITTORRENT_SESSION_KEY(u"ChokingAlgorithm"_s), ChokingAlgorithm::FixedSlots
         , clampValue(ChokingAlgorithm::FixedSlots, ChokingAlgorithm::RateBased))
     , m_seedChokingAlgorithm(BITTORRENT_SESSION_KEY(u"SeedChokingAlgorithm"_s), SeedChokingAlgorithm::FastestUpload
         , clampValue(SeedChokingAlgorithm::RoundRobin, SeedChokingAlgorithm::AntiLeech))
     , m_storedTags(BITTORRENT_SESSION_KEY(u"Tags"_s))
+    , m_storedTagSpeedLimits(BITTORRENT_SESSION_KEY(u"TagSpeedLimits"_s))
     , m_shareLimitAction(BITTORRENT_SESSION_KEY(u"ShareLimitAction"_s), ShareLimitAction::Stop
         , [](const ShareLimitAction action) { return (action == ShareLimitAction::Default) ? ShareLimitAction::Stop : action; })
     , m_savePath(BITTORRENT_SESSION_KEY(u"DefaultSavePath"_s), specialFolderLocation(SpecialFolder::Downloads))
@@ -583,12 +599,17 @@ SessionImpl::SessionImpl(QObject *parent)
     , m_torrentContentRemoveOption {BITTORRENT_SESSION_KEY(u"TorrentContentRemoveOption"_s), TorrentContentRemoveOption::Delete}
     , m_startPaused {BITTORRENT_SESSION_KEY(u"StartPaused"_s)}
     , m_seedingLimitTimer {new QTimer(this)}
+    , m_seedingOptimizerTimer {new QTimer(this)}
+    , m_swarmStatsTimer {new QTimer(this)}
+    , m_metadataUnloadTimer {new QTimer(this)}
     , m_resumeDataTimer {new QTimer(this)}
     , m_ioThread {new QThread}
     , m_asyncWorker {new QThreadPool(this)}
     , m_recentErroredTorrentsTimer {new QTimer(this)}
     , m_freeDiskSpaceChecker {new FreeDiskSpaceChecker(savePath())}
     , m_freeDiskSpaceCheckingTimer {new QTimer(this)}
+    , m_trackerIndex {new TrackerIndex(this)}
+    , m_torrentFilterIndex {new TorrentFilterIndex(this)}
 {
     
 
@@ -598,6 +619,9 @@ SessionImpl::SessionImpl(QObject *parent)
 
     m_alerts.reserve(1024);
 
+    m_trackerIndex->watch(this);
+    m_torrentFilterIndex->watch(this);
+
     if (port() < 0)
         m_port = Utils::Random::rand(1024, 65535);
     if (sslPort() < 0)
@@ -622,13 +646,71 @@ SessionImpl::SessionImpl(QObject *parent)
             processTorrentShareLimits(torrent);
     });
 
+    m_seedingOptimizerTimer->setInterval(std::chrono::minutes(seedingOptimizerInterval()));
+    connect(m_seedingOptimizerTimer, &QTimer::timeout, this, &SessionImpl::runSeedingOptimizer);
+    if (isSeedingOptimizerEnabled())
+        m_seedingOptimizerTimer->start();
+
+    m_swarmStatsTimer->setInterval(1min);
+    connect(m_swarmStatsTimer, &QTimer::timeout, this, [this]
+    {
+        storeSwarmStats();
+        refreshSwarmStats();
+    });
+
+    // Metadata is unloaded only if it wasn't accessed during the whole interval
+    m_metadataUnloadTimer->setInterval(5min);
+    connect(m_metadataUnloadTimer, &QTimer::timeout, this, &SessionImpl::unloadInactiveMetadata);
+    if (isMetadataUnloadingEnabled())
+        m_metadataUnloadTimer->start();
+
+    if (auto *memoryUsageTracker = MemoryUsageTracker::instance())
+    {
+        memoryUsageTracker->addEstimator(MemoryComponent::Torrents, this, [this]
+        {
+            MemoryUsage usage {.count = m_torrents.size()};
+            for (const TorrentImpl *torrent : asConst(m_torrents))
+                usage.size += torrent->memoryUsage();
+            return usage;
+        });
+        memoryUsageTracker->addEstimator(MemoryComponent::Metadata, this, [this]
+        {
+            MemoryUsage usage;
+            for (const TorrentImpl *torrent : asConst(m_torrents))
+            {
+                if (!torrent->hasMetadata())
+                    continue;
+
+                usage.count += torrent->isMetadataLoaded() ? 2 : 1;
+                usage.size += torrent->metadataMemoryUsage();
+            }
+            return usage;
+        });
+        memoryUsageTracker->addEstimator(MemoryComponent::Peers, this, [this]
+        {
+            MemoryUsage usage;
+            for (const TorrentImpl *torrent : asConst(m_torrents))
+            {
+                usage.count += torrent->peersCount();
+                usage.size += torrent->peersMemoryUsage();
+            }
+            return usage;
+        });
+        memoryUsageTracker->addEstimator(MemoryComponent::DiskCache, this, [this]
+        {
+            // libtorrent disk buffers are allocated by 16 KiB blocks
+            const qint64 blocksCount = m_cacheStatus.totalUsedBuffers;
+            return MemoryUsage {.size = (blocksCount * 16 * 1024), .count = blocksCount};
+        });
+    }
+
     initializeNativeSession();
 
 
     configureComponents();
 
-    if (isBandwidthSchedulerEnabled())
-        enableBandwidthScheduler();
+    loadBandwidthSchedulerRules();
+    configureBandwidthScheduler();
 
     loadCategories();
     if (isSubcategoriesEnabled())
@@ -644,6 +726,24 @@ SessionImpl::SessionImpl(QObject *parent)
             m_tags.insert(tag);
     }
 
+    // stored as "tag,downloadLimit,uploadLimit" since tags cannot contain commas
+    for (const QString &limitsStr : asConst(m_storedTagSpeedLimits.get()))
+    {
+        const QStringList fields = limitsStr.split(u',');
+        if (fields.size() != 3)
+            continue;
+
+        if (const Tag tag {fields[0]}; m_tags.contains(tag))
+        {
+            const BandwidthGroupLimits limits {
+                .downloadLimit = std::max(0, fields[1].toInt()),
+                .uploadLimit = std::max(0, fields[2].toInt())
+            };
+            if (limits != BandwidthGroupLimits())
+                m_tagSpeedLimits.insert(tag, limits);
+        }
+    }
+
     updateSeedingLimitTimer();
     populateAdditionalTrackers();
     if (isExcludedFileNamesEnabled())
@@ -665,9 +765,7 @@ SessionImpl::SessionImpl(QObject *parent)
         emit freeDiskSpaceChecked(m_freeDiskSpace);
     });
 
-    m_fileSearcher = new FileSearcher;
-    m_fileSearcher->moveToThread(m_ioThread.get());
-    connect(m_ioThread.get(), &QThread::finished, m_fileSearcher, &QObject::deleteLater);
+    m_fileSearcher = new FileSearcher(this);
 
     m_torrentContentRemover = new TorrentContentRemover;
     m_torrentContentRemover->moveToThread(m_ioThread.get());
@@ -737,6 +835,7 @@ SessionImpl::~SessionImpl()
     delete m_nativeSession;
 
     qDebug("Deleting resume data storage...");
+    storeSwarmStats();
     delete m_resumeDataStorage;
     LogMsg(tr("Saving resume data completed."));
 
@@ -1185,12 +1284,58 @@ bool SessionImpl::removeTag(const Tag &tag)
 
         m_storedTags = QStringList(m_tags.cbegin(), m_tags.cend());
 
+        if (m_tagSpeedLimits.remove(tag))
+            storeTagSpeedLimits();
+
         emit tagRemoved(tag);
         return true;
     }
     return false;
 }
 
+BandwidthGroupLimits SessionImpl::tagSpeedLimits(const Tag &tag) const
+{
+    return m_tagSpeedLimits.value(tag);
+}
+
+void SessionImpl::setTagSpeedLimits(const Tag &tag, const BandwidthGroupLimits &limits)
+{
+    if (!hasTag(tag))
+        return;
+
+    const BandwidthGroupLimits cleanLimits {
+        .downloadLimit = std::max(0, limits.downloadLimit),
+        .uploadLimit = std::max(0, limits.uploadLimit)
+    };
+    if (cleanLimits == tagSpeedLimits(tag))
+        return;
+
+    if (cleanLimits == BandwidthGroupLimits())
+        m_tagSpeedLimits.remove(tag);
+    else
+        m_tagSpeedLimits.insert(tag, cleanLimits);
+
+    storeTagSpeedLimits();
+}
+
+void SessionImpl::storeTagSpeedLimits()
+{
+    QStringList storedLimits;
+    storedLimits.reserve(m_tagSpeedLimits.size());
+    for (auto it = m_tagSpeedLimits.cbegin(); it != m_tagSpeedLimits.cend(); ++it)
+    {
+        storedLimits.append(u"%1,%2,%3"_s.arg(it.key().toString()
+                , QString::number(it.value().downloadLimit), QString::number(it.value().uploadLimit)));
+    }
+
+    m_storedTagSpeedLimits = storedLimits;
+}
+
+QList<BandwidthGroupStatus> SessionImpl::bandwidthGroups() const
+{
+    return m_bandwidthGroups;
+}
+
 bool SessionImpl::isAutoTMMDisabledByDefault() const
 {
     return m_isAutoTMMDisabledByDefault;
@@ -1330,8 +1475,8 @@ void SessionImpl::setGlobalMaxInactiveSeedingMinutes(int minutes)
 void SessionImpl::applyBandwidthLimits()
 {
     lt::settings_pack settingsPack;
-    settingsPack.set_int(lt::settings_pack::download_rate_limit, downloadSpeedLimit());
-    settingsPack.set_int(lt::settings_pack::upload_rate_limit, uploadSpeedLimit());
+    settingsPack.set_int(lt::settings_pack::download_rate_limit, appliedDownloadSpeedLimit());
+    settingsPack.set_int(lt::settings_pack::upload_rate_limit, appliedUploadSpeedLimit());
     m_nativeSession->apply_settings(std::move(settingsPack));
 }
 
@@ -1393,6 +1538,14 @@ void SessionImpl::prepareStartup()
     if (!context->startupStorage)
         context->startupStorage = m_resumeDataStorage;
 
+    m_swarmStats = m_resumeDataStorage->loadSwarmStats();
+    if (isSwarmStatsScrapingEnabled())
+    {
+        m_trackerScraper = new TrackerScraper(this);
+        connect(m_trackerScraper, &TrackerScraper::statsReceived, this, &SessionImpl::handleSwarmStatsReceived);
+        m_swarmStatsTimer->start();
+    }
+
     connect(context->startupStorage, &ResumeDataStorage::loadStarted, context
             , [this, context](const QList<TorrentID> &torrents)
     {
@@ -1873,8 +2026,8 @@ lt::settings_pack SessionImpl::loadLTSettings() const
 
     applyNetworkInterfacesSettings(settingsPack);
 
-    settingsPack.set_int(lt::settings_pack::download_rate_limit, downloadSpeedLimit());
-    settingsPack.set_int(lt::settings_pack::upload_rate_limit, uploadSpeedLimit());
+    settingsPack.set_int(lt::settings_pack::download_rate_limit, appliedDownloadSpeedLimit());
+    settingsPack.set_int(lt::settings_pack::upload_rate_limit, appliedUploadSpeedLimit());
 
     // The most secure, rc4 only so that all streams are encrypted
     settingsPack.set_int(lt::settings_pack::allowed_enc_level, lt::settings_pack::pe_rc4);
@@ -1894,7 +2047,8 @@ lt::settings_pack SessionImpl::loadLTSettings() const
         settingsPack.set_int(lt::settings_pack::in_enc_policy, lt::settings_pack::pe_disabled);
     }
 
-    settingsPack.set_int(lt::settings_pack::active_checking, maxActiveCheckingTorrents());
+    m_activeCheckingLimit = activeCheckingLimit();
+    settingsPack.set_int(lt::settings_pack::active_checking, m_activeCheckingLimit);
 
     // I2P
 #if defined(QBT_USES_LIBTORRENT2) && TORRENT_USE_I2P
@@ -2335,15 +2489,59 @@ void SessionImpl::enableTracker(const bool enable)
     }
 }
 
-void SessionImpl::enableBandwidthScheduler()
+void SessionImpl::configureBandwidthScheduler()
 {
-    if (!m_bwScheduler)
+    // The schedule of alternative limits and the rules are enabled independently
+    if (!isBandwidthSchedulerEnabled() && !isBandwidthSchedulerRulesEnabled())
+    {
+        if (m_bwScheduler)
+        {
+            delete m_bwScheduler;
+            applyScheduledLimits({});
+        }
+        return;
+    }
+
+    const bool isNew = !m_bwScheduler;
+    if (isNew)
     {
         m_bwScheduler = new BandwidthScheduler(this);
         connect(m_bwScheduler.data(), &BandwidthScheduler::bandwidthLimitRequested
                 , this, &SessionImpl::setAltGlobalSpeedLimitEnabled);
+        connect(m_bwScheduler.data(), &BandwidthScheduler::scheduledLimitsChanged
+                , this, &SessionImpl::applyScheduledLimits);
     }
-    m_bwScheduler->start();
+    m_bwScheduler->setAlternativeScheduleEnabled(isBandwidthSchedulerEnabled());
+    m_bwScheduler->setRules(isBandwidthSchedulerRulesEnabled() ? m_bandwidthSchedulerRules : QList<BandwidthScheduleRule>());
+    m_bwScheduler->setRampTime(std::chrono::seconds(bandwidthSchedulerRampTime()));
+    if (isNew)
+        m_bwScheduler->start();
+}
+
+void SessionImpl::applyScheduledLimits(const BandwidthScheduleState &state)
+{
+    if (state == m_scheduledLimits)
+        return;
+
+    const bool globalLimitsChanged = (state.global != m_scheduledLimits.global);
+    m_scheduledLimits = state;
+    if (globalLimitsChanged)
+        applyBandwidthLimits();
+    // the limits of bandwidth groups are applied on the next refresh
+}
+
+int SessionImpl::appliedDownloadSpeedLimit() const
+{
+    return (m_scheduledLimits.global.downloadLimit >= 0)
+            ? m_scheduledLimits.global.downloadLimit
+            : downloadSpeedLimit();
+}
+
+int SessionImpl::appliedUploadSpeedLimit() const
+{
+    return (m_scheduledLimits.global.uploadLimit >= 0)
+            ? m_scheduledLimits.global.uploadLimit
+            : uploadSpeedLimit();
 }
 
 void SessionImpl::populateAdditionalTrackers()
@@ -2491,6 +2689,9 @@ bool SessionImpl::removeTorrent(const TorrentID &id, const TorrentRemoveOption d
     qDebug("Deleting torrent with ID: %s", qUtf8Printable(torrentID.toString()));
     emit torrentAboutToBeRemoved(torrent);
 
+    m_torrentsBySlot[torrent->slotIndex()] = nullptr;
+    m_freeTorrentSlots.append(torrent->slotIndex());
+
     if (const InfoHash infoHash = torrent->infoHash(); infoHash.isHybrid())
         m_hybridTorrentsByAltID.remove(TorrentID::fromSHA1Hash(infoHash.v1()));
 
@@ -2521,24 +2722,24 @@ bool SessionImpl::removeTorrent(const TorrentID &id, const TorrentRemoveOption d
     {
         m_removingTorrents[torrentID] = {torrentName, torrent->actualStorageLocation(), torrent->actualFilePaths(), deleteOption};
 
-        if (m_moveStorageQueue.size() > 1)
+        // Delete queued "move storage job" for the deleted torrent
+        // (note: we shouldn't delete active job)
+        const auto iter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [torrent](const MoveStorageJob &job)
         {
-            // Delete "move storage job" for the deleted torrent
-            // (note: we shouldn't delete active job)
-            const auto iter = std::ranges::find_if(std::views::drop(asConst(m_moveStorageQueue), 1)
-                , [torrent](const MoveStorageJob &job)
-            {
-                return job.torrentHandle == torrent->nativeHandle();
-            });
-            if (iter != m_moveStorageQueue.cend())
-                m_moveStorageQueue.erase(iter);
-        }
+            return !job.isActive() && (job.torrentHandle == torrent->nativeHandle());
+        });
+        if (iter != m_moveStorageQueue.cend())
+            m_moveStorageQueue.erase(iter);
 
         m_nativeSession->remove_torrent(torrent->nativeHandle(), lt::session::delete_partfile);
     }
 
     // Remove it from torrent resume directory
     m_resumeDataStorage->remove(torrentID);
+    m_swarmStats.remove(torrentID);
+    m_changedSwarmStats.remove(torrentID);
+    finishRecheckJob(torrentID, false);
 
     LogMsg(tr("Torrent removed. Torrent: \"%1\"").arg(torrentName));
     delete torrent;
@@ -2639,6 +2840,29 @@ qsizetype SessionImpl::torrentsCount() const
     return m_torrents.size();
 }
 
+Torrent *SessionImpl::torrentAt(const int slotIndex) const
+{
+    if ((slotIndex < 0) || (slotIndex >= m_torrentsBySlot.size()))
+        return nullptr;
+
+    return m_torrentsBySlot[slotIndex];
+}
+
+int SessionImpl::torrentSlotsCount() const
+{
+    return m_torrentsBySlot.size();
+}
+
+const TrackerIndex *SessionImpl::trackerIndex() const
+{
+    return m_trackerIndex;
+}
+
+const TorrentFilterIndex *SessionImpl::torrentFilterIndex() const
+{
+    return m_torrentFilterIndex;
+}
+
 bool SessionImpl::addTorrent(const TorrentDescriptor &torrentDescr, const AddTorrentParams &params)
 {
     if (!isRestored())
@@ -2997,11 +3221,7 @@ QFuture<FileSearchResult> SessionImpl::findIncompleteFiles(const Path &savePath,
     QPromise<FileSearchResult> promise;
     QFuture<FileSearchResult> future = promise.future();
     promise.start();
-    QMetaObject::invokeMethod(m_fileSearcher, [=, this, promise = std::move(promise)]() mutable
-    {
-        m_fileSearcher->search(filePaths, savePath, downloadPath, isAppendExtensionEnabled(), promise);
-        promise.finish();
-    });
+    m_fileSearcher->search(filePaths, savePath, downloadPath, isAppendExtensionEnabled(), std::move(promise));
 
     return future;
 }
@@ -3219,9 +3439,8 @@ void SessionImpl::saveResumeData()
         catch (const std::exception &) {}
     }
 
-    // clear queued storage move jobs except the current ongoing one
-    if (m_moveStorageQueue.size() > 1)
-        m_moveStorageQueue.resize(1);
+    // clear queued storage move jobs except the ongoing ones
+    m_moveStorageQueue.removeIf([](const MoveStorageJob &job) { return !job.isActive(); });
 
     QElapsedTimer timer;
     timer.start();
@@ -3617,13 +3836,55 @@ void SessionImpl::setBandwidthSchedulerEnabled(const bool enabled)
     if (enabled != isBandwidthSchedulerEnabled())
     {
         m_isBandwidthSchedulerEnabled = enabled;
-        if (enabled)
-            enableBandwidthScheduler();
-        else
-            delete m_bwScheduler;
+        configureBandwidthScheduler();
     }
 }
 
+QList<BandwidthScheduleRule> SessionImpl::bandwidthSchedulerRules() const
+{
+    return m_bandwidthSchedulerRules;
+}
+
+void SessionImpl::setBandwidthSchedulerRules(const QList<BandwidthScheduleRule> &rules)
+{
+    if (rules == m_bandwidthSchedulerRules)
+        return;
+
+    m_bandwidthSchedulerRules = rules;
+    storeBandwidthSchedulerRules();
+    if (m_bwScheduler && isBandwidthSchedulerRulesEnabled())
+        m_bwScheduler->setRules(m_bandwidthSchedulerRules);
+}
+
+bool SessionImpl::isBandwidthSchedulerRulesEnabled() const
+{
+    return m_isBandwidthSchedulerRulesEnabled;
+}
+
+void SessionImpl::setBandwidthSchedulerRulesEnabled(const bool enabled)
+{
+    if (enabled == isBandwidthSchedulerRulesEnabled())
+        return;
+
+    m_isBandwidthSchedulerRulesEnabled = enabled;
+    configureBandwidthScheduler();
+}
+
+int SessionImpl::bandwidthSchedulerRampTime() const
+{
+    return m_bandwidthSchedulerRampTime;
+}
+
+void SessionImpl::setBandwidthSchedulerRampTime(const int seconds)
+{
+    if (seconds == bandwidthSchedulerRampTime())
+        return;
+
+    m_bandwidthSchedulerRampTime = seconds;
+    if (m_bwScheduler)
+        m_bwScheduler->setRampTime(std::chrono::seconds(bandwidthSchedulerRampTime()));
+}
+
 bool SessionImpl::isPerformanceWarningEnabled() const
 {
     return m_isPerformanceWarningEnabled;
@@ -3743,6 +4004,9 @@ void SessionImpl::setNetworkInterface(const QString &iface)
     {
         m_networkInterface = iface;
         configureListeningInterface();
+
+        if (m_trackerScraper && !iface.isEmpty())
+            m_trackerScraper->clearQueue();
     }
 }
 
@@ -3767,6 +4031,9 @@ void SessionImpl::setNetworkInterfaceAddress(const QString &address)
     {
         m_networkInterfaceAddress = address;
         configureListeningInterface();
+
+        if (m_trackerScraper && !address.isEmpty())
+            m_trackerScraper->clearQueue();
     }
 }
 
@@ -3801,6 +4068,20 @@ void SessionImpl::setMaxActiveCheckingTorrents(const int val)
     configureDeferred();
 }
 
+int SessionImpl::recheckJobsPerDevice() const
+{
+    return m_recheckJobsPerDevice;
+}
+
+void SessionImpl::setRecheckJobsPerDevice(const int count)
+{
+    if ((count == recheckJobsPerDevice()) || (count < 1))
+        return;
+
+    m_recheckJobsPerDevice = count;
+    startRecheckJobs();
+}
+
 bool SessionImpl::isI2PEnabled() const
 {
     return m_isI2PEnabled;
@@ -4735,9 +5016,14 @@ void SessionImpl::setQueueingSystemEnabled(const bool enabled)
         configureDeferred();
 
         if (enabled)
+        {
             m_torrentsQueueChanged = true;
+        }
         else
+        {
             removeTorrentsQueue();
+            releaseSeedingSlots();
+        }
 
         for (TorrentImpl *torrent : asConst(m_torrents))
             torrent->handleQueueingModeChanged();
@@ -4845,6 +5131,126 @@ void SessionImpl::setSlowTorrentsInactivityTimer(const int timeInSeconds)
     configureDeferred();
 }
 
+bool SessionImpl::isSeedingOptimizerEnabled() const
+{
+    return m_isSeedingOptimizerEnabled;
+}
+
+void SessionImpl::setSeedingOptimizerEnabled(const bool enabled)
+{
+    if (enabled == isSeedingOptimizerEnabled())
+        return;
+
+    m_isSeedingOptimizerEnabled = enabled;
+    if (enabled)
+    {
+        m_seedingOptimizerTimer->start();
+        runSeedingOptimizer();
+    }
+    else
+    {
+        m_seedingOptimizerTimer->stop();
+        releaseSeedingSlots();
+        m_seedingOptimizer.reset();
+        m_seedingOptimizerStatus = {};
+    }
+}
+
+bool SessionImpl::isSeedingOptimizerSimulationEnabled() const
+{
+    return m_isSeedingOptimizerSimulationEnabled;
+}
+
+void SessionImpl::setSeedingOptimizerSimulationEnabled(const bool enabled)
+{
+    if (enabled == isSeedingOptimizerSimulationEnabled())
+        return;
+
+    m_isSeedingOptimizerSimulationEnabled = enabled;
+    if (isSeedingOptimizerEnabled())
+    {
+        // the torrents are given back to libtorrent, the simulation starts from its choice
+        if (enabled)
+            releaseSeedingSlots();
+        runSeedingOptimizer();
+    }
+}
+
+int SessionImpl::seedingOptimizerInterval() const
+{
+    return m_seedingOptimizerInterval;
+}
+
+void SessionImpl::setSeedingOptimizerInterval(const int minutes)
+{
+    if ((minutes == seedingOptimizerInterval()) || (minutes < 1))
+        return;
+
+    m_seedingOptimizerInterval = minutes;
+    m_seedingOptimizerTimer->setInterval(std::chrono::minutes(seedingOptimizerInterval()));
+}
+
+SeedingOptimizerStatus SessionImpl::seedingOptimizerStatus() const
+{
+    return m_seedingOptimizerStatus;
+}
+
+bool SessionImpl::isSwarmStatsScrapingEnabled() const
+{
+    return m_isSwarmStatsScrapingEnabled;
+}
+
+void SessionImpl::setSwarmStatsScrapingEnabled(const bool enabled)
+{
+    if (enabled == isSwarmStatsScrapingEnabled())
+        return;
+
+    m_isSwarmStatsScrapingEnabled = enabled;
+    if (enabled)
+    {
+        m_trackerScraper = new TrackerScraper(this);
+        connect(m_trackerScraper, &TrackerScraper::statsReceived, this, &SessionImpl::handleSwarmStatsReceived);
+        m_swarmStatsTimer->start();
+        refreshSwarmStats();
+    }
+    else
+    {
+        m_swarmStatsTimer->stop();
+        storeSwarmStats();
+        delete m_trackerScraper;
+    }
+}
+
+int SessionImpl::swarmStatsTTL() const
+{
+    return m_swarmStatsTTL;
+}
+
+void SessionImpl::setSwarmStatsTTL(const int minutes)
+{
+    if ((minutes == swarmStatsTTL()) || (minutes < 5))
+        return;
+
+    m_swarmStatsTTL = minutes;
+}
+
+bool SessionImpl::isMetadataUnloadingEnabled() const
+{
+    return m_isMetadataUnloadingEnabled;
+}
+
+void SessionImpl::setMetadataUnloadingEnabled(const bool enabled)
+{
+    if (enabled == isMetadataUnloadingEnabled())
+        return;
+
+    m_isMetadataUnloadingEnabled = enabled;
+    if (enabled)
+        m_metadataUnloadTimer->start();
+    else
+        m_metadataUnloadTimer->stop();
+}
+
 int SessionImpl::outgoingPortsMin() const
 {
     return m_outgoingPortsMin;
@@ -5236,45 +5642,234 @@ void SessionImpl::updateSeedingLimitTimer()
     }
 }
 
-void SessionImpl::handleTorrentShareLimitChanged(TorrentImpl *const)
+void SessionImpl::runSeedingOptimizer()
 {
-    updateSeedingLimitTimer();
-}
+    // number of queued torrents whose swarm statistics are refreshed per run
+    // since they don't announce to trackers while queued
+    const int scrapeBatchSize = 100;
 
-void SessionImpl::handleTorrentNameChanged(TorrentImpl *const)
-{
-}
+    if (!isQueueingSystemEnabled() || (maxActiveUploads() < 0))
+    {
+        releaseSeedingSlots();
+        m_seedingOptimizerStatus = {.isEnabled = true, .isSimulation = isSeedingOptimizerSimulationEnabled()};
+        return;
+    }
 
-void SessionImpl::handleTorrentSavePathChanged(TorrentImpl *const torrent)
-{
-    emit torrentSavePathChanged(torrent);
-}
+    QElapsedTimer elapsedTimer;
+    elapsedTimer.start();
 
-void SessionImpl::handleTorrentCategoryChanged(TorrentImpl *const torrent, const QString &oldCategory)
-{
-    emit torrentCategoryChanged(torrent, oldCategory);
-}
+    const bool isSimulation = isSeedingOptimizerSimulationEnabled();
 
-void SessionImpl::handleTorrentTagAdded(TorrentImpl *const torrent, const Tag &tag)
-{
-    emit torrentTagAdded(torrent, tag);
-}
+    int activeDownloadsCount = 0;
+    QList<SeedingCandidate> candidates;
+    QList<TorrentImpl *> candidateTorrents;
+    for (TorrentImpl *torrent : asConst(m_torrents))
+    {
+        if (torrent->isStopped() || torrent->isForced())
+            continue;
 
-void SessionImpl::handleTorrentTagRemoved(TorrentImpl *const torrent, const Tag &tag)
-{
-    emit torrentTagRemoved(torrent, tag);
+        if (!torrent->isFinished() || torrent->isChecking() || torrent->isMoving() || torrent->isErrored())
+        {
+            if (!torrent->isFinished() && !torrent->isQueued())
+                ++activeDownloadsCount;
+            torrent->setSeedingSlot(SeedingSlot::Unmanaged);
+            continue;
+        }
+
+        const qreal ratioLimit = (torrent->ratioLimit() == Torrent::USE_GLOBAL_RATIO)
+                ? globalMaxRatio() : torrent->ratioLimit();
+        candidates.append({
+            .id = torrent->id(),
+            .seedsCount = torrent->totalSeedsCount(),
+            .leechersCount = torrent->totalLeechersCount(),
+            .uploadRate = torrent->uploadPayloadRate(),
+            .ratio = torrent->realRatio(),
+            .ratioLimit = ratioLimit,
+            .isActive = !torrent->isQueued()
+        });
+        candidateTorrents.append(torrent);
+    }
+
+    // downloads are still queued by libtorrent and share the total limit with seeds
+    int slotsCount = maxActiveUploads();
+    if (maxActiveTorrents() >= 0)
+        slotsCount = std::min(slotsCount, std::max(0, (maxActiveTorrents() - activeDownloadsCount)));
+
+    const auto now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch());
+    const SeedingPlan plan = m_seedingOptimizer.plan(candidates, slotsCount, now);
+    const QSet<TorrentID> activated {plan.activate.cbegin(), plan.activate.cend()};
+    const QSet<TorrentID> deactivated {plan.deactivate.cbegin(), plan.deactivate.cend()};
+
+    int activeCount = 0;
+    int idleActiveCount = 0;
+    QList<TorrentImpl *> queuedTorrents;
+    for (qsizetype i = 0; i < candidates.size(); ++i)
+    {
+        const SeedingCandidate &candidate = candidates[i];
+        const bool isActive = activated.contains(candidate.id)
+                || (candidate.isActive && !deactivated.contains(candidate.id));
+        if (isActive)
+        {
+            ++activeCount;
+            if (candidate.leechersCount <= 0)
+                ++idleActiveCount;
+        }
+
+        if (isSimulation)
+            continue;
+
+        TorrentImpl *torrent = candidateTorrents[i];
+        torrent->setSeedingSlot(isActive ? SeedingSlot::Active : SeedingSlot::Queued);
+        if (!isActive)
+            queuedTorrents.append(torrent);
+    }
+
+    // Queued torrents are scraped in bulk when swarm statistics caching is enabled
+    if (!queuedTorrents.isEmpty() && !isSwarmStatsScrapingEnabled())
+    {
+        const qsizetype count = std::min<qsizetype>(scrapeBatchSize, queuedTorrents.size());
+        const qsizetype offset = m_seedingOptimizerScrapeOffset % queuedTorrents.size();
+        for (qsizetype i = 0; i < count; ++i)
+            queuedTorrents[(offset + i) % queuedTorrents.size()]->scrapeTrackers();
+        m_seedingOptimizerScrapeOffset = offset + count;
+    }
+
+    const qint64 rotationsCount = isSimulation ? 0 : (plan.activate.size() + plan.deactivate.size());
+    m_seedingOptimizerStatus = {
+        .isEnabled = true,
+        .isSimulation = isSimulation,
+        .lastRunTime = QDateTime::currentDateTime(),
+        .lastRunDuration = elapsedTimer.elapsed(),
+        .candidatesCount = static_cast<int>(candidates.size()),
+        .slotsCount = slotsCount,
+        .activeCount = activeCount,
+        .idleActiveCount = idleActiveCount,
+        .lastPlan = plan,
+        .totalRotations = m_seedingOptimizerStatus.totalRotations + rotationsCount
+    };
 }
 
-void SessionImpl::handleTorrentSavingModeChanged(TorrentImpl *const torrent)
+void SessionImpl::releaseSeedingSlots()
 {
-    emit torrentSavingModeChanged(torrent);
+    for (TorrentImpl *torrent : asConst(m_torrents))
+        torrent->setSeedingSlot(SeedingSlot::Unmanaged);
 }
 
-void SessionImpl::handleTorrentTrackersAdded(TorrentImpl *const torrent, const QList<TrackerEntry> &newTrackers)
+void SessionImpl::refreshSwarmStats()
 {
-    for (const TrackerEntry &newTracker : newTrackers)
-        LogMsg(tr("Added tracker to torrent. Torrent: \"%1\". Tracker: \"%2\"").arg(torrent->name(), newTracker.url));
-    emit trackersAdded(torrent, newTrackers);
+    if (!m_trackerScraper)
+        return;
+
+    // Scrape requests can't be bound to the configured network interface or address
+    // so they would bypass it (e.g. when it is used to keep the traffic within VPN)
+    if (!networkInterface().isEmpty() || !networkInterfaceAddress().isEmpty())
+        return;
+
+    const QDateTime now = QDateTime::currentDateTimeUtc();
+    const qint64 ttl = std::chrono::seconds(std::chrono::minutes(swarmStatsTTL())).count();
+
+    for (TorrentImpl *torrent : asConst(m_torrents))
+    {
+        // Running torrents receive fresh statistics with their announces
+        if (!torrent->isStopped() && !torrent->isQueued())
+            continue;
+
+        const TorrentID torrentID = torrent->id();
+        if (m_trackerScraper->isPending(torrentID))
+            continue;
+
+        if (const SwarmStats stats = m_swarmStats.value(torrentID); stats.isValid() && (stats.updateTime.secsTo(now) < ttl))
+            continue;
+
+        QString scrapeURL;
+        const QList<TrackerEntryStatus> trackers = torrent->trackers();
+        for (const TrackerEntryStatus &tracker : trackers)
+        {
+            scrapeURL = TrackerScraper::scrapeURL(tracker.url);
+            if (!scrapeURL.isEmpty())
+                break;
+        }
+
+        if (!scrapeURL.isEmpty())
+        {
+            m_trackerScraper->enqueue(scrapeURL, torrentID);
+        }
+        else
+        {
+            // Don't look into the trackers of the torrent again until the statistics expire
+            m_swarmStats[torrentID] = {.updateTime = now};
+        }
+    }
+}
+
+void SessionImpl::handleSwarmStatsReceived(const QHash<TorrentID, SwarmStats> &stats)
+{
+    for (auto it = stats.cbegin(); it != stats.cend(); ++it)
+    {
+        TorrentImpl *torrent = m_torrents.value(it.key());
+        if (!torrent)
+            continue;
+
+        torrent->setSwarmStats(it.value());
+        m_swarmStats.insert(it.key(), it.value());
+        m_changedSwarmStats.insert(it.key(), it.value());
+    }
+}
+
+void SessionImpl::storeSwarmStats()
+{
+    if (m_changedSwarmStats.isEmpty())
+        return;
+
+    m_resumeDataStorage->storeSwarmStats(m_changedSwarmStats);
+    m_changedSwarmStats.clear();
+}
+
+void SessionImpl::unloadInactiveMetadata()
+{
+    for (TorrentImpl *torrent : asConst(m_torrents))
+        torrent->unloadMetadata();
+}
+
+void SessionImpl::handleTorrentShareLimitChanged(TorrentImpl *const)
+{
+    updateSeedingLimitTimer();
+}
+
+void SessionImpl::handleTorrentNameChanged(TorrentImpl *const)
+{
+}
+
+void SessionImpl::handleTorrentSavePathChanged(TorrentImpl *const torrent)
+{
+    emit torrentSavePathChanged(torrent);
+}
+
+void SessionImpl::handleTorrentCategoryChanged(TorrentImpl *const torrent, const QString &oldCategory)
+{
+    emit torrentCategoryChanged(torrent, oldCategory);
+}
+
+void SessionImpl::handleTorrentTagAdded(TorrentImpl *const torrent, const Tag &tag)
+{
+    emit torrentTagAdded(torrent, tag);
+}
+
+void SessionImpl::handleTorrentTagRemoved(TorrentImpl *const torrent, const Tag &tag)
+{
+    emit torrentTagRemoved(torrent, tag);
+}
+
+void SessionImpl::handleTorrentSavingModeChanged(TorrentImpl *const torrent)
+{
+    emit torrentSavingModeChanged(torrent);
+}
+
+void SessionImpl::handleTorrentTrackersAdded(TorrentImpl *const torrent, const QList<TrackerEntry> &newTrackers)
+{
+    for (const TrackerEntry &newTracker : newTrackers)
+        LogMsg(tr("Added tracker to torrent. Torrent: \"%1\". Tracker: \"%2\"").arg(torrent->name(), newTracker.url));
+    emit trackersAdded(torrent, newTrackers);
 }
 
 void SessionImpl::handleTorrentTrackersRemoved(TorrentImpl *const torrent, const QStringList &deletedTrackers)
@@ -5311,6 +5906,9 @@ void SessionImpl::handleTorrentMetadataReceived(TorrentImpl *const torrent)
 
 void SessionImpl::handleTorrentStopped(TorrentImpl *const torrent)
 {
+    // Stopping the torrent suspends its checking, so give the device to the next job
+    abortActiveRecheckJob(torrent->id());
+
     torrent->resetTrackerEntryStatuses();
 
     const QList<TrackerEntryStatus> trackers = torrent->trackers();
@@ -5378,30 +5976,36 @@ bool SessionImpl::addMoveTorrentStorageJob(TorrentImpl *torrent, const Path &new
 
     const lt::torrent_handle torrentHandle = torrent->nativeHandle();
     const Path currentLocation = torrent->actualStorageLocation();
-    const bool torrentHasActiveJob = !m_moveStorageQueue.isEmpty() && (m_moveStorageQueue.constFirst().torrentHandle == torrentHandle);
 
-    if (m_moveStorageQueue.size() > 1)
+    const auto activeJobIter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [&torrentHandle](const MoveStorageJob &job)
     {
-        const auto iter = std::ranges::find_if(std::views::drop(asConst(m_moveStorageQueue), 1)
-                , [&torrentHandle](const MoveStorageJob &job)
-        {
-            return job.torrentHandle == torrentHandle;
-        });
+        return job.isActive() && (job.torrentHandle == torrentHandle);
+    });
+    const bool torrentHasActiveJob = (activeJobIter != m_moveStorageQueue.cend());
+    const Path activeJobPath = torrentHasActiveJob ? activeJobIter->path : Path();
 
-        if (iter != m_moveStorageQueue.cend())
-        {
-            // remove existing inactive job
-            torrent->handleMoveStorageJobFinished(currentLocation, iter->context, torrentHasActiveJob);
-            LogMsg(tr("Torrent move canceled. Torrent: \"%1\". Source: \"%2\". Destination: \"%3\"").arg(torrent->name(), currentLocation.toString(), iter->path.toString()));
-            m_moveStorageQueue.erase(iter);
-        }
+    int priority = 0;
+    const auto queuedJobIter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [&torrentHandle](const MoveStorageJob &job)
+    {
+        return !job.isActive() && (job.torrentHandle == torrentHandle);
+    });
+    if (queuedJobIter != m_moveStorageQueue.cend())
+    {
+        // remove existing inactive job
+        torrent->handleMoveStorageJobFinished(currentLocation, queuedJobIter->context, torrentHasActiveJob);
+        LogMsg(tr("Torrent move canceled. Torrent: \"%1\". Source: \"%2\". Destination: \"%3\"").arg(torrent->name(), currentLocation.toString(), queuedJobIter->path.toString()));
+        // the job replacing the canceled one keeps its priority
+        priority = queuedJobIter->priority;
+        m_moveStorageQueue.erase(queuedJobIter);
     }
 
     if (torrentHasActiveJob)
     {
         // if there is active job for this torrent prevent creating meaningless
         // job that will move torrent to the same location as current one
-        if (m_moveStorageQueue.constFirst().path == newPath)
+        if (activeJobPath == newPath)
         {
             LogMsg(tr("Failed to enqueue torrent move. Torrent: \"%1\". Source: \"%2\". Destination: \"%3\". Reason: torrent is currently moving to the destination")
                    .arg(torrent->name(), currentLocation.toString(), newPath.toString()));
@@ -5418,21 +6022,263 @@ bool SessionImpl::addMoveTorrentStorageJob(TorrentImpl *torrent, const Path &new
         }
     }
 
-    const MoveStorageJob moveStorageJob {torrentHandle, newPath, mode, context};
-    m_moveStorageQueue << moveStorageJob;
+    // the devices are cached only while there are jobs so that changes of mount points are noticed
+    if (m_moveStorageQueue.isEmpty() && m_recheckQueue.isEmpty())
+        m_storageDevices.clear();
+
+    m_moveStorageQueue.append({.torrentHandle = torrentHandle, .path = newPath, .mode = mode, .context = context
+        , .priority = priority, .size = torrent->completedSize(), .sourcePath = currentLocation});
     LogMsg(tr("Enqueued torrent move. Torrent: \"%1\". Source: \"%2\". Destination: \"%3\"").arg(torrent->name(), currentLocation.toString(), newPath.toString()));
 
-    if (m_moveStorageQueue.size() == 1)
-        moveTorrentStorage(moveStorageJob);
+    startMoveStorageJobs();
 
     return true;
 }
 
+QList<MoveStorageJobStatus> SessionImpl::moveStorageJobs() const
+{
+    QList<MoveStorageJobStatus> jobs;
+    jobs.reserve(m_moveStorageQueue.size());
+    for (const MoveStorageJob &job : asConst(m_moveStorageQueue))
+    {
+        const TorrentImpl *torrent = getTorrent(job.torrentHandle);
+        const auto devices = job.isActive()
+                ? std::make_pair(job.sourceDevice, job.destinationDevice)
+                : std::make_pair(m_storageDevices.value(job.sourcePath), m_storageDevices.value(job.path));
+        const qint64 throughput = m_moveStorageThroughputs.value(devices, -1);
+        const qint64 elapsedTime = job.isActive() ? (job.timer.elapsed() / 1000) : 0;
+        const qint64 eta = (throughput > 0) ? std::max<qint64>(0, ((job.size / throughput) - elapsedTime)) : -1;
+
+        jobs.append({.torrentID = (torrent ? torrent->id() : getInfoHash(job.torrentHandle).toTorrentID())
+            , .path = job.path, .priority = job.priority, .isActive = job.isActive(), .size = job.size
+            , .elapsedTime = elapsedTime, .throughput = throughput, .eta = eta});
+    }
+
+    return jobs;
+}
+
+void SessionImpl::setMoveStorageJobPriority(const TorrentID &id, const int priority)
+{
+    const TorrentImpl *torrent = m_torrents.value(id);
+    if (!torrent)
+        return;
+
+    for (MoveStorageJob &job : m_moveStorageQueue)
+    {
+        if (job.torrentHandle == torrent->nativeHandle())
+            job.priority = priority;
+    }
+
+    startMoveStorageJobs();
+}
+
+void SessionImpl::addRecheckJob(TorrentImpl *torrent)
+{
+    const TorrentID torrentID = torrent->id();
+    const bool isQueued = std::ranges::any_of(asConst(m_recheckQueue), [&torrentID](const RecheckJob &job)
+    {
+        return job.torrentID == torrentID;
+    });
+    if (isQueued)
+        return;
+
+    if (m_recheckQueue.isEmpty())
+    {
+        if (m_moveStorageQueue.isEmpty())
+            m_storageDevices.clear();
+
+        m_recheckTotalSize = 0;
+        m_recheckCheckedSize = 0;
+        m_recheckElapsedTime = 0;
+        if (!m_isRecheckQueuePaused)
+            m_recheckTimer.start();
+    }
+
+    // smaller torrents are checked first so that most torrents become available as soon as possible
+    const qint64 size = torrent->totalSize();
+    const auto position = std::ranges::upper_bound(asConst(m_recheckQueue), size, std::less(), &RecheckJob::size);
+    m_recheckQueue.insert(position, {.torrentID = torrentID, .path = torrent->actualStorageLocation(), .size = size});
+    m_recheckTotalSize += size;
+
+    startRecheckJobs();
+}
+
+RecheckQueueStatus SessionImpl::recheckQueueStatus() const
+{
+    RecheckQueueStatus status {.isPaused = m_isRecheckQueuePaused, .totalSize = m_recheckTotalSize};
+    status.jobs.reserve(m_recheckQueue.size());
+
+    qint64 checkedSize = m_recheckCheckedSize;
+    for (const RecheckJob &job : asConst(m_recheckQueue))
+    {
+        qreal progress = 0;
+        if (job.isActive)
+        {
+            ++status.activeCount;
+            if (const TorrentImpl *torrent = m_torrents.value(job.torrentID))
+                progress = torrent->progress();
+            checkedSize += static_cast<qint64>(job.size * progress);
+        }
+        else
+        {
+            ++status.queuedCount;
+        }
+
+        status.jobs.append({.torrentID = job.torrentID, .size = job.size, .isActive = job.isActive, .progress = progress});
+    }
+
+    status.checkedSize = checkedSize;
+
+    const qint64 elapsedTime = m_recheckElapsedTime + (m_recheckTimer.isValid() ? m_recheckTimer.elapsed() : 0);
+    if ((elapsedTime >= 1000) && (checkedSize > 0))
+    {
+        status.rate = (checkedSize * 1000) / elapsedTime;
+        if (status.rate > 0)
+            status.eta = std::max<qint64>(0, (status.totalSize - checkedSize)) / status.rate;
+    }
+
+    return status;
+}
+
+bool SessionImpl::isRecheckQueuePaused() const
+{
+    return m_isRecheckQueuePaused;
+}
+
+void SessionImpl::setRecheckQueuePaused(const bool paused)
+{
+    if (paused == m_isRecheckQueuePaused)
+        return;
+
+    m_isRecheckQueuePaused = paused;
+
+    for (const RecheckJob &job : asConst(m_recheckQueue))
+    {
+        if (!job.isActive)
+            continue;
+
+        if (TorrentImpl *torrent = m_torrents.value(job.torrentID))
+            torrent->setCheckingPaused(paused);
+    }
+
+    if (paused)
+    {
+        if (m_recheckTimer.isValid())
+            m_recheckElapsedTime += m_recheckTimer.elapsed();
+        m_recheckTimer.invalidate();
+        LogMsg(tr("Torrent recheck queue paused"));
+    }
+    else
+    {
+        if (!m_recheckQueue.isEmpty())
+            m_recheckTimer.start();
+        LogMsg(tr("Torrent recheck queue resumed"));
+        startRecheckJobs();
+    }
+}
+
+void SessionImpl::startRecheckJobs()
+{
+    if (m_isRecheckQueuePaused)
+        return;
+
+    // Checks of torrents residing on the same device compete for disk bandwidth so only
+    // a limited number of them is run at a time, devices are checked independently of each other.
+    QHash<QString, int> deviceJobsCounts;
+    for (const RecheckJob &job : asConst(m_recheckQueue))
+    {
+        if (job.isActive)
+            ++deviceJobsCounts[job.device];
+    }
+
+    // the queue is kept sorted by size
+    for (RecheckJob &job : m_recheckQueue)
+    {
+        if (job.isActive)
+            continue;
+
+        // the job waits until its device is resolved
+        const std::optional<QString> device = storageDevice(job.path);
+        if (!device)
+            continue;
+
+        int &deviceJobsCount = deviceJobsCounts[*device];
+        if (deviceJobsCount >= recheckJobsPerDevice())
+            continue;
+
+        TorrentImpl *torrent = m_torrents.value(job.torrentID);
+        if (!torrent) [[unlikely]]
+            continue;
+
+        job.device = *device;
+        job.isActive = true;
+        ++deviceJobsCount;
+        torrent->recheck();
+    }
+
+    if (activeCheckingLimit() != m_activeCheckingLimit)
+        configureDeferred();
+}
+
+void SessionImpl::finishRecheckJob(const TorrentID &id, const bool isCompleted)
+{
+    const auto iter = std::ranges::find_if(asConst(m_recheckQueue), [&id](const RecheckJob &job)
+    {
+        return job.torrentID == id;
+    });
+    if (iter == m_recheckQueue.cend())
+        return;
+
+    // the checking of torrent can be finished before the job is started (e.g. on startup)
+    if (isCompleted && !iter->isActive)
+        return;
+
+    if (isCompleted)
+        m_recheckCheckedSize += iter->size;
+    else
+        m_recheckTotalSize -= iter->size;
+
+    m_recheckQueue.erase(iter);
+    if (m_recheckQueue.isEmpty())
+    {
+        LogMsg(tr("All queued torrent rechecks are finished"));
+        if (m_recheckTimer.isValid())
+            m_recheckElapsedTime += m_recheckTimer.elapsed();
+        m_recheckTimer.invalidate();
+    }
+
+    startRecheckJobs();
+}
+
+void SessionImpl::abortActiveRecheckJob(const TorrentID &id)
+{
+    const bool isActive = std::ranges::any_of(asConst(m_recheckQueue), [&id](const RecheckJob &job)
+    {
+        return job.isActive && (job.torrentID == id);
+    });
+    if (isActive)
+        finishRecheckJob(id, false);
+}
+
+int SessionImpl::activeCheckingLimit() const
+{
+    // Torrents started by the recheck queue must not wait for each other in the checking queue of libtorrent
+    const int maxActiveChecking = maxActiveCheckingTorrents();
+    if (maxActiveChecking < 0)
+        return maxActiveChecking;
+
+    const auto activeRecheckJobsCount = std::ranges::count_if(asConst(m_recheckQueue), &RecheckJob::isActive);
+    return std::max(maxActiveChecking, static_cast<int>(activeRecheckJobsCount));
+}
+
 lt::torrent_handle SessionImpl::reloadTorrent(const lt::torrent_handle &currentHandle, lt::add_torrent_params params)
 {
+    const TorrentImpl *torrent = getTorrent(currentHandle);
     m_nativeSession->remove_torrent(currentHandle, lt::session::delete_partfile);
 
     auto *const extensionData = new ExtensionData;
+    // Reloaded torrent keeps its slot
+    extensionData->slotIndex = (torrent ? torrent->slotIndex() : -1);
     params.userdata = LTClientData(extensionData);
 #ifndef QBT_USES_LIBTORRENT2
     params.storage = customStorageConstructor;
@@ -5443,8 +6289,83 @@ lt::torrent_handle SessionImpl::reloadTorrent(const lt::torrent_handle &currentH
     return m_nativeSession->add_torrent(std::move(params));
 }
 
-void SessionImpl::moveTorrentStorage(const MoveStorageJob &job) const
+void SessionImpl::startMoveStorageJobs()
+{
+    // Jobs sharing a device (either source or destination one) are run one by one
+    // so they don't compete for disk bandwidth, jobs on unrelated devices are run concurrently.
+    QSet<QString> busyDevices;
+    QList<qsizetype> queuedJobIndexes;
+    for (qsizetype i = 0; i < m_moveStorageQueue.size(); ++i)
+    {
+        const MoveStorageJob &job = m_moveStorageQueue.at(i);
+        if (job.isActive())
+            busyDevices << job.sourceDevice << job.destinationDevice;
+        else
+            queuedJobIndexes.append(i);
+    }
+
+    std::ranges::stable_sort(queuedJobIndexes, std::greater(), [this](const qsizetype index)
+    {
+        return m_moveStorageQueue.at(index).priority;
+    });
+
+    for (const qsizetype index : asConst(queuedJobIndexes))
+    {
+        MoveStorageJob &job = m_moveStorageQueue[index];
+
+        // the job waits until its devices are resolved
+        const std::optional<QString> sourceDevice = storageDevice(job.sourcePath);
+        const std::optional<QString> destinationDevice = storageDevice(job.path);
+        if (!sourceDevice || !destinationDevice)
+            continue;
+
+        // job waiting for its devices doesn't block the jobs on other devices
+        if (busyDevices.contains(*sourceDevice) || busyDevices.contains(*destinationDevice))
+            continue;
+
+        // libtorrent can move torrent storage only once at a time
+        const bool isTorrentBusy = std::ranges::any_of(asConst(m_moveStorageQueue), [&job](const MoveStorageJob &otherJob)
+        {
+            return otherJob.isActive() && (otherJob.torrentHandle == job.torrentHandle);
+        });
+        if (isTorrentBusy)
+            continue;
+
+        job.sourceDevice = *sourceDevice;
+        job.destinationDevice = *destinationDevice;
+        busyDevices << job.sourceDevice << job.destinationDevice;
+        moveTorrentStorage(job);
+    }
+}
+
+std::optional<QString> SessionImpl::storageDevice(const Path &path)
+{
+    if (const auto iter = m_storageDevices.constFind(path); iter != m_storageDevices.cend())
+        return iter.value();
+
+    if (!m_resolvingStorageDevices.contains(path))
+    {
+        m_resolvingStorageDevices.insert(path);
+        invokeAsync([this, path]
+        {
+            const QString device = Utils::Fs::deviceID(path);
+            invoke([this, path, device]
+            {
+                m_resolvingStorageDevices.remove(path);
+                m_storageDevices.insert(path, device);
+                startMoveStorageJobs();
+                startRecheckJobs();
+            });
+        });
+    }
+
+    return std::nullopt;
+}
+
+void SessionImpl::moveTorrentStorage(MoveStorageJob &job) const
 {
+    job.timer.start();
+
     const TorrentImpl *torrent = getTorrent(job.torrentHandle);
     const QString torrentName = (torrent ? torrent->name() : getInfoHash(job.torrentHandle).toTorrentID().toString());
     LogMsg(tr("Start moving torrent. Torrent: \"%1\". Destination: \"%2\"").arg(torrentName, job.path.toString()));
@@ -5452,11 +6373,20 @@ void SessionImpl::moveTorrentStorage(const MoveStorageJob &job) const
     job.torrentHandle.move_storage(job.path.toString().toStdString(), toNative(job.mode));
 }
 
-void SessionImpl::handleMoveTorrentStorageJobFinished(const Path &newPath)
+void SessionImpl::handleMoveTorrentStorageJobFinished(const lt::torrent_handle &torrentHandle, const Path &newPath)
 {
-    const MoveStorageJob finishedJob = m_moveStorageQueue.takeFirst();
-    if (!m_moveStorageQueue.isEmpty())
-        moveTorrentStorage(m_moveStorageQueue.constFirst());
+    const auto finishedJobIter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [&torrentHandle](const MoveStorageJob &job)
+    {
+        return job.isActive() && (job.torrentHandle == torrentHandle);
+    });
+    Q_ASSERT(finishedJobIter != m_moveStorageQueue.cend());
+    if (finishedJobIter == m_moveStorageQueue.cend()) [[unlikely]]
+        return;
+
+    const MoveStorageJob finishedJob = *finishedJobIter;
+    m_moveStorageQueue.erase(finishedJobIter);
+    startMoveStorageJobs();
 
     const auto iter = std::ranges::find_if(asConst(m_moveStorageQueue)
             , [&finishedJob](const MoveStorageJob &job)
@@ -5528,6 +6458,61 @@ void SessionImpl::storeCategories() const
     }
 }
 
+void SessionImpl::storeBandwidthSchedulerRules() const
+{
+    QJsonArray jsonArray;
+    for (const BandwidthScheduleRule &rule : m_bandwidthSchedulerRules)
+        jsonArray.append(rule.toJSON());
+
+    const Path path = specialFolderLocation(SpecialFolder::Config) / BANDWIDTH_SCHEDULE_FILE_NAME;
+    const QByteArray data = QJsonDocument(jsonArray).toJson();
+    const nonstd::expected<void, QString> result = Utils::IO::saveToFile(path, data);
+    if (!result)
+    {
+        LogMsg(tr("Failed to save bandwidth scheduler rules. File: \"%1\". Error: \"%2\"")
+               .arg(path.toString(), result.error()), Log::WARNING);
+    }
+}
+
+void SessionImpl::loadBandwidthSchedulerRules()
+{
+    m_bandwidthSchedulerRules.clear();
+
+    const Path path = specialFolderLocation(SpecialFolder::Config) / BANDWIDTH_SCHEDULE_FILE_NAME;
+    if (!path.exists())
+        return;
+
+    const int fileMaxSize = 1024 * 1024;
+    const auto readResult = Utils::IO::readFile(path, fileMaxSize);
+    if (!readResult)
+    {
+        LogMsg(tr("Failed to load bandwidth scheduler rules. %1").arg(readResult.error().message), Log::WARNING);
+        return;
+    }
+
+    QJsonParseError jsonError;
+    const QJsonDocument jsonDoc = QJsonDocument::fromJson(readResult.value(), &jsonError);
+    if (jsonError.error != QJsonParseError::NoError)
+    {
+        LogMsg(tr("Failed to parse bandwidth scheduler rules. File: \"%1\". Error: \"%2\"")
+               .arg(path.toString(), jsonError.errorString()), Log::WARNING);
+        return;
+    }
+
+    if (!jsonDoc.isArray())
+    {
+        LogMsg(tr("Failed to load bandwidth scheduler rules. File: \"%1\". Error: \"Invalid data format\"")
+               .arg(path.toString()), Log::WARNING);
+        return;
+    }
+
+    for (const QJsonValue &ruleValue : asConst(jsonDoc.array()))
+    {
+        if (ruleValue.isObject())
+            m_bandwidthSchedulerRules.append(BandwidthScheduleRule::fromJSON(ruleValue.toObject()));
+    }
+}
+
 void SessionImpl::upgradeCategories()
 {
     const auto legacyCategories = SettingValue<QVariantMap>(u"BitTorrent/Session/Categories"_s).get();
@@ -5918,7 +6903,24 @@ void SessionImpl::handleAlert(lt::alert *alert)
 
 TorrentImpl *SessionImpl::createTorrent(const lt::torrent_handle &nativeHandle, LoadTorrentParams params)
 {
-    auto *const torrent = new TorrentImpl(this, nativeHandle, std::move(params));
+    int slotIndex = -1;
+    if (m_freeTorrentSlots.isEmpty())
+    {
+        slotIndex = m_torrentsBySlot.size();
+        m_torrentsBySlot.append(nullptr);
+    }
+    else
+    {
+        slotIndex = m_freeTorrentSlots.takeLast();
+    }
+
+    auto *const extensionData = static_cast<ExtensionData *>(params.ltAddTorrentParams.userdata);
+    extensionData->slotIndex = slotIndex;
+
+    auto *const torrent = new TorrentImpl(this, nativeHandle, std::move(params), slotIndex);
+    if (const auto swarmStatsIter = m_swarmStats.constFind(torrent->id()); swarmStatsIter != m_swarmStats.cend())
+        torrent->setSwarmStats(swarmStatsIter.value());
+    m_torrentsBySlot[slotIndex] = torrent;
     m_torrents.insert(torrent->id(), torrent);
     if (const InfoHash infoHash = torrent->infoHash(); infoHash.isHybrid())
         m_hybridTorrentsByAltID.insert(TorrentID::fromSHA1Hash(infoHash.v1()), torrent);
@@ -5938,6 +6940,19 @@ TorrentImpl *SessionImpl::createTorrent(const lt::torrent_handle &nativeHandle,
 
 TorrentImpl *SessionImpl::getTorrent(const lt::torrent_handle &nativeHandle) const
 {
+    // Resolve torrent by its slot stored in the userdata first. Slot can be already
+    // reused by another torrent if this handle belongs to the one being removed.
+    if (const auto *extensionData = static_cast<ExtensionData *>(nativeHandle.userdata()))
+    {
+        const int slotIndex = extensionData->slotIndex;
+        if ((slotIndex >= 0) && (slotIndex < m_torrentsBySlot.size()))
+        {
+            TorrentImpl *torrent = m_torrentsBySlot[slotIndex];
+            if (torrent && (torrent->nativeHandle() == nativeHandle))
+                return torrent;
+        }
+    }
+
     return m_torrents.value(getInfoHash(nativeHandle).toTorrentID());
 }
 
@@ -6041,6 +7056,9 @@ void SessionImpl::handleFileErrorAlert(const lt::file_error_alert *alert)
     torrent->handleFileError({.error = alert->error, .operation = alert->op});
 
     const TorrentID id = torrent->id();
+    // The checking can't be completed so don't hold the device for it
+    abortActiveRecheckJob(id);
+
     if (!m_recentErroredTorrents.contains(id))
     {
         m_recentErroredTorrents.insert(id);
@@ -6276,27 +7294,50 @@ void SessionImpl::handleAlertsDroppedAlert(const lt::alerts_dropped_alert *alert
 
 void SessionImpl::handleStorageMovedAlert(const lt::storage_moved_alert *alert)
 {
-    Q_ASSERT(!m_moveStorageQueue.isEmpty());
+    const auto currentJobIter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [alert](const MoveStorageJob &job)
+    {
+        return job.isActive() && (job.torrentHandle == alert->handle);
+    });
+    Q_ASSERT(currentJobIter != m_moveStorageQueue.cend());
+    if (currentJobIter == m_moveStorageQueue.cend()) [[unlikely]]
+        return;
 
-    const MoveStorageJob &currentJob = m_moveStorageQueue.constFirst();
-    Q_ASSERT(currentJob.torrentHandle == alert->handle);
+    const MoveStorageJob &currentJob = *currentJobIter;
 
     const Path newPath {QString::fromUtf8(alert->storage_path())};
     Q_ASSERT(newPath == currentJob.path);
 
+    if (const qint64 elapsedTime = currentJob.timer.elapsed(); (currentJob.size > 0) && (elapsedTime > 0))
+    {
+        // moving within the same file system is mostly instant so it doesn't tell anything about throughput
+        if (currentJob.sourceDevice != currentJob.destinationDevice)
+        {
+            const qint64 throughput = (currentJob.size * 1000) / elapsedTime;
+            qint64 &avgThroughput = m_moveStorageThroughputs[{currentJob.sourceDevice, currentJob.destinationDevice}];
+            avgThroughput = (avgThroughput > 0) ? (((avgThroughput * 3) + throughput) / 4) : throughput;
+        }
+    }
+
     TorrentImpl *torrent = getTorrent(currentJob.torrentHandle);
     const QString torrentName = (torrent ? torrent->name() : getInfoHash(currentJob.torrentHandle).toTorrentID().toString());
     LogMsg(tr("Moved torrent successfully. Torrent: \"%1\". Destination: \"%2\"").arg(torrentName, newPath.toString()));
 
-    handleMoveTorrentStorageJobFinished(newPath);
+    handleMoveTorrentStorageJobFinished(alert->handle, newPath);
 }
 
 void SessionImpl::handleStorageMovedFailedAlert(const lt::storage_moved_failed_alert *alert)
 {
-    Q_ASSERT(!m_moveStorageQueue.isEmpty());
+    const auto currentJobIter = std::ranges::find_if(asConst(m_moveStorageQueue)
+            , [alert](const MoveStorageJob &job)
+    {
+        return job.isActive() && (job.torrentHandle == alert->handle);
+    });
+    Q_ASSERT(currentJobIter != m_moveStorageQueue.cend());
+    if (currentJobIter == m_moveStorageQueue.cend()) [[unlikely]]
+        return;
 
-    const MoveStorageJob &currentJob = m_moveStorageQueue.constFirst();
-    Q_ASSERT(currentJob.torrentHandle == alert->handle);
+    const MoveStorageJob &currentJob = *currentJobIter;
 
     TorrentImpl *torrent = getTorrent(currentJob.torrentHandle);
     const QString torrentName = (torrent ? torrent->name() : getInfoHash(currentJob.torrentHandle).toTorrentID().toString());
@@ -6306,13 +7347,14 @@ void SessionImpl::handleStorageMovedFailedAlert(const lt::storage_moved_failed_a
     LogMsg(tr("Failed to move torrent. Torrent: \"%1\". Source: \"%2\". Destination: \"%3\". Reason: \"%4\"")
            .arg(torrentName, currentLocation.toString(), currentJob.path.toString(), errorMessage), Log::WARNING);
 
-    handleMoveTorrentStorageJobFinished(currentLocation);
+    handleMoveTorrentStorageJobFinished(alert->handle, currentLocation);
 }
 
 void SessionImpl::handleStateUpdateAlert(const lt::state_update_alert *alert)
 {
     QList<Torrent *> updatedTorrents;
     updatedTorrents.reserve(static_cast<decltype(updatedTorrents)::size_type>(alert->status.size()));
+    QList<TorrentID> erroredTorrents;
 
     for (const lt::torrent_status &status : alert->status)
     {
@@ -6322,11 +7364,22 @@ void SessionImpl::handleStateUpdateAlert(const lt::state_update_alert *alert)
 
         torrent->handleStateUpdate(status);
         updatedTorrents.push_back(torrent);
+
+        if (status.errc)
+            erroredTorrents.append(torrent->id());
     }
 
+    // A torrent that has got an error while being checked won't complete its checking
+    for (const TorrentID &id : asConst(erroredTorrents))
+        abortActiveRecheckJob(id);
+
+    updateBandwidthGroups();
+
     if (!updatedTorrents.isEmpty())
         emit torrentsUpdated(updatedTorrents);
 
+    updateTrackerEntryStatuses();
+
     if (m_needSaveTorrentsQueue)
         saveTorrentsQueue();
 
@@ -6336,6 +7389,178 @@ void SessionImpl::handleStateUpdateAlert(const lt::state_update_alert *alert)
         enqueueRefresh();
 }
 
+void SessionImpl::updateBandwidthGroups()
+{
+    struct Group
+    {
+        BandwidthGroupStatus status;
+        QList<TorrentImpl *> activeTorrents;
+        QList<TorrentImpl *> idleTorrents;
+    };
+
+    QList<Group> groups;
+    for (auto it = m_categories.cbegin(); it != m_categories.cend(); ++it)
+    {
+        const CategoryOptions &options = it.value();
+        if ((options.downloadLimit > 0) || (options.uploadLimit > 0))
+        {
+            groups.append({.status = {.type = BandwidthGroupType::Category, .name = it.key()
+                    , .limits = {.downloadLimit = options.downloadLimit, .uploadLimit = options.uploadLimit}}});
+        }
+    }
+    for (auto it = m_tagSpeedLimits.cbegin(); it != m_tagSpeedLimits.cend(); ++it)
+        groups.append({.status = {.type = BandwidthGroupType::Tag, .name = it.key().toString(), .limits = it.value()}});
+
+    // limits set by the bandwidth scheduler take precedence over the configured ones
+    const auto applyScheduledGroupLimits = [&groups](const BandwidthGroupType type, const QString &name, const BandwidthScheduleLimits &scheduled)
+    {
+        auto groupIt = std::find_if(groups.begin(), groups.end(), [type, &name](const Group &group)
+        {
+            return (group.status.type == type) && (group.status.name == name);
+        });
+        if (groupIt == groups.end())
+        {
+            groups.append({.status = {.type = type, .name = name}});
+            groupIt = std::prev(groups.end());
+        }
+
+        BandwidthGroupLimits &limits = groupIt->status.limits;
+        if (scheduled.downloadLimit >= 0)
+            limits.downloadLimit = scheduled.downloadLimit;
+        if (scheduled.uploadLimit >= 0)
+            limits.uploadLimit = scheduled.uploadLimit;
+    };
+    for (auto it = m_scheduledLimits.categories.cbegin(); it != m_scheduledLimits.categories.cend(); ++it)
+    {
+        if (m_categories.contains(it.key()))
+            applyScheduledGroupLimits(BandwidthGroupType::Category, it.key(), it.value());
+    }
+    for (auto it = m_scheduledLimits.tags.cbegin(); it != m_scheduledLimits.tags.cend(); ++it)
+    {
+        if (m_tags.contains(Tag(it.key())))
+            applyScheduledGroupLimits(BandwidthGroupType::Tag, it.key(), it.value());
+    }
+    groups.removeIf([](const Group &group) { return (group.status.limits == BandwidthGroupLimits()); });
+
+    if (groups.isEmpty() && m_bandwidthGroupTorrents.isEmpty())
+    {
+        m_bandwidthGroups.clear();
+        return;
+    }
+
+    for (Group &group : groups)
+    {
+        TorrentFilter filter;
+        if (group.status.type == BandwidthGroupType::Category)
+            filter.setCategory(group.status.name);
+        else
+            filter.setTag(Tag(group.status.name));
+
+        const QList<Torrent *> torrents = m_torrentFilterIndex->torrents(filter);
+        for (Torrent *const torrent : torrents)
+        {
+            ++group.status.torrentsCount;
+            group.status.downloadRate += torrent->downloadPayloadRate();
+            group.status.uploadRate += torrent->uploadPayloadRate();
+            if (torrent->isStopped() || torrent->isErrored())
+                continue;
+
+            // Only the torrents that are actually transferring take part in the sharing
+            auto *torrentImpl = static_cast<TorrentImpl *>(torrent);
+            if (!torrent->isQueued() && (torrent->peersCount() > 0))
+                group.activeTorrents.append(torrentImpl);
+            else
+                group.idleTorrents.append(torrentImpl);
+        }
+    }
+
+    // A torrent using most of its current allocation is likely to be throttled,
+    // so it asks for more. Otherwise it asks for a bit more than it actually uses.
+    const int minDemand = 4096;
+    const auto demand = [minDemand](const int rate, const int allocated) -> int
+    {
+        if ((allocated > 0) && (rate >= (allocated - (allocated / 5))))
+            return static_cast<int>(std::min<qint64>((static_cast<qint64>(allocated) * 2), std::numeric_limits<int>::max()));
+        return rate + std::max((rate / 4), minDemand);
+    };
+
+    // The torrent gets the smallest of the shares it is given by its groups
+    QHash<TorrentID, BandwidthGroupLimits> torrentLimits;
+    const auto applyShares = [&torrentLimits](const QList<TorrentImpl *> &torrents, const QList<int> &shares, int BandwidthGroupLimits::*limit)
+    {
+        for (qsizetype i = 0; i < torrents.size(); ++i)
+        {
+            int &torrentLimit = torrentLimits[torrents[i]->id()].*limit;
+            torrentLimit = (torrentLimit > 0) ? std::min(torrentLimit, shares[i]) : shares[i];
+        }
+    };
+
+    for (const Group &group : asConst(groups))
+    {
+        // Idle torrents are kept limited so that they don't exceed the group limit
+        // until they get their share once they start transferring
+        if (!group.idleTorrents.isEmpty())
+        {
+            const BandwidthGroupLimits &limits = group.status.limits;
+            if (limits.downloadLimit > 0)
+            {
+                applyShares(group.idleTorrents, QList<int>(group.idleTorrents.size(), std::min(minDemand, limits.downloadLimit))
+                        , &BandwidthGroupLimits::downloadLimit);
+            }
+            if (limits.uploadLimit > 0)
+            {
+                applyShares(group.idleTorrents, QList<int>(group.idleTorrents.size(), std::min(minDemand, limits.uploadLimit))
+                        , &BandwidthGroupLimits::uploadLimit);
+            }
+        }
+
+        const QList<TorrentImpl *> &torrents = group.activeTorrents;
+        if (torrents.isEmpty())
+            continue;
+
+        if (const int limit = group.status.limits.downloadLimit; limit > 0)
+        {
+            QList<int> demands;
+            demands.reserve(torrents.size());
+            for (const TorrentImpl *torrent : torrents)
+                demands.append(demand(torrent->downloadPayloadRate(), torrent->bandwidthGroupLimits().downloadLimit));
+            applyShares(torrents, shareBandwidth(limit, demands), &BandwidthGroupLimits::downloadLimit);
+        }
+
+        if (const int limit = group.status.limits.uploadLimit; limit > 0)
+        {
+            QList<int> demands;
+            demands.reserve(torrents.size());
+            for (const TorrentImpl *torrent : torrents)
+                demands.append(demand(torrent->uploadPayloadRate(), torrent->bandwidthGroupLimits().uploadLimit));
+            applyShares(torrents, shareBandwidth(limit, demands), &BandwidthGroupLimits::uploadLimit);
+        }
+    }
+
+    // release torrents which are no longer limited by any group
+    for (const TorrentID &torrentID : asConst(m_bandwidthGroupTorrents))
+    {
+        if (!torrentLimits.contains(torrentID))
+        {
+            if (TorrentImpl *torrent = m_torrents.value(torrentID))
+                torrent->setBandwidthGroupLimits({});
+        }
+    }
+
+    m_bandwidthGroupTorrents.clear();
+    for (auto it = torrentLimits.cbegin(); it != torrentLimits.cend(); ++it)
+    {
+        if (TorrentImpl *torrent = m_torrents.value(it.key()))
+            torrent->setBandwidthGroupLimits(it.value());
+        m_bandwidthGroupTorrents.insert(it.key());
+    }
+
+    m_bandwidthGroups.clear();
+    m_bandwidthGroups.reserve(groups.size());
+    for (const Group &group : asConst(groups))
+        m_bandwidthGroups.append(group.status);
+}
+
 void SessionImpl::handleSocks5Alert(const lt::socks5_alert *alert) const
 {
     if (alert->error)
@@ -6364,12 +7589,8 @@ void SessionImpl::handleTrackerAlert(const lt::tracker_alert *alert)
     if (!torrent)
         return;
 
-    [[maybe_unused]] const QMutexLocker updatedTrackerStatusesLocker {&m_updatedTrackerStatusesMutex};
-
-    const auto prevSize = m_updatedTrackerStatuses.size();
+    // Statuses are collected here and applied in batch on the next refresh
     QMap<int, int> &updateInfo = m_updatedTrackerStatuses[torrent->nativeHandle()][std::string(alert->tracker_url())][alert->local_endpoint];
-    if (prevSize < m_updatedTrackerStatuses.size())
-        updateTrackerEntryStatuses(torrent->nativeHandle());
 
     if (alert->type() == lt::tracker_reply_alert::alert_type)
     {
@@ -6441,7 +7662,10 @@ void SessionImpl::handleFilePrioAlert(const lt::file_prio_alert *alert)
 void SessionImpl::handleTorrentCheckedAlert(const lt::torrent_checked_alert *alert)
 {
     if (TorrentImpl *torrent = getTorrent(alert->handle)) [[likely]]
+    {
+        finishRecheckJob(torrent->id(), true);
         torrent->handleTorrentChecked();
+    }
 }
 
 void SessionImpl::handleTorrentFinishedAlert([[maybe_unused]] const lt::torrent_finished_alert *alert)
@@ -6554,27 +7778,45 @@ void SessionImpl::loadStatistics()
     m_previouslyUploaded = value[u"AlltimeUL"_s].toLongLong();
 }
 
-void SessionImpl::updateTrackerEntryStatuses(lt::torrent_handle torrentHandle)
+void SessionImpl::updateTrackerEntryStatuses()
 {
-    invokeAsync([this, torrentHandle = std::move(torrentHandle)]
+    // Don't queue another batch until the previous one is applied,
+    // statuses updated meanwhile are merged into the next one
+    if (m_updatedTrackerStatuses.isEmpty() || m_isUpdatingTrackerEntryStatuses)
+        return;
+
+    m_isUpdatingTrackerEntryStatuses = true;
+
+    invokeAsync([this, updatedTrackerStatuses = std::exchange(m_updatedTrackerStatuses, {})]() mutable
     {
-        try
+        QHash<lt::torrent_handle, std::vector<lt::announce_entry>> nativeTrackers;
+        nativeTrackers.reserve(updatedTrackerStatuses.size());
+        for (auto it = updatedTrackerStatuses.cbegin(); it != updatedTrackerStatuses.cend(); ++it)
         {
-            std::vector<lt::announce_entry> nativeTrackers = torrentHandle.trackers();
+            try
+            {
+                nativeTrackers.emplace(it.key(), it.key().trackers());
+            }
+            catch (const std::exception &)
+            {
+            }
+        }
 
-            QMutexLocker updatedTrackerStatusesLocker {&m_updatedTrackerStatusesMutex};
-            QHash<std::string, QHash<lt::tcp::endpoint, QMap<int, int>>> updatedTrackers = m_updatedTrackerStatuses.take(torrentHandle);
-            updatedTrackerStatusesLocker.unlock();
+        invoke([this, nativeTrackers = std::move(nativeTrackers), updatedTrackerStatuses = std::move(updatedTrackerStatuses)]
+        {
+            m_isUpdatingTrackerEntryStatuses = false;
 
-            invoke([this, infoHash = torrentHandle.info_hash(), nativeTrackers = std::move(nativeTrackers), updatedTrackers = std::move(updatedTrackers)]
+            for (auto it = nativeTrackers.cbegin(); it != nativeTrackers.cend(); ++it)
             {
-                TorrentImpl *torrent = m_torrents.value(infoHash);
+                TorrentImpl *torrent = getTorrent(it.key());
                 if (!torrent || torrent->isStopped())
-                    return;
+                    continue;
+
+                const QHash<std::string, QHash<lt::tcp::endpoint, QMap<int, int>>> updatedTrackers = updatedTrackerStatuses.value(it.key());
 
                 QHash<QString, TrackerEntryStatus> trackers;
                 trackers.reserve(updatedTrackers.size());
-                for (const lt::announce_entry &announceEntry : nativeTrackers)
+                for (const lt::announce_entry &announceEntry : it.value())
                 {
                     const auto updatedTrackersIter = updatedTrackers.find(announceEntry.url);
                     if (updatedTrackersIter == updatedTrackers.end())
@@ -6587,11 +7829,8 @@ void SessionImpl::updateTrackerEntryStatuses(lt::torrent_handle torrentHandle)
                 }
 
                 emit trackerEntryStatusesUpdated(torrent, trackers);
-            });
-        }
-        catch (const std::exception &)
-        {
-        }
+            }
+        });
     });
 }
 
@@ -31,6 +31,7 @@
 
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -43,7 +44,6 @@
 #include <QHash>
 #include <QList>
 #include <QMap>
-#include <QMutex>
 #include <QPointer>
 #include <QSet>
 #include <QThreadPool>
@@ -52,10 +52,16 @@
 #include "base/settingvalue.h"
 #include "base/utils/thread.h"
 #include "addtorrentparams.h"
+#include "bandwidthgroup.h"
+#include "bandwidthschedule.h"
 #include "cachestatus.h"
 #include "categoryoptions.h"
+#include "movestoragejobstatus.h"
+#include "recheckqueuestatus.h"
+#include "seedingoptimizer.h"
 #include "session.h"
 #include "sessionstatus.h"
+#include "swarmstats.h"
 #include "torrentinfo.h"
 
 class QString;
@@ -69,6 +75,7 @@ class FileSearcher;
 class FilterParserThread;
 class FreeDiskSpaceChecker;
 class NativeSessionExtension;
+class TorrentFilterIndex;
 
 struct FileSearchResult;
 
@@ -84,6 +91,8 @@ namespace BitTorrent
     class TorrentDescriptor;
     class TorrentImpl;
     class Tracker;
+    class TrackerIndex;
+    class TrackerScraper;
 
     struct LoadTorrentParams;
     struct TrackerEntry;
@@ -169,6 +178,10 @@ namespace BitTorrent
         bool addTag(const Tag &tag) override;
         bool removeTag(const Tag &tag) override;
 
+        BandwidthGroupLimits tagSpeedLimits(const Tag &tag) const override;
+        void setTagSpeedLimits(const Tag &tag, const BandwidthGroupLimits &limits) override;
+        QList<BandwidthGroupStatus> bandwidthGroups() const override;
+
         bool isAutoTMMDisabledByDefault() const override;
         void setAutoTMMDisabledByDefault(bool value) override;
         bool isDisableAutoTMMWhenCategoryChanged() const override;
@@ -234,6 +247,12 @@ namespace BitTorrent
         void setAltGlobalSpeedLimitEnabled(bool enabled) override;
         bool isBandwidthSchedulerEnabled() const override;
         void setBandwidthSchedulerEnabled(bool enabled) override;
+        QList<BandwidthScheduleRule> bandwidthSchedulerRules() const override;
+        void setBandwidthSchedulerRules(const QList<BandwidthScheduleRule> &rules) override;
+        bool isBandwidthSchedulerRulesEnabled() const override;
+        void setBandwidthSchedulerRulesEnabled(bool enabled) override;
+        int bandwidthSchedulerRampTime() const override;
+        void setBandwidthSchedulerRampTime(int seconds) override;
 
         bool isPerformanceWarningEnabled() const override;
         void setPerformanceWarningEnabled(bool enable) override;
@@ -259,6 +278,8 @@ namespace BitTorrent
         void setEncryption(int state) override;
         int maxActiveCheckingTorrents() const override;
         void setMaxActiveCheckingTorrents(int val) override;
+        int recheckJobsPerDevice() const override;
+        void setRecheckJobsPerDevice(int count) override;
         bool isI2PEnabled() const override;
         void setI2PEnabled(bool enabled) override;
         QString I2PAddress() const override;
@@ -353,6 +374,19 @@ namespace BitTorrent
         void setUploadRateForSlowTorrents(int rateInKibiBytes) override;
         int slowTorrentsInactivityTimer() const override;
         void setSlowTorrentsInactivityTimer(int timeInSeconds) override;
+        bool isSeedingOptimizerEnabled() const override;
+        void setSeedingOptimizerEnabled(bool enabled) override;
+        bool isSeedingOptimizerSimulationEnabled() const override;
+        void setSeedingOptimizerSimulationEnabled(bool enabled) override;
+        int seedingOptimizerInterval() const override;
+        void setSeedingOptimizerInterval(int minutes) override;
+        SeedingOptimizerStatus seedingOptimizerStatus() const override;
+        bool isSwarmStatsScrapingEnabled() const override;
+        void setSwarmStatsScrapingEnabled(bool enabled) override;
+        int swarmStatsTTL() const override;
+        void setSwarmStatsTTL(int minutes) override;
+        bool isMetadataUnloadingEnabled() const override;
+        void setMetadataUnloadingEnabled(bool enabled) override;
         int outgoingPortsMin() const override;
         void setOutgoingPortsMin(int min) override;
         int outgoingPortsMax() const override;
@@ -436,6 +470,10 @@ namespace BitTorrent
         Torrent *findTorrent(const InfoHash &infoHash) const override;
         QList<Torrent *> torrents() const override;
         qsizetype torrentsCount() const override;
+        Torrent *torrentAt(int slotIndex) const override;
+        int torrentSlotsCount() const override;
+        const TrackerIndex *trackerIndex() const override;
+        const TorrentFilterIndex *torrentFilterIndex() const override;
         const SessionStatus &status() const override;
         const CacheStatus &cacheStatus() const override;
         bool isListening() const override;
@@ -453,6 +491,13 @@ namespace BitTorrent
         void topTorrentsQueuePos(const QList<TorrentID> &ids) override;
         void bottomTorrentsQueuePos(const QList<TorrentID> &ids) override;
 
+        QList<MoveStorageJobStatus> moveStorageJobs() const override;
+        void setMoveStorageJobPriority(const TorrentID &id, int priority) override;
+
+        RecheckQueueStatus recheckQueueStatus() const override;
+        bool isRecheckQueuePaused() const override;
+        void setRecheckQueuePaused(bool paused) override;
+
         QString lastExternalIPv4Address() const override;
         QString lastExternalIPv6Address() const override;
 
@@ -482,6 +527,7 @@ namespace BitTorrent
         void handleTorrentStorageMovingStateChanged(TorrentImpl *torrent);
 
         bool addMoveTorrentStorageJob(TorrentImpl *torrent, const Path &newPath, MoveStorageMode mode, MoveStorageContext context);
+        void addRecheckJob(TorrentImpl *torrent);
 
         lt::torrent_handle reloadTorrent(const lt::torrent_handle &currentHandle, lt::add_torrent_params params);
 
@@ -531,6 +577,23 @@ namespace BitTorrent
             Path path;
             MoveStorageMode mode {};
             MoveStorageContext context {};
+            int priority = 0;
+            qint64 size = 0;
+            Path sourcePath;
+            QString sourceDevice;  // resolved when job becomes active
+            QString destinationDevice;  // resolved when job becomes active
+            QElapsedTimer timer;  // started when job becomes active
+
+            bool isActive() const { return timer.isValid(); }
+        };
+
+        struct RecheckJob
+        {
+            TorrentID torrentID;
+            Path path;
+            QString device;  // resolved when job becomes active
+            qint64 size = 0;
+            bool isActive = false;
         };
 
         struct RemovingTorrentData
@@ -561,7 +624,12 @@ namespace BitTorrent
         QStringList getListeningIPs() const;
         void configureListeningInterface();
         void enableTracker(bool enable);
-        void enableBandwidthScheduler();
+        void configureBandwidthScheduler();
+        void applyScheduledLimits(const BandwidthScheduleState &state);
+        int appliedDownloadSpeedLimit() const;
+        int appliedUploadSpeedLimit() const;
+        void loadBandwidthSchedulerRules();
+        void storeBandwidthSchedulerRules() const;
         void populateAdditionalTrackers();
         void enableIPFilter();
         void disableIPFilter();
@@ -576,6 +644,12 @@ namespace BitTorrent
         bool addTorrent_impl(const TorrentDescriptor &source, const AddTorrentParams &addTorrentParams);
 
         void updateSeedingLimitTimer();
+        void runSeedingOptimizer();
+        void releaseSeedingSlots();
+        void refreshSwarmStats();
+        void handleSwarmStatsReceived(const QHash<TorrentID, SwarmStats> &stats);
+        void storeSwarmStats();
+        void unloadInactiveMetadata();
         void exportTorrentFile(const Torrent *torrent, const Path &folderPath);
 
         void handleAlert(lt::alert *alert);
@@ -630,8 +704,14 @@ namespace BitTorrent
         void fetchPendingAlerts(lt::time_duration time = lt::time_duration::zero());
         void endAlertSequence(int alertType, qsizetype alertCount);
 
-        void moveTorrentStorage(const MoveStorageJob &job) const;
-        void handleMoveTorrentStorageJobFinished(const Path &newPath);
+        void startMoveStorageJobs();
+        void startRecheckJobs();
+        void finishRecheckJob(const TorrentID &id, bool isCompleted);
+        void abortActiveRecheckJob(const TorrentID &id);
+        std::optional<QString> storageDevice(const Path &path);
+        int activeCheckingLimit() const;
+        void moveTorrentStorage(MoveStorageJob &job) const;
+        void handleMoveTorrentStorageJobFinished(const lt::torrent_handle &torrentHandle, const Path &newPath);
         void processPendingFinishedTorrents();
 
         void loadCategories();
@@ -642,7 +722,9 @@ namespace BitTorrent
         void saveStatistics() const;
         void loadStatistics();
 
-        void updateTrackerEntryStatuses(lt::torrent_handle torrentHandle);
+        void updateTrackerEntryStatuses();
+        void updateBandwidthGroups();
+        void storeTagSpeedLimits();
 
         void handleRemovedTorrent(const TorrentID &torrentID, const QString &partfileRemoveError = {});
 
@@ -687,6 +769,12 @@ namespace BitTorrent
         CachedSettingValue<int> m_downloadRateForSlowTorrents;
         CachedSettingValue<int> m_uploadRateForSlowTorrents;
         CachedSettingValue<int> m_slowTorrentsInactivityTimer;
+        CachedSettingValue<bool> m_isSeedingOptimizerEnabled;
+        CachedSettingValue<bool> m_isSeedingOptimizerSimulationEnabled;
+        CachedSettingValue<int> m_seedingOptimizerInterval;
+        CachedSettingValue<bool> m_isSwarmStatsScrapingEnabled;
+        CachedSettingValue<int> m_swarmStatsTTL;
+        CachedSettingValue<bool> m_isMetadataUnloadingEnabled;
         CachedSettingValue<int> m_outgoingPortsMin;
         CachedSettingValue<int> m_outgoingPortsMax;
         CachedSettingValue<int> m_UPnPLeaseDuration;
@@ -734,6 +822,8 @@ namespace BitTorrent
         CachedSettingValue<int> m_altGlobalUploadSpeedLimit;
         CachedSettingValue<bool> m_isAltGlobalSpeedLimitEnabled;
         CachedSettingValue<bool> m_isBandwidthSchedulerEnabled;
+        CachedSettingValue<bool> m_isBandwidthSchedulerRulesEnabled;
+        CachedSettingValue<int> m_bandwidthSchedulerRampTime;
         CachedSettingValue<bool> m_isPerformanceWarningEnabled;
         CachedSettingValue<int> m_saveResumeDataInterval;
         CachedSettingValue<int> m_saveStatisticsInterval;
@@ -746,10 +836,12 @@ namespace BitTorrent
         CachedSettingValue<QString> m_networkInterfaceAddress;
         CachedSettingValue<int> m_encryption;
         CachedSettingValue<int> m_maxActiveCheckingTorrents;
+        CachedSettingValue<int> m_recheckJobsPerDevice;
         CachedSettingValue<bool> m_isProxyPeerConnectionsEnabled;
         CachedSettingValue<ChokingAlgorithm> m_chokingAlgorithm;
         CachedSettingValue<SeedChokingAlgorithm> m_seedChokingAlgorithm;
         CachedSettingValue<QStringList> m_storedTags;
+        CachedSettingValue<QStringList> m_storedTagSpeedLimits;
         CachedSettingValue<ShareLimitAction> m_shareLimitAction;
         CachedSettingValue<Path> m_savePath;
         CachedSettingValue<Path> m_downloadPath;
@@ -814,10 +906,14 @@ namespace BitTorrent
         bool m_needSaveTorrentsQueue = false;
         bool m_refreshEnqueued = false;
         QTimer *m_seedingLimitTimer = nullptr;
+        QTimer *m_seedingOptimizerTimer = nullptr;
+        QTimer *m_swarmStatsTimer = nullptr;
+        QTimer *m_metadataUnloadTimer = nullptr;
         QTimer *m_resumeDataTimer = nullptr;
         // IP filtering
         QPointer<FilterParserThread> m_filterParser;
         QPointer<BandwidthScheduler> m_bwScheduler;
+        QPointer<TrackerScraper> m_trackerScraper;
         // Tracker
         QPointer<Tracker> m_tracker;
 
@@ -834,10 +930,22 @@ namespace BitTorrent
 
         QHash<TorrentID, TorrentImpl *> m_torrents;
         QHash<TorrentID, TorrentImpl *> m_hybridTorrentsByAltID;
+        QList<TorrentImpl *> m_torrentsBySlot;
+        QList<int> m_freeTorrentSlots;
         QHash<TorrentID, RemovingTorrentData> m_removingTorrents;
         QHash<TorrentID, TorrentID> m_changedTorrentIDs;
         QMap<QString, CategoryOptions> m_categories;
         TagSet m_tags;
+        QHash<Tag, BandwidthGroupLimits> m_tagSpeedLimits;
+        QList<BandwidthGroupStatus> m_bandwidthGroups;
+        QSet<TorrentID> m_bandwidthGroupTorrents;
+        QList<BandwidthScheduleRule> m_bandwidthSchedulerRules;
+        BandwidthScheduleState m_scheduledLimits;
+        SeedingOptimizer m_seedingOptimizer;
+        SeedingOptimizerStatus m_seedingOptimizerStatus;
+        qsizetype m_seedingOptimizerScrapeOffset = 0;
+        QHash<TorrentID, SwarmStats> m_swarmStats;
+        QHash<TorrentID, SwarmStats> m_changedSwarmStats;
 
         std::vector<lt::alert *> m_alerts;  // make it a class variable so it can preserve its allocated `capacity`
         qsizetype m_receivedAddTorrentAlertsCount = 0;
@@ -845,8 +953,9 @@ namespace BitTorrent
 
         // This field holds amounts of peers reported by trackers in their responses to announces
         // (torrent.tracker_name.tracker_local_endpoint.protocol_version.num_peers)
+        // collected since the last refresh
         QHash<lt::torrent_handle, QHash<std::string, QHash<lt::tcp::endpoint, QMap<int, int>>>> m_updatedTrackerStatuses;
-        QMutex m_updatedTrackerStatusesMutex;
+        bool m_isUpdatingTrackerEntryStatuses = false;
 
         // I/O errored torrents
         QSet<TorrentID> m_recentErroredTorrents;
@@ -858,7 +967,23 @@ namespace BitTorrent
         SessionStatus m_status;
         CacheStatus m_cacheStatus;
 
+        // Devices of the paths used by move storage and recheck jobs,
+        // they are resolved asynchronously since it accesses the file system
+        QHash<Path, QString> m_storageDevices;
+        QSet<Path> m_resolvingStorageDevices;
+
         QList<MoveStorageJob> m_moveStorageQueue;
+        // <<source device, destination device>, bytes per second>
+        QHash<std::pair<QString, QString>, qint64> m_moveStorageThroughputs;
+
+        QList<RecheckJob> m_recheckQueue;
+        bool m_isRecheckQueuePaused = false;
+        // Statistics of the jobs enqueued since the queue was last empty
+        qint64 m_recheckTotalSize = 0;
+        qint64 m_recheckCheckedSize = 0;
+        qint64 m_recheckElapsedTime = 0;
+        QElapsedTimer m_recheckTimer;  // runs while the queue isn't paused
+        mutable int m_activeCheckingLimit = 0;
 
         QString m_lastExternalIPv4Address;
         QString m_lastExternalIPv6Address;
@@ -879,6 +1004,9 @@ namespace BitTorrent
         QTimer *m_freeDiskSpaceCheckingTimer = nullptr;
         qint64 m_freeDiskSpace = -1;
 
+        TrackerIndex *m_trackerIndex = nullptr;
+        TorrentFilterIndex *m_torrentFilterIndex = nullptr;
+
         friend void Session::initInstance();
         friend void Session::freeInstance();
         friend Session *Session::instance();
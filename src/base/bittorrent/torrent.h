@@ -38,6 +38,7 @@
 #include "base/pathfwd.h"
 #include "base/tagset.h"
 #include "sharelimitaction.h"
+#include "swarmstats.h"
 #include "torrentcontenthandler.h"
 
 class QBitArray;
@@ -140,6 +141,9 @@ namespace BitTorrent
         virtual Session *session() const = 0;
 
         virtual InfoHash infoHash() const = 0;
+        // Dense index that doesn't change while torrent is loaded in the session.
+        // It is reused by another torrent after this one is removed.
+        virtual int slotIndex() const = 0;
         virtual QString name() const = 0;
         virtual QDateTime creationDate() const = 0;
         virtual QString creator() const = 0;
@@ -270,6 +274,7 @@ namespace BitTorrent
         virtual int totalSeedsCount() const = 0;
         virtual int totalPeersCount() const = 0;
         virtual int totalLeechersCount() const = 0;
+        virtual SwarmStats swarmStats() const = 0;
         virtual int downloadLimit() const = 0;
         virtual int uploadLimit() const = 0;
         virtual bool superSeeding() const = 0;
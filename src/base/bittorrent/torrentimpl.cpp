@@ -50,6 +50,9 @@
 #include <QByteArray>
 #include <QCache>
 #include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
 #include <QFuture>
 #include <QPointer>
 #include <QPromise>
@@ -60,6 +63,7 @@
 #include "base/exceptions.h"
 #include "base/global.h"
 #include "base/logger.h"
+#include "base/memoryusagetracker.h"
 #include "base/preferences.h"
 #include "base/types.h"
 #include "base/utils/fs.h"
@@ -89,6 +93,10 @@ using namespace BitTorrent;
 
 namespace
 {
+    // rough sizes of libtorrent peer connection (along with its buffers) and of peer list entry
+    const qint64 PEER_CONNECTION_SIZE = 32 * 1024;
+    const qint64 PEER_ENTRY_SIZE = 64;
+
     lt::announce_entry makeNativeAnnounceEntry(const QString &url, const int tier)
     {
         lt::announce_entry entry {url.toStdString()};
@@ -295,11 +303,40 @@ namespace
     {
         return ((value < 0) || (value == std::numeric_limits<int>::max())) ? 0 : value;
     }
+
+    // Checks that the folder contains nothing but the given files and the folders they reside in
+    bool containsOnly(const Path &folderPath, const QSet<Path> &filePaths)
+    {
+        QSet<Path> folderPaths;
+        for (const Path &filePath : filePaths)
+        {
+            for (Path path = filePath.parentPath(); path.hasAncestor(folderPath); path = path.parentPath())
+            {
+                if (folderPaths.contains(path))
+                    break;
+                folderPaths.insert(path);
+            }
+        }
+
+        QDirIterator iter {folderPath.data(), (QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot)
+                , QDirIterator::Subdirectories};
+        while (iter.hasNext())
+        {
+            const QFileInfo entry = iter.nextFileInfo();
+            const Path entryPath {entry.filePath()};
+            const bool isOwnEntry = (entry.isDir() && !entry.isSymLink())
+                    ? folderPaths.contains(entryPath) : filePaths.contains(entryPath);
+            if (!isOwnEntry)
+                return false;
+        }
+
+        return true;
+    }
 }
 
 // TorrentImpl
 
-TorrentImpl::TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeHandle, LoadTorrentParams params)
+TorrentImpl::TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeHandle, LoadTorrentParams params, const int slotIndex)
     : Torrent(session)
     , m_session(session)
     , m_nativeHandle(nativeHandle)
@@ -308,6 +345,7 @@ TorrentImpl::TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeH
 #else
     , m_infoHash(m_nativeHandle.info_hash())
 #endif
+    , m_slotIndex(slotIndex)
     , m_name(params.name)
     , m_savePath(params.savePath)
     , m_downloadPath(params.downloadPath)
@@ -327,6 +365,7 @@ TorrentImpl::TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeH
     , m_ltAddTorrentParams(std::move(params.ltAddTorrentParams))
     , m_downloadLimit(cleanLimitValue(m_ltAddTorrentParams.download_limit))
     , m_uploadLimit(cleanLimitValue(m_ltAddTorrentParams.upload_limit))
+    , m_appliedLimits {.downloadLimit = m_downloadLimit, .uploadLimit = m_uploadLimit}
 {
     if (m_ltAddTorrentParams.ti)
     {
@@ -337,11 +376,11 @@ TorrentImpl::TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeH
 
         // Initialize it only if torrent is added with metadata.
         // Otherwise it should be initialized in "Metadata received" handler.
-        m_torrentInfo = TorrentInfo(*m_ltAddTorrentParams.ti);
+        setMetadata(TorrentInfo(*m_ltAddTorrentParams.ti));
 
         Q_ASSERT(m_filePaths.isEmpty());
         Q_ASSERT(m_indexMap.isEmpty());
-        const int filesCount = m_torrentInfo.filesCount();
+        const int filesCount = m_filesCount;
         m_filePaths.reserve(filesCount);
         m_indexMap.reserve(filesCount);
         m_filePriorities.reserve(filesCount);
@@ -413,13 +452,18 @@ InfoHash TorrentImpl::infoHash() const
     return m_infoHash;
 }
 
+int TorrentImpl::slotIndex() const
+{
+    return m_slotIndex;
+}
+
 QString TorrentImpl::name() const
 {
     if (!m_name.isEmpty())
         return m_name;
 
     if (hasMetadata())
-        return m_torrentInfo.name();
+        return m_metadataName;
 
     const QString name = QString::fromStdString(m_nativeStatus.name);
     if (!name.isEmpty())
@@ -454,12 +498,12 @@ void TorrentImpl::setComment(const QString &comment)
 
 bool TorrentImpl::isPrivate() const
 {
-    return m_torrentInfo.isPrivate();
+    return m_isPrivate;
 }
 
 qlonglong TorrentImpl::totalSize() const
 {
-    return m_torrentInfo.totalSize();
+    return m_totalSize;
 }
 
 // size without the "don't download" files
@@ -475,7 +519,7 @@ qlonglong TorrentImpl::completedSize() const
 
 qlonglong TorrentImpl::pieceLength() const
 {
-    return m_torrentInfo.pieceLength();
+    return m_pieceLength;
 }
 
 qlonglong TorrentImpl::wastedSize() const
@@ -886,12 +930,12 @@ void TorrentImpl::deferredRequestResumeData()
 
 int TorrentImpl::filesCount() const
 {
-    return m_torrentInfo.filesCount();
+    return m_filesCount;
 }
 
 int TorrentImpl::piecesCount() const
 {
-    return m_torrentInfo.piecesCount();
+    return m_piecesCount;
 }
 
 int TorrentImpl::piecesHave() const
@@ -1057,7 +1101,7 @@ Path TorrentImpl::filePath(const int index) const
 
 Path TorrentImpl::actualFilePath(const int index) const
 {
-    const QList<lt::file_index_t> nativeIndexes = m_torrentInfo.nativeIndexes();
+    const QList<lt::file_index_t> nativeIndexes = metadata().nativeIndexes();
 
     Q_ASSERT(index >= 0);
     Q_ASSERT(index < nativeIndexes.size());
@@ -1069,7 +1113,7 @@ Path TorrentImpl::actualFilePath(const int index) const
 
 qlonglong TorrentImpl::fileSize(const int index) const
 {
-    return m_torrentInfo.fileSize(index);
+    return metadata().fileSize(index);
 }
 
 PathList TorrentImpl::filePaths() const
@@ -1086,7 +1130,7 @@ PathList TorrentImpl::actualFilePaths() const
     paths.reserve(filesCount());
 
     const lt::file_storage files = nativeTorrentInfo()->files();
-    for (const lt::file_index_t &nativeIndex : asConst(m_torrentInfo.nativeIndexes()))
+    for (const lt::file_index_t &nativeIndex : asConst(metadata().nativeIndexes()))
         paths.emplaceBack(files.file_path(nativeIndex));
 
     return paths;
@@ -1099,7 +1143,7 @@ QList<DownloadPriority> TorrentImpl::filePriorities() const
 
 TorrentInfo TorrentImpl::info() const
 {
-    return m_torrentInfo;
+    return metadata();
 }
 
 bool TorrentImpl::isStopped() const
@@ -1112,9 +1156,14 @@ bool TorrentImpl::isQueued() const
     if (!m_session->isQueueingSystemEnabled())
         return false;
 
+    if (isStopped())
+        return false;
+
+    if (m_seedingSlot != SeedingSlot::Unmanaged)
+        return (m_seedingSlot == SeedingSlot::Queued);
+
     // Torrent is Queued if it isn't in Stopped state but paused internally
-    return (!isStopped()
-            && (m_nativeStatus.flags & lt::torrent_flags::auto_managed)
+    return ((m_nativeStatus.flags & lt::torrent_flags::auto_managed)
             && (m_nativeStatus.flags & lt::torrent_flags::paused));
 }
 
@@ -1288,7 +1337,7 @@ void TorrentImpl::updateState()
 
 bool TorrentImpl::hasMetadata() const
 {
-    return m_torrentInfo.isValid();
+    return m_hasMetadata;
 }
 
 bool TorrentImpl::hasMissingFiles() const
@@ -1425,20 +1474,44 @@ int TorrentImpl::leechsCount() const
 
 int TorrentImpl::totalSeedsCount() const
 {
+    if (useSwarmStats() && (m_swarmStats.seedsCount > -1))
+        return m_swarmStats.seedsCount;
+
     return (m_nativeStatus.num_complete > -1) ? m_nativeStatus.num_complete : m_nativeStatus.list_seeds;
 }
 
 int TorrentImpl::totalPeersCount() const
 {
+    if (useSwarmStats() && (m_swarmStats.seedsCount > -1) && (m_swarmStats.leechersCount > -1))
+        return m_swarmStats.seedsCount + m_swarmStats.leechersCount;
+
     const int peers = m_nativeStatus.num_complete + m_nativeStatus.num_incomplete;
     return (peers > -1) ? peers : m_nativeStatus.list_peers;
 }
 
 int TorrentImpl::totalLeechersCount() const
 {
+    if (useSwarmStats() && (m_swarmStats.leechersCount > -1))
+        return m_swarmStats.leechersCount;
+
     return (m_nativeStatus.num_incomplete > -1) ? m_nativeStatus.num_incomplete : (m_nativeStatus.list_peers - m_nativeStatus.list_seeds);
 }
 
+SwarmStats TorrentImpl::swarmStats() const
+{
+    return m_swarmStats;
+}
+
+void TorrentImpl::setSwarmStats(const SwarmStats &stats)
+{
+    m_swarmStats = stats;
+}
+
+bool TorrentImpl::useSwarmStats() const
+{
+    return m_swarmStats.isValid() && (isStopped() || isQueued());
+}
+
 int TorrentImpl::downloadLimit() const
 {
     return m_downloadLimit;
@@ -1613,6 +1686,14 @@ void TorrentImpl::forceDHTAnnounce()
 }
 
 void TorrentImpl::forceRecheck()
+{
+    if (!hasMetadata())
+        return;
+
+    m_session->addRecheckJob(this);
+}
+
+void TorrentImpl::recheck()
 {
     if (!hasMetadata())
         return;
@@ -1635,6 +1716,7 @@ void TorrentImpl::forceRecheck()
     if (m_hasMissingFiles)
     {
         m_hasMissingFiles = false;
+        m_seedingSlot = SeedingSlot::Unmanaged;
         if (!isStopped())
         {
             setAutoManaged(m_operatingMode == TorrentOperatingMode::AutoManaged);
@@ -1688,7 +1770,7 @@ void TorrentImpl::applyFirstLastPiecePriority(const bool enabled)
 
     // Download first and last pieces first for every file in the torrent
 
-    auto piecePriorities = std::vector<lt::download_priority_t>(m_torrentInfo.piecesCount(), LT::toNative(DownloadPriority::Ignored));
+    auto piecePriorities = std::vector<lt::download_priority_t>(m_piecesCount, LT::toNative(DownloadPriority::Ignored));
 
     // Updating file priorities is an async operation in libtorrent, when we just updated it and immediately query it
     // we might get the old/wrong values, so we rely on `updatedFilePrio` in this case.
@@ -1700,7 +1782,7 @@ void TorrentImpl::applyFirstLastPiecePriority(const bool enabled)
 
         // Determine the priority to set
         const lt::download_priority_t piecePrio = LT::toNative(enabled ? DownloadPriority::Maximum : filePrio);
-        const TorrentInfo::PieceRange pieceRange = m_torrentInfo.filePieces(fileIndex);
+        const TorrentInfo::PieceRange pieceRange = metadata().filePieces(fileIndex);
 
         // worst case: AVI index = 1% of total file size (at the end of the file)
         const int numPieces = std::ceil(fileSize(fileIndex) * 0.01 / pieceLength());
@@ -1767,6 +1849,90 @@ std::shared_ptr<const libtorrent::torrent_info> TorrentImpl::nativeTorrentInfo()
     return m_nativeStatus.torrent_file.lock();
 }
 
+const TorrentInfo &TorrentImpl::metadata() const
+{
+    // libtorrent keeps its own copy of metadata, so unloaded one can be restored from it
+    if (m_hasMetadata && !m_torrentInfo.isValid())
+    {
+        // the cached status may not refer to the metadata yet, so query it directly then
+        std::shared_ptr<const lt::torrent_info> nativeInfo = m_nativeStatus.torrent_file.lock();
+        if (!nativeInfo) [[unlikely]]
+            nativeInfo = m_nativeHandle.torrent_file();
+        if (nativeInfo) [[likely]]
+            m_torrentInfo = TorrentInfo(*nativeInfo);
+    }
+
+    m_isMetadataAccessed = true;
+    return m_torrentInfo;
+}
+
+void TorrentImpl::setMetadata(const TorrentInfo &torrentInfo)
+{
+    m_torrentInfo = torrentInfo;
+    m_isMetadataAccessed = true;
+    m_hasMetadata = torrentInfo.isValid();
+    m_metadataName = torrentInfo.name();
+    m_totalSize = torrentInfo.totalSize();
+    m_pieceLength = torrentInfo.pieceLength();
+    m_piecesCount = torrentInfo.piecesCount();
+    m_filesCount = torrentInfo.filesCount();
+    m_isPrivate = torrentInfo.isPrivate();
+    m_metadataSize = torrentInfo.memoryUsage();
+}
+
+bool TorrentImpl::unloadMetadata()
+{
+    if (!m_torrentInfo.isValid())
+        return false;
+
+    if (!(isStopped() || isQueued()) || isChecking() || isMoveInProgress()
+            || (m_maintenanceJob != MaintenanceJob::None) || (m_renameCount > 0))
+    {
+        return false;
+    }
+
+    // Metadata accessed since the previous attempt is considered to be in use
+    if (std::exchange(m_isMetadataAccessed, false))
+        return false;
+
+    m_torrentInfo = {};
+    return true;
+}
+
+bool TorrentImpl::isMetadataLoaded() const
+{
+    return m_torrentInfo.isValid();
+}
+
+qint64 TorrentImpl::memoryUsage() const
+{
+    qint64 size = sizeof(TorrentImpl) + estimateMemoryUsage(m_name) + estimateMemoryUsage(m_metadataName)
+            + estimateMemoryUsage(m_creator) + estimateMemoryUsage(m_comment);
+
+    for (const Path &filePath : m_filePaths)
+        size += sizeof(Path) + estimateMemoryUsage(filePath.toString());
+    size += m_filePriorities.capacity() * sizeof(DownloadPriority);
+    size += m_filesProgress.capacity() * sizeof(std::int64_t);
+    size += m_indexMap.size() * (sizeof(lt::file_index_t) + sizeof(int));
+    size += (m_completedFiles.size() + m_pieces.size()) / 8;
+
+    for (const TrackerEntryStatus &status : m_trackerEntryStatuses)
+        size += sizeof(TrackerEntryStatus) + estimateMemoryUsage(status.url) + estimateMemoryUsage(status.message);
+
+    return size;
+}
+
+qint64 TorrentImpl::metadataMemoryUsage() const
+{
+    // libtorrent always keeps its own instance along with our copy that can be unloaded
+    return isMetadataLoaded() ? (2 * m_metadataSize) : m_metadataSize;
+}
+
+qint64 TorrentImpl::peersMemoryUsage() const
+{
+    return (m_nativeStatus.num_connections * PEER_CONNECTION_SIZE) + (m_nativeStatus.list_peers * PEER_ENTRY_SIZE);
+}
+
 void TorrentImpl::endReceivedMetadataHandling(const Path &savePath, const PathList &fileNames)
 {
     Q_ASSERT(m_maintenanceJob == MaintenanceJob::HandleMetadata);
@@ -1780,7 +1946,7 @@ void TorrentImpl::endReceivedMetadataHandling(const Path &savePath, const PathLi
     lt::add_torrent_params &p = m_ltAddTorrentParams;
 
     const std::shared_ptr<lt::torrent_info> metadata = std::const_pointer_cast<lt::torrent_info>(nativeTorrentInfo());
-    m_torrentInfo = TorrentInfo(*metadata);
+    setMetadata(TorrentInfo(*metadata));
     m_filePriorities.reserve(filesCount());
     const auto nativeIndexes = m_torrentInfo.nativeIndexes();
     p.file_priorities = resized(p.file_priorities, metadata->files().num_files()
@@ -1842,12 +2008,24 @@ void TorrentImpl::reload()
         p.flags |= lt::torrent_flags::update_subscribe
                 | lt::torrent_flags::override_trackers
                 | lt::torrent_flags::override_web_seeds;
+        // keep speed limits currently lowered by bandwidth groups
+        p.download_limit = m_appliedLimits.downloadLimit;
+        p.upload_limit = m_appliedLimits.uploadLimit;
 
         if (m_isStopped)
         {
             p.flags |= lt::torrent_flags::paused;
             p.flags &= ~lt::torrent_flags::auto_managed;
         }
+        else if (m_seedingSlot == SeedingSlot::Active)
+        {
+            p.flags &= ~(lt::torrent_flags::auto_managed | lt::torrent_flags::paused);
+        }
+        else if (m_seedingSlot == SeedingSlot::Queued)
+        {
+            p.flags |= lt::torrent_flags::paused;
+            p.flags &= ~lt::torrent_flags::auto_managed;
+        }
         else if (m_operatingMode == TorrentOperatingMode::AutoManaged)
         {
             p.flags |= (lt::torrent_flags::auto_managed | lt::torrent_flags::paused);
@@ -1883,6 +2061,8 @@ void TorrentImpl::reload()
 
 void TorrentImpl::stop()
 {
+    m_seedingSlot = SeedingSlot::Unmanaged;
+
     if (!m_isStopped)
     {
         m_stopCondition = StopCondition::None;
@@ -1909,6 +2089,7 @@ void TorrentImpl::start(const TorrentOperatingMode mode)
     }
 
     m_operatingMode = mode;
+    m_seedingSlot = SeedingSlot::Unmanaged;
 
     if (m_hasMissingFiles)
     {
@@ -2046,6 +2227,7 @@ void TorrentImpl::handleTorrentChecked()
             {
                 // torrent is internally paused using NativeTorrentExtension after files checked
                 // so we need to resume it if there is no corresponding "stop condition" set
+                m_seedingSlot = SeedingSlot::Unmanaged;
                 setAutoManaged(m_operatingMode == TorrentOperatingMode::AutoManaged);
                 if (m_operatingMode == TorrentOperatingMode::Forced)
                     m_nativeHandle.resume();
@@ -2195,6 +2377,9 @@ void TorrentImpl::prepareResumeData(lt::add_torrent_params params)
 
     // We shouldn't save upload_mode flag to allow torrent operate normally on next run
     m_ltAddTorrentParams.flags &= ~lt::torrent_flags::upload_mode;
+    // Native speed limits can be temporarily lowered by bandwidth groups
+    m_ltAddTorrentParams.download_limit = ((m_downloadLimit > 0) ? m_downloadLimit : -1);
+    m_ltAddTorrentParams.upload_limit = ((m_uploadLimit > 0) ? m_uploadLimit : -1);
 
     LoadTorrentParams resumeData
     {
@@ -2289,7 +2474,9 @@ void TorrentImpl::handleFileRenamed(const lt::file_index_t nativeFileIndex, cons
     while (!isMoveInProgress() && (m_renameCount == 0) && !m_moveFinishedTriggers.isEmpty())
         m_moveFinishedTriggers.takeFirst()();
 
-    deferredRequestResumeData();
+    // Resume data is saved once all the pending renames (e.g. of a whole folder) are done
+    if (m_renameCount == 0)
+        deferredRequestResumeData();
 }
 
 void TorrentImpl::handleFileRenameFailed(const lt::file_index_t nativeFileIndex)
@@ -2301,7 +2488,8 @@ void TorrentImpl::handleFileRenameFailed(const lt::file_index_t nativeFileIndex)
     while (!isMoveInProgress() && (m_renameCount == 0) && !m_moveFinishedTriggers.isEmpty())
         m_moveFinishedTriggers.takeFirst()();
 
-    deferredRequestResumeData();
+    if (m_renameCount == 0)
+        deferredRequestResumeData();
 }
 
 void TorrentImpl::handleFileCompleted(const lt::file_index_t nativeFileIndex)
@@ -2386,7 +2574,7 @@ void TorrentImpl::manageActualFilePaths()
     {
         const Path path = filePath(i);
 
-        const auto nativeIndex = m_torrentInfo.nativeIndexes().at(i);
+        const auto nativeIndex = metadata().nativeIndexes().at(i);
         const Path actualPath {nativeFiles.file_path(nativeIndex)};
         const Path targetActualPath = makeActualPath(i, path);
         if (actualPath != targetActualPath)
@@ -2408,7 +2596,7 @@ void TorrentImpl::adjustStorageLocation()
 
 void TorrentImpl::doRenameFile(const int index, const Path &path)
 {
-    const QList<lt::file_index_t> nativeIndexes = m_torrentInfo.nativeIndexes();
+    const QList<lt::file_index_t> nativeIndexes = metadata().nativeIndexes();
 
     Q_ASSERT(index >= 0);
     Q_ASSERT(index < nativeIndexes.size());
@@ -2419,6 +2607,73 @@ void TorrentImpl::doRenameFile(const int index, const Path &path)
     m_nativeHandle.rename_file(nativeIndexes[index], path.toString().toStdString());
 }
 
+void TorrentImpl::renameFolderFiles(const QList<int> &fileIndexes, const Path &oldFolderPath, const Path &newFolderPath)
+{
+    const std::shared_ptr<const lt::torrent_info> nativeInfo = nativeTorrentInfo();
+    const lt::file_storage &nativeFiles = nativeInfo->files();
+    const QList<lt::file_index_t> nativeIndexes = metadata().nativeIndexes();
+
+    // Files of stopped torrent aren't open so the folder can be renamed on disk as a whole
+    // (if files keep their relative locations inside it). libtorrent then just updates
+    // the file names since they no longer exist at the old location.
+    bool canRenameOnDisk = isStopped() && !isChecking() && !isMoveInProgress() && (m_renameCount == 0);
+
+    PathList targetActualPaths;
+    targetActualPaths.reserve(fileIndexes.size());
+    QSet<Path> oldActualPaths;
+    for (const int index : fileIndexes)
+    {
+        const Path newFilePath = newFolderPath / oldFolderPath.relativePathOf(filePath(index));
+        const Path targetActualPath = makeActualPath(index, newFilePath);
+        targetActualPaths.append(targetActualPath);
+
+        if (canRenameOnDisk)
+        {
+            const Path actualPath {nativeFiles.file_path(nativeIndexes[index])};
+            canRenameOnDisk = actualPath.hasAncestor(oldFolderPath)
+                    && (targetActualPath == (newFolderPath / oldFolderPath.relativePathOf(actualPath)));
+            oldActualPaths.insert(actualStorageLocation() / actualPath);
+        }
+    }
+
+    if (!canRenameOnDisk)
+    {
+        for (qsizetype i = 0; i < fileIndexes.size(); ++i)
+            doRenameFile(fileIndexes[i], targetActualPaths[i]);
+        return;
+    }
+
+    // The folder can contain lots of files so it is examined and renamed
+    // in the worker thread. Until it is done, the torrent is considered
+    // to be renaming files so other renames and moves wait for it.
+    ++m_renameCount;
+    m_session->invokeAsync([session = m_session, thisTorrent = QPointer<TorrentImpl>(this)
+            , oldActualFolderPath = (actualStorageLocation() / oldFolderPath)
+            , newActualFolderPath = (actualStorageLocation() / newFolderPath)
+            , oldActualPaths, fileIndexes, targetActualPaths]
+    {
+        // Files that don't belong to the torrent must stay where they are
+        if (Utils::Fs::isDir(oldActualFolderPath) && !newActualFolderPath.exists()
+                && containsOnly(oldActualFolderPath, oldActualPaths)
+                && Utils::Fs::mkpath(newActualFolderPath.parentPath()))
+        {
+            // If it fails libtorrent renames the files one by one
+            QDir().rename(oldActualFolderPath.data(), newActualFolderPath.data());
+        }
+
+        session->invoke([thisTorrent, fileIndexes, targetActualPaths]
+        {
+            if (!thisTorrent)
+                return;
+
+            for (qsizetype i = 0; i < fileIndexes.size(); ++i)
+                thisTorrent->doRenameFile(fileIndexes[i], targetActualPaths[i]);
+            // pending renames are counted by the calls above
+            --thisTorrent->m_renameCount;
+        });
+    });
+}
+
 lt::torrent_handle TorrentImpl::nativeHandle() const
 {
     return m_nativeHandle;
@@ -2553,19 +2808,19 @@ void TorrentImpl::updateProgress()
     const QBitArray oldPieces = std::exchange(m_pieces, LT::toQBitArray(m_nativeStatus.pieces));
     const QBitArray newPieces = m_pieces ^ oldPieces;
 
-    const int64_t pieceSize = m_torrentInfo.pieceLength();
+    const int64_t pieceSize = m_pieceLength;
     for (qsizetype index = 0; index < newPieces.size(); ++index)
     {
         if (!newPieces.at(index))
             continue;
 
-        int64_t size = m_torrentInfo.pieceLength(index);
+        int64_t size = metadata().pieceLength(index);
         int64_t pieceOffset = index * pieceSize;
 
-        for (const int fileIndex : asConst(m_torrentInfo.fileIndicesForPiece(index)))
+        for (const int fileIndex : asConst(metadata().fileIndicesForPiece(index)))
         {
-            const int64_t fileOffsetInPiece = pieceOffset - m_torrentInfo.fileOffset(fileIndex);
-            const int64_t add = std::min<int64_t>((m_torrentInfo.fileSize(fileIndex) - fileOffsetInPiece), size);
+            const int64_t fileOffsetInPiece = pieceOffset - metadata().fileOffset(fileIndex);
+            const int64_t add = std::min<int64_t>((metadata().fileSize(fileIndex) - fileOffsetInPiece), size);
 
             m_filesProgress[fileIndex] += add;
 
@@ -2639,7 +2894,7 @@ void TorrentImpl::setUploadLimit(const int limit)
         return;
 
     m_uploadLimit = cleanValue;
-    m_nativeHandle.set_upload_limit(m_uploadLimit);
+    updateSpeedLimits();
     deferredRequestResumeData();
 }
 
@@ -2650,10 +2905,100 @@ void TorrentImpl::setDownloadLimit(const int limit)
         return;
 
     m_downloadLimit = cleanValue;
-    m_nativeHandle.set_download_limit(m_downloadLimit);
+    updateSpeedLimits();
     deferredRequestResumeData();
 }
 
+BandwidthGroupLimits TorrentImpl::bandwidthGroupLimits() const
+{
+    return m_bandwidthGroupLimits;
+}
+
+void TorrentImpl::setBandwidthGroupLimits(const BandwidthGroupLimits &limits)
+{
+    if (limits == m_bandwidthGroupLimits)
+        return;
+
+    m_bandwidthGroupLimits = limits;
+    updateSpeedLimits();
+}
+
+SeedingSlot TorrentImpl::seedingSlot() const
+{
+    return m_seedingSlot;
+}
+
+void TorrentImpl::setSeedingSlot(const SeedingSlot slot)
+{
+    if ((slot == m_seedingSlot) || isStopped())
+        return;
+
+    m_seedingSlot = slot;
+    if (m_maintenanceJob != MaintenanceJob::None)
+        return;
+
+    switch (m_seedingSlot)
+    {
+    case SeedingSlot::Unmanaged:
+        setAutoManaged(m_operatingMode == TorrentOperatingMode::AutoManaged);
+        break;
+    case SeedingSlot::Active:
+        setAutoManaged(false);
+        m_nativeHandle.resume();
+        break;
+    case SeedingSlot::Queued:
+        setAutoManaged(false);
+        m_nativeHandle.pause();
+        break;
+    }
+}
+
+void TorrentImpl::scrapeTrackers()
+{
+    m_nativeHandle.scrape_tracker();
+}
+
+void TorrentImpl::setCheckingPaused(const bool paused)
+{
+    if (isStopped() || (m_maintenanceJob != MaintenanceJob::None))
+        return;
+
+    // libtorrent suspends checking of paused torrent and continues it from the same piece once resumed
+    if (paused)
+    {
+        setAutoManaged(false);
+        m_nativeHandle.pause();
+    }
+    else
+    {
+        setAutoManaged(m_operatingMode == TorrentOperatingMode::AutoManaged);
+        if (m_operatingMode == TorrentOperatingMode::Forced)
+            m_nativeHandle.resume();
+    }
+}
+
+void TorrentImpl::updateSpeedLimits()
+{
+    const auto effectiveLimit = [](const int ownLimit, const int groupLimit)
+    {
+        if ((ownLimit > 0) && (groupLimit > 0))
+            return std::min(ownLimit, groupLimit);
+        return std::max(ownLimit, groupLimit);
+    };
+
+    const BandwidthGroupLimits limits {
+        .downloadLimit = effectiveLimit(m_downloadLimit, m_bandwidthGroupLimits.downloadLimit),
+        .uploadLimit = effectiveLimit(m_uploadLimit, m_bandwidthGroupLimits.uploadLimit)
+    };
+
+    if (limits.downloadLimit != m_appliedLimits.downloadLimit)
+        m_nativeHandle.set_download_limit(limits.downloadLimit);
+    if (limits.uploadLimit != m_appliedLimits.uploadLimit)
+        m_nativeHandle.set_upload_limit(limits.uploadLimit);
+
+    m_appliedLimits = limits;
+}
+
 void TorrentImpl::setSuperSeeding(const bool enable)
 {
     if (enable == superSeeding())
@@ -2842,7 +3187,7 @@ QFuture<QList<int>> TorrentImpl::fetchPieceAvailability() const
 
 QFuture<QBitArray> TorrentImpl::fetchDownloadingPieces() const
 {
-    return invokeAsync([nativeHandle = m_nativeHandle, torrentInfo = m_torrentInfo]() -> QBitArray
+    return invokeAsync([nativeHandle = m_nativeHandle, torrentInfo = metadata()]() -> QBitArray
     {
         try
         {
@@ -2866,7 +3211,7 @@ QFuture<QBitArray> TorrentImpl::fetchDownloadingPieces() const
 
 QFuture<QList<qreal>> TorrentImpl::fetchAvailableFileFractions() const
 {
-    return invokeAsync([nativeHandle = m_nativeHandle, torrentInfo = m_torrentInfo]() -> QList<qreal>
+    return invokeAsync([nativeHandle = m_nativeHandle, torrentInfo = metadata()]() -> QList<qreal>
     {
         if (!torrentInfo.isValid() || (torrentInfo.filesCount() <= 0))
             return {};
@@ -2924,9 +3269,9 @@ void TorrentImpl::prioritizeFiles(const QList<DownloadPriority> &priorities)
         }
     }
 
-    const int internalFilesCount = m_torrentInfo.nativeInfo()->files().num_files(); // including .pad files
+    const int internalFilesCount = metadata().nativeInfo()->files().num_files(); // including .pad files
     auto nativePriorities = std::vector<lt::download_priority_t>(internalFilesCount, LT::toNative(DownloadPriority::Normal));
-    const auto nativeIndexes = m_torrentInfo.nativeIndexes();
+    const auto nativeIndexes = metadata().nativeIndexes();
     for (qsizetype i = 0; i < priorities.size(); ++i)
         nativePriorities[LT::toUnderlyingType(nativeIndexes[i])] = LT::toNative(priorities[i]);
 
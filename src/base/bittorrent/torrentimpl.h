@@ -49,7 +49,9 @@
 
 #include "base/path.h"
 #include "base/tagset.h"
+#include "bandwidthgroup.h"
 #include "infohash.h"
+#include "seedingoptimizer.h"
 #include "speedmonitor.h"
 #include "sslparameters.h"
 #include "torrent.h"
@@ -94,7 +96,7 @@ namespace BitTorrent
         Q_DISABLE_COPY_MOVE(TorrentImpl)
 
     public:
-        TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeHandle, LoadTorrentParams params);
+        TorrentImpl(SessionImpl *session, const lt::torrent_handle &nativeHandle, LoadTorrentParams params, int slotIndex);
         ~TorrentImpl() override;
 
         bool isValid() const;
@@ -102,6 +104,7 @@ namespace BitTorrent
         Session *session() const override;
 
         InfoHash infoHash() const override;
+        int slotIndex() const override;
         QString name() const override;
         QDateTime creationDate() const override;
         QString creator() const override;
@@ -197,6 +200,7 @@ namespace BitTorrent
         int totalSeedsCount() const override;
         int totalPeersCount() const override;
         int totalLeechersCount() const override;
+        SwarmStats swarmStats() const override;
         int downloadLimit() const override;
         int uploadLimit() const override;
         bool superSeeding() const override;
@@ -286,13 +290,36 @@ namespace BitTorrent
         void handleMoveStorageJobFinished(const Path &path, MoveStorageContext context, bool hasOutstandingJob);
         TrackerEntryStatus updateTrackerEntryStatus(const lt::announce_entry &announceEntry, const QHash<lt::tcp::endpoint, QMap<int, int>> &updateInfo);
         void resetTrackerEntryStatuses();
+        // Limits assigned by bandwidth groups are applied in addition to the own limits of the torrent
+        BandwidthGroupLimits bandwidthGroupLimits() const;
+        void setBandwidthGroupLimits(const BandwidthGroupLimits &limits);
+        // Seeding optimizer starts and queues auto managed seeding torrents itself
+        SeedingSlot seedingSlot() const;
+        void setSeedingSlot(SeedingSlot slot);
+        void scrapeTrackers();
+        // Forced rechecks are performed by the recheck queue of the session
+        void recheck();
+        void setCheckingPaused(bool paused);
+        // Statistics scraped while the torrent is inactive replace the stale announce results
+        void setSwarmStats(const SwarmStats &stats);
+        // Releases metadata copy of inactive torrent, it is reloaded on demand
+        bool unloadMetadata();
+        bool isMetadataLoaded() const;
+        // Approximate amounts of memory held by the torrent (used for memory usage accounting)
+        qint64 memoryUsage() const;
+        qint64 metadataMemoryUsage() const;
+        qint64 peersMemoryUsage() const;
 
     private:
         using EventTrigger = std::function<void ()>;
 
         std::shared_ptr<const lt::torrent_info> nativeTorrentInfo() const;
+        const TorrentInfo &metadata() const;
+        void setMetadata(const TorrentInfo &torrentInfo);
 
         void updateStatus(const lt::torrent_status &nativeStatus);
+        void updateSpeedLimits();
+        bool useSwarmStats() const;
         void updateProgress();
         void updateState();
 
@@ -304,6 +331,7 @@ namespace BitTorrent
         Path makeUserPath(const Path &path) const;
         void adjustStorageLocation();
         void doRenameFile(int index, const Path &path);
+        void renameFolderFiles(const QList<int> &fileIndexes, const Path &oldFolderPath, const Path &newFolderPath) override;
         void moveStorage(const Path &newPath, MoveStorageContext context);
         void manageActualFilePaths();
         void applyFirstLastPiecePriority(bool enabled);
@@ -321,7 +349,18 @@ namespace BitTorrent
         lt::torrent_handle m_nativeHandle;
         mutable lt::torrent_status m_nativeStatus;
         TorrentState m_state = TorrentState::Unknown;
-        TorrentInfo m_torrentInfo;
+        // Metadata copy can be unloaded while torrent is inactive so
+        // the values frequently requested by the UI are cached separately
+        mutable TorrentInfo m_torrentInfo;
+        mutable bool m_isMetadataAccessed = false;
+        bool m_hasMetadata = false;
+        QString m_metadataName;
+        qlonglong m_totalSize = 0;
+        int m_pieceLength = 0;
+        int m_piecesCount = 0;
+        int m_filesCount = 0;
+        qint64 m_metadataSize = 0;
+        bool m_isPrivate = false;
         PathList m_filePaths;
         QHash<lt::file_index_t, int> m_indexMap;
         QList<DownloadPriority> m_filePriorities;
@@ -329,6 +368,7 @@ namespace BitTorrent
         SpeedMonitor m_payloadRateMonitor;
 
         InfoHash m_infoHash;
+        int m_slotIndex = -1;
 
         QDateTime m_creationDate;
         QString m_creator;
@@ -378,6 +418,10 @@ namespace BitTorrent
 
         int m_downloadLimit = 0;
         int m_uploadLimit = 0;
+        BandwidthGroupLimits m_bandwidthGroupLimits;
+        BandwidthGroupLimits m_appliedLimits;
+        SeedingSlot m_seedingSlot = SeedingSlot::Unmanaged;
+        SwarmStats m_swarmStats;
 
         QBitArray m_pieces;
         QList<std::int64_t> m_filesProgress;
@@ -190,6 +190,23 @@ QByteArray TorrentInfo::rawData() const
 #endif
 }
 
+qint64 TorrentInfo::memoryUsage() const
+{
+    if (!isValid())
+        return 0;
+
+    // rough size of file entry (along with its name) in libtorrent file storage
+    const qint64 fileEntrySize = 64;
+#ifdef QBT_USES_LIBTORRENT2
+    const qint64 infoSectionSize = m_nativeInfo->info_section().size();
+#else
+    const qint64 infoSectionSize = m_nativeInfo->metadata_size();
+#endif
+    return sizeof(lt::torrent_info) + infoSectionSize
+            + (m_nativeInfo->orig_files().num_files() * fileEntrySize)
+            + (m_nativeIndexes.size() * sizeof(lt::file_index_t));
+}
+
 PathList TorrentInfo::filesForPiece(const int pieceIndex) const
 {
     // no checks here because fileIndicesForPiece() will return an empty list
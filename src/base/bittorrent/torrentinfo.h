@@ -81,6 +81,8 @@ namespace BitTorrent
         PieceRange filePieces(int fileIndex) const;
 
         QByteArray rawData() const;
+        // Approximate amount of memory held by the metadata
+        qint64 memoryUsage() const;
 
         bool matchesInfoHash(const InfoHash &otherInfoHash) const;
 
@@ -0,0 +1,363 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "trackerindex.h"
+
+#include <algorithm>
+
+#include <QList>
+#include <QUrl>
+
+#include "base/global.h"
+#include "session.h"
+#include "torrent.h"
+#include "trackerentrystatus.h"
+
+using namespace BitTorrent;
+
+namespace
+{
+    const QString NULL_HOST = u""_s;
+
+    bool hasWarningMessages(const TrackerEntryStatus &status)
+    {
+        return std::ranges::any_of(status.endpoints, [](const TrackerEndpointStatus &endpointStatus)
+        {
+            return !endpointStatus.message.isEmpty() && (endpointStatus.state == TrackerEndpointState::Working);
+        });
+    }
+
+    QSet<QString> trackerURLs(const Torrent *torrent)
+    {
+        QSet<QString> urls;
+        for (const TrackerEntryStatus &status : asConst(torrent->trackers()))
+            urls.insert(status.url);
+        return urls;
+    }
+}
+
+TrackerIndex::TrackerIndex(QObject *parent)
+    : QObject(parent)
+{
+    m_torrentsByHost.insert(NULL_HOST, {});
+}
+
+void TrackerIndex::watch(const Session *session)
+{
+    connect(session, &Session::torrentsLoaded, this, &TrackerIndex::handleTorrentsLoaded);
+    connect(session, &Session::torrentAboutToBeRemoved, this, [this](const Torrent *torrent)
+    {
+        removeTorrent(torrent->id());
+    });
+    connect(session, &Session::trackersAdded, this, [this](const Torrent *torrent)
+    {
+        setTorrentTrackers(torrent->id(), trackerURLs(torrent));
+    });
+    connect(session, &Session::trackersRemoved, this, [this](const Torrent *torrent)
+    {
+        setTorrentTrackers(torrent->id(), trackerURLs(torrent));
+    });
+    connect(session, &Session::trackersChanged, this, [this](const Torrent *torrent)
+    {
+        // tracker list was replaced so previously reported problems are no longer relevant
+        clearTorrentProblems(torrent->id());
+        setTorrentTrackers(torrent->id(), trackerURLs(torrent));
+    });
+    connect(session, &Session::trackerEntryStatusesUpdated, this
+            , [this](const Torrent *torrent, const QHash<QString, TrackerEntryStatus> &updatedTrackers)
+    {
+        updateTrackerStatuses(torrent->id(), updatedTrackers);
+    });
+}
+
+QString TrackerIndex::hostFromURL(const QString &url)
+{
+    // If failed to parse the domain, original input should be returned
+    const QString host = QUrl(url).host();
+    return host.isEmpty() ? url : host;
+}
+
+QStringList TrackerIndex::trackers() const
+{
+    return m_torrentsByTracker.keys();
+}
+
+QSet<TorrentID> TrackerIndex::torrentsByTracker(const QString &url) const
+{
+    return m_torrentsByTracker.value(url);
+}
+
+QStringList TrackerIndex::hosts() const
+{
+    return m_torrentsByHost.keys();
+}
+
+QStringList TrackerIndex::trackersByHost(const QString &host) const
+{
+    return m_trackersByHost.value(host).values();
+}
+
+QSet<TorrentID> TrackerIndex::torrentsByHost(const QString &host) const
+{
+    const QHash<TorrentID, int> torrents = m_torrentsByHost.value(host);
+    return {torrents.keyBegin(), torrents.keyEnd()};
+}
+
+qsizetype TrackerIndex::torrentsCountByHost(const QString &host) const
+{
+    return m_torrentsByHost.value(host).size();
+}
+
+QSet<TorrentID> TrackerIndex::torrentsWithProblem(const Problem problem) const
+{
+    const ProblemTrackers &problemTrackers = m_problems[static_cast<std::size_t>(problem)];
+    return {problemTrackers.keyBegin(), problemTrackers.keyEnd()};
+}
+
+qsizetype TrackerIndex::torrentsWithProblemCount(const Problem problem) const
+{
+    return m_problems[static_cast<std::size_t>(problem)].size();
+}
+
+void TrackerIndex::setTorrentTrackers(const TorrentID &id, const QSet<QString> &trackers)
+{
+    Changes changes;
+    syncTorrent(id, trackers, changes);
+    notify(changes);
+}
+
+void TrackerIndex::removeTorrent(const TorrentID &id)
+{
+    const auto iter = m_trackersByTorrent.constFind(id);
+    if (iter == m_trackersByTorrent.cend())
+        return;
+
+    const QSet<QString> trackers = iter.value();
+    m_trackersByTorrent.erase(iter);
+
+    Changes changes;
+    clearProblems(id, changes);
+    if (trackers.isEmpty())
+        removeTorrentFromHost(id, NULL_HOST, changes);
+    for (const QString &url : trackers)
+        removeTorrentTracker(id, url, changes);
+    notify(changes);
+}
+
+void TrackerIndex::clearTorrentProblems(const TorrentID &id)
+{
+    Changes changes;
+    clearProblems(id, changes);
+    notify(changes);
+}
+
+void TrackerIndex::updateTrackerStatuses(const TorrentID &id, const QHash<QString, TrackerEntryStatus> &statuses)
+{
+    const QSet<QString> trackers = m_trackersByTorrent.value(id);
+
+    Changes changes;
+    for (const TrackerEntryStatus &status : statuses)
+    {
+        if (!trackers.contains(status.url))
+            continue;
+
+        // Tracker is being reannounced so it keeps the problems it had
+        // until the announce finishes
+        if (status.isUpdating)
+            continue;
+
+        const bool isError = (status.state == TrackerEndpointState::NotWorking)
+                || (status.state == TrackerEndpointState::Unreachable);
+        const bool isTrackerError = (status.state == TrackerEndpointState::TrackerError);
+        const bool isWarning = (status.state == TrackerEndpointState::Working) && hasWarningMessages(status);
+
+        setProblem(Problem::Error, id, status.url, isError, changes);
+        setProblem(Problem::TrackerError, id, status.url, isTrackerError, changes);
+        setProblem(Problem::Warning, id, status.url, isWarning, changes);
+    }
+    notify(changes);
+}
+
+void TrackerIndex::handleTorrentsLoaded(const QList<Torrent *> &torrents)
+{
+    Changes changes;
+    for (const Torrent *torrent : torrents)
+        syncTorrent(torrent->id(), trackerURLs(torrent), changes);
+    notify(changes);
+}
+
+void TrackerIndex::syncTorrent(const TorrentID &id, const QSet<QString> &newTrackers, Changes &changes)
+{
+    const auto iter = m_trackersByTorrent.constFind(id);
+    const bool isIndexed = (iter != m_trackersByTorrent.cend());
+    const QSet<QString> oldTrackers = isIndexed ? iter.value() : QSet<QString>();
+    if (isIndexed && (oldTrackers == newTrackers))
+        return;
+
+    if (isIndexed && oldTrackers.isEmpty())
+        removeTorrentFromHost(id, NULL_HOST, changes);
+
+    for (const QString &url : oldTrackers)
+    {
+        if (!newTrackers.contains(url))
+            removeTorrentTracker(id, url, changes);
+    }
+
+    for (const QString &url : newTrackers)
+    {
+        if (!oldTrackers.contains(url))
+            addTorrentTracker(id, url, changes);
+    }
+
+    if (newTrackers.isEmpty())
+        addTorrentToHost(id, NULL_HOST, changes);
+
+    m_trackersByTorrent.insert(id, newTrackers);
+}
+
+void TrackerIndex::addTorrentTracker(const TorrentID &id, const QString &url, Changes &changes)
+{
+    m_torrentsByTracker[url].insert(id);
+    changes.updatedTrackers.insert(url);
+    changes.removedTrackers.remove(url);
+
+    const QString host = hostFromURL(url);
+    m_trackersByHost[host].insert(url);
+    addTorrentToHost(id, host, changes);
+}
+
+void TrackerIndex::removeTorrentTracker(const TorrentID &id, const QString &url, Changes &changes)
+{
+    for (const Problem problem : {Problem::Error, Problem::TrackerError, Problem::Warning})
+        setProblem(problem, id, url, false, changes);
+
+    const QString host = hostFromURL(url);
+
+    if (const auto iter = m_torrentsByTracker.find(url); iter != m_torrentsByTracker.end())
+    {
+        iter->remove(id);
+        if (iter->isEmpty())
+        {
+            m_torrentsByTracker.erase(iter);
+            changes.updatedTrackers.remove(url);
+            changes.removedTrackers.insert(url);
+
+            if (const auto hostIter = m_trackersByHost.find(host); hostIter != m_trackersByHost.end())
+            {
+                hostIter->remove(url);
+                if (hostIter->isEmpty())
+                    m_trackersByHost.erase(hostIter);
+            }
+        }
+        else
+        {
+            changes.updatedTrackers.insert(url);
+        }
+    }
+
+    removeTorrentFromHost(id, host, changes);
+}
+
+void TrackerIndex::addTorrentToHost(const TorrentID &id, const QString &host, Changes &changes)
+{
+    ++m_torrentsByHost[host][id];
+    changes.updatedHosts.insert(host);
+    changes.removedHosts.remove(host);
+}
+
+void TrackerIndex::removeTorrentFromHost(const TorrentID &id, const QString &host, Changes &changes)
+{
+    const auto iter = m_torrentsByHost.find(host);
+    if (iter == m_torrentsByHost.end())
+        return;
+
+    if (const auto torrentIter = iter->find(id); (torrentIter != iter->end()) && (--torrentIter.value() <= 0))
+        iter->erase(torrentIter);
+
+    // entry for torrents without trackers is always kept
+    if (iter->isEmpty() && (host != NULL_HOST))
+    {
+        m_torrentsByHost.erase(iter);
+        changes.updatedHosts.remove(host);
+        changes.removedHosts.insert(host);
+    }
+    else
+    {
+        changes.updatedHosts.insert(host);
+    }
+}
+
+void TrackerIndex::setProblem(const Problem problem, const TorrentID &id, const QString &url, const bool isSet, Changes &changes)
+{
+    ProblemTrackers &problemTrackers = m_problems[static_cast<std::size_t>(problem)];
+    const auto iter = problemTrackers.find(id);
+
+    if (isSet)
+    {
+        if (iter == problemTrackers.end())
+        {
+            problemTrackers.insert(id, {url});
+            changes.problemsChanged = true;
+        }
+        else
+        {
+            iter->insert(url);
+        }
+    }
+    else if (iter != problemTrackers.end())
+    {
+        if (iter->remove(url) && iter->isEmpty())
+        {
+            problemTrackers.erase(iter);
+            changes.problemsChanged = true;
+        }
+    }
+}
+
+void TrackerIndex::clearProblems(const TorrentID &id, Changes &changes)
+{
+    for (ProblemTrackers &problemTrackers : m_problems)
+    {
+        if (problemTrackers.remove(id))
+            changes.problemsChanged = true;
+    }
+}
+
+void TrackerIndex::notify(const Changes &changes)
+{
+    if (!changes.updatedTrackers.isEmpty())
+        emit trackersUpdated(changes.updatedTrackers);
+    if (!changes.removedTrackers.isEmpty())
+        emit trackersRemoved(changes.removedTrackers);
+    if (!changes.updatedHosts.isEmpty())
+        emit hostsUpdated(changes.updatedHosts);
+    if (!changes.removedHosts.isEmpty())
+        emit hostsRemoved(changes.removedHosts);
+    if (changes.problemsChanged)
+        emit problemsChanged();
+}
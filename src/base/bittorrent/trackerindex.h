@@ -0,0 +1,125 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <array>
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QtContainerFwd>
+
+#include "infohash.h"
+
+namespace BitTorrent
+{
+    class Session;
+    class Torrent;
+    struct TrackerEntryStatus;
+
+    // Keeps torrents indexed by their trackers and tracker hosts.
+    // It is updated incrementally from Session signals so that its consumers
+    // don't need to rebuild tracker sets each time a single torrent changes.
+    // Torrents without trackers are indexed under an empty host.
+    class TrackerIndex final : public QObject
+    {
+        Q_OBJECT
+        Q_DISABLE_COPY_MOVE(TrackerIndex)
+
+    public:
+        enum class Problem
+        {
+            Error,
+            TrackerError,
+            Warning
+        };
+
+        explicit TrackerIndex(QObject *parent = nullptr);
+
+        // Keeps the index updated from the signals of the given session
+        void watch(const Session *session);
+
+        static QString hostFromURL(const QString &url);
+
+        QStringList trackers() const;
+        QSet<TorrentID> torrentsByTracker(const QString &url) const;
+
+        QStringList hosts() const;
+        QStringList trackersByHost(const QString &host) const;
+        QSet<TorrentID> torrentsByHost(const QString &host) const;
+        qsizetype torrentsCountByHost(const QString &host) const;
+
+        QSet<TorrentID> torrentsWithProblem(Problem problem) const;
+        qsizetype torrentsWithProblemCount(Problem problem) const;
+
+        void setTorrentTrackers(const TorrentID &id, const QSet<QString> &trackers);
+        void removeTorrent(const TorrentID &id);
+        void clearTorrentProblems(const TorrentID &id);
+        void updateTrackerStatuses(const TorrentID &id, const QHash<QString, TrackerEntryStatus> &statuses);
+
+    signals:
+        void trackersUpdated(const QSet<QString> &trackers);
+        void trackersRemoved(const QSet<QString> &trackers);
+        void hostsUpdated(const QSet<QString> &hosts);
+        void hostsRemoved(const QSet<QString> &hosts);
+        // Emitted when some torrent starts or stops having a problem
+        void problemsChanged();
+
+    private:
+        struct Changes
+        {
+            QSet<QString> updatedTrackers;
+            QSet<QString> removedTrackers;
+            QSet<QString> updatedHosts;
+            QSet<QString> removedHosts;
+            bool problemsChanged = false;
+        };
+
+        using ProblemTrackers = QHash<TorrentID, QSet<QString>>;  // <torrent ID, tracker URLs>
+
+        void handleTorrentsLoaded(const QList<Torrent *> &torrents);
+
+        void syncTorrent(const TorrentID &id, const QSet<QString> &trackers, Changes &changes);
+        void addTorrentTracker(const TorrentID &id, const QString &url, Changes &changes);
+        void removeTorrentTracker(const TorrentID &id, const QString &url, Changes &changes);
+        void addTorrentToHost(const TorrentID &id, const QString &host, Changes &changes);
+        void removeTorrentFromHost(const TorrentID &id, const QString &host, Changes &changes);
+        void setProblem(Problem problem, const TorrentID &id, const QString &url, bool isSet, Changes &changes);
+        void clearProblems(const TorrentID &id, Changes &changes);
+        void notify(const Changes &changes);
+
+        QHash<TorrentID, QSet<QString>> m_trackersByTorrent;
+        QHash<QString, QSet<TorrentID>> m_torrentsByTracker;
+        QHash<QString, QSet<QString>> m_trackersByHost;
+        // Torrent can have several trackers on the same host so the number of them is counted
+        QHash<QString, QHash<TorrentID, int>> m_torrentsByHost;
+        std::array<ProblemTrackers, 3> m_problems;
+    };
+}
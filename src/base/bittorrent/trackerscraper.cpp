@@ -0,0 +1,430 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "trackerscraper.h"
+
+#include <algorithm>
+
+#include <libtorrent/bdecode.hpp>
+#include <libtorrent/sha1_hash.hpp>
+
+#include <QtEndian>
+#include <QHostInfo>
+#include <QNetworkDatagram>
+#include <QRandomGenerator>
+#include <QUdpSocket>
+#include <QUrl>
+
+#include "base/global.h"
+#include "base/net/downloadmanager.h"
+#include "base/net/proxyconfigurationmanager.h"
+#include "base/preferences.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Trackers usually cap the number of hashes per scrape,
+    // BEP15 limits UDP scrapes to 74 hashes per packet
+    const int MAX_BATCH_SIZE = 64;
+    const int MAX_ACTIVE_REQUESTS = 8;
+    const qint64 MAX_RESPONSE_SIZE = 1024 * 1024;
+
+    const std::chrono::seconds MIN_REQUEST_INTERVAL = 10s;
+    const std::chrono::seconds BASE_RETRY_INTERVAL = 1min;
+    const std::chrono::seconds MAX_RETRY_INTERVAL = 1h;
+    const std::chrono::milliseconds UDP_TIMEOUT = 15s;
+
+    const quint64 UDP_PROTOCOL_ID = Q_UINT64_C(0x41727101980);
+    const quint32 UDP_ACTION_CONNECT = 0;
+    const quint32 UDP_ACTION_SCRAPE = 2;
+    const quint32 UDP_ACTION_ERROR = 3;
+
+    QByteArray toRawHash(const BitTorrent::TorrentID &torrentID)
+    {
+        const lt::sha1_hash nativeHash = torrentID;
+        return {nativeHash.data(), BitTorrent::TorrentID::length()};
+    }
+
+    bool isBTProxyEnabled()
+    {
+        return (Net::ProxyConfigurationManager::instance()->proxyConfiguration().type != Net::ProxyType::None)
+                && Preferences::instance()->useProxyForBT();
+    }
+}
+
+using namespace BitTorrent;
+
+TrackerScraper::TrackerScraper(QObject *parent)
+    : QObject(parent)
+    , m_udpSocket {new QUdpSocket(this)}
+{
+    m_processingTimer.setSingleShot(true);
+    connect(&m_processingTimer, &QTimer::timeout, this, &TrackerScraper::processQueue);
+
+    m_udpSocket->bind(QHostAddress::Any);
+    connect(m_udpSocket, &QUdpSocket::readyRead, this, &TrackerScraper::onUDPReadyRead);
+}
+
+QString TrackerScraper::scrapeURL(const QString &announceURL)
+{
+    const QUrl url {announceURL};
+    const QString scheme = url.scheme();
+    if (scheme == u"udp")
+        return url.host().isEmpty() || (url.port() <= 0) ? QString() : announceURL;
+
+    if ((scheme != u"http") && (scheme != u"https"))
+        return {};
+
+    // BEP48: the announce URL can be converted only if the last path component starts with "announce"
+    QString path = url.path();
+    const qsizetype lastSegmentPos = path.lastIndexOf(u'/') + 1;
+    if (!QStringView(path).sliced(lastSegmentPos).startsWith(u"announce"))
+        return {};
+
+    path.replace(lastSegmentPos, 8, u"scrape"_s);
+
+    QUrl result = url;
+    result.setPath(path);
+    return result.toString(QUrl::FullyEncoded);
+}
+
+void TrackerScraper::enqueue(const QString &scrapeURL, const TorrentID &torrentID)
+{
+    if (scrapeURL.isEmpty() || m_pendingTorrents.contains(torrentID))
+        return;
+
+    m_pendingTorrents.insert(torrentID);
+    m_trackers[scrapeURL].pendingTorrents.append(torrentID);
+    scheduleProcessing(0ms);
+}
+
+bool TrackerScraper::isPending(const TorrentID &torrentID) const
+{
+    return m_pendingTorrents.contains(torrentID);
+}
+
+void TrackerScraper::clearQueue()
+{
+    for (Tracker &tracker : m_trackers)
+    {
+        for (const TorrentID &torrentID : asConst(tracker.pendingTorrents))
+            m_pendingTorrents.remove(torrentID);
+        tracker.pendingTorrents.clear();
+    }
+}
+
+void TrackerScraper::processQueue()
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point nextWakeUpTime = std::chrono::steady_clock::time_point::max();
+
+    for (auto it = m_trackers.begin(); it != m_trackers.end();)
+    {
+        Tracker &tracker = it.value();
+        if (tracker.isBusy || tracker.pendingTorrents.isEmpty())
+        {
+            // Forget idle trackers once nothing is left to remember about them
+            if (!tracker.isBusy && (tracker.failuresCount == 0) && (tracker.nextRequestTime <= now))
+                it = m_trackers.erase(it);
+            else
+                ++it;
+            continue;
+        }
+
+        if (tracker.nextRequestTime > now)
+        {
+            nextWakeUpTime = std::min(nextWakeUpTime, tracker.nextRequestTime);
+            ++it;
+            continue;
+        }
+
+        if (m_activeRequestsCount >= MAX_ACTIVE_REQUESTS)
+            break;
+
+        const qsizetype batchSize = std::min<qsizetype>(tracker.pendingTorrents.size(), MAX_BATCH_SIZE);
+        const QList<TorrentID> batch = tracker.pendingTorrents.first(batchSize);
+        tracker.pendingTorrents.remove(0, batchSize);
+        tracker.isBusy = true;
+        ++m_activeRequestsCount;
+
+        const QString url = it.key();
+        ++it;
+
+        if (url.startsWith(u"udp://"))
+            scrapeUDP(url, batch);
+        else
+            scrapeHTTP(url, batch);
+    }
+
+    if (nextWakeUpTime != std::chrono::steady_clock::time_point::max())
+        scheduleProcessing(std::chrono::ceil<std::chrono::milliseconds>(nextWakeUpTime - now));
+}
+
+void TrackerScraper::scheduleProcessing(const std::chrono::milliseconds delay)
+{
+    if (m_processingTimer.isActive() && (m_processingTimer.remainingTimeAsDuration() <= delay))
+        return;
+
+    m_processingTimer.start(delay);
+}
+
+void TrackerScraper::scrapeHTTP(const QString &scrapeURL, const QList<TorrentID> &torrents)
+{
+    QHash<QByteArray, TorrentID> torrentsByHash;
+    torrentsByHash.reserve(torrents.size());
+
+    QByteArray query;
+    for (const TorrentID &torrentID : torrents)
+    {
+        const QByteArray rawHash = toRawHash(torrentID);
+        torrentsByHash.insert(rawHash, torrentID);
+
+        if (!query.isEmpty())
+            query.append('&');
+        query.append("info_hash=").append(rawHash.toPercentEncoding());
+    }
+
+    const QString url = scrapeURL + (scrapeURL.contains(u'?') ? u'&' : u'?') + QString::fromLatin1(query);
+    Net::DownloadManager::instance()->download(Net::DownloadRequest(url).limit(MAX_RESPONSE_SIZE)
+            , Preferences::instance()->useProxyForBT(), this
+            , [this, scrapeURL, torrents, torrentsByHash](const Net::DownloadResult &result)
+    {
+        if (result.status != Net::DownloadStatus::Success)
+        {
+            handleFailed(scrapeURL, torrents, result.errorString);
+            return;
+        }
+
+        const auto *pref = Preferences::instance();
+        lt::error_code ec;
+        const lt::bdecode_node root = lt::bdecode(result.data, ec, nullptr
+                , pref->getBdecodeDepthLimit(), pref->getBdecodeTokenLimit());
+        if (ec || (root.type() != lt::bdecode_node::dict_t))
+        {
+            handleFailed(scrapeURL, torrents, tr("Invalid scrape response"));
+            return;
+        }
+
+        if (const std::string_view failureReason = root.dict_find_string_value("failure reason"); !failureReason.empty())
+        {
+            handleFailed(scrapeURL, torrents, QString::fromUtf8(failureReason.data(), failureReason.size()));
+            return;
+        }
+
+        // Torrents unknown to the tracker are reported with unknown counts
+        // so that they are not scraped again until the statistics expire
+        const QDateTime now = QDateTime::currentDateTimeUtc();
+        QHash<TorrentID, SwarmStats> stats;
+        stats.reserve(torrents.size());
+        for (const TorrentID &torrentID : torrents)
+            stats.insert(torrentID, {.updateTime = now});
+
+        if (const lt::bdecode_node files = root.dict_find_dict("files"))
+        {
+            for (int i = 0; i < files.dict_size(); ++i)
+            {
+                const auto [hash, fileStats] = files.dict_at(i);
+                const TorrentID torrentID = torrentsByHash.value(QByteArray(hash.data(), hash.size()));
+                if (!torrentID.isValid() || (fileStats.type() != lt::bdecode_node::dict_t))
+                    continue;
+
+                stats[torrentID] = {
+                    .seedsCount = static_cast<int>(fileStats.dict_find_int_value("complete", -1)),
+                    .leechersCount = static_cast<int>(fileStats.dict_find_int_value("incomplete", -1)),
+                    .downloadedCount = static_cast<int>(fileStats.dict_find_int_value("downloaded", -1)),
+                    .updateTime = now
+                };
+            }
+        }
+
+        std::chrono::seconds minInterval = 0s;
+        if (const lt::bdecode_node flags = root.dict_find_dict("flags"))
+            minInterval = std::chrono::seconds(flags.dict_find_int_value("min_request_interval", 0));
+
+        handleSucceeded(scrapeURL, torrents, stats, minInterval);
+    });
+}
+
+void TrackerScraper::scrapeUDP(const QString &scrapeURL, const QList<TorrentID> &torrents)
+{
+    // UDP tracker traffic cannot be sent through the proxy, so don't leak it
+    if (isBTProxyEnabled())
+    {
+        handleFailed(scrapeURL, torrents, tr("UDP trackers cannot be scraped through a proxy"));
+        return;
+    }
+
+    const QUrl url {scrapeURL};
+
+    quint32 transactionID = QRandomGenerator::global()->generate();
+    while (m_udpRequests.contains(transactionID))
+        ++transactionID;
+
+    m_udpRequests.insert(transactionID, {.scrapeURL = scrapeURL, .torrents = torrents
+            , .port = static_cast<quint16>(url.port())});
+
+    QHostInfo::lookupHost(url.host(), this, [this, transactionID](const QHostInfo &hostInfo)
+    {
+        const auto iter = m_udpRequests.find(transactionID);
+        if (iter == m_udpRequests.end())
+            return;
+
+        if ((hostInfo.error() != QHostInfo::NoError) || hostInfo.addresses().isEmpty())
+        {
+            const UDPRequest request = m_udpRequests.take(transactionID);
+            handleFailed(request.scrapeURL, request.torrents, hostInfo.errorString());
+            return;
+        }
+
+        iter->address = hostInfo.addresses().constFirst();
+
+        QByteArray packet (16, 0);
+        qToBigEndian<quint64>(UDP_PROTOCOL_ID, packet.data());
+        qToBigEndian<quint32>(UDP_ACTION_CONNECT, packet.data() + 8);
+        qToBigEndian<quint32>(transactionID, packet.data() + 12);
+        sendUDPRequest(transactionID, packet, UDPRequest::Stage::Connecting);
+    });
+}
+
+void TrackerScraper::sendUDPRequest(const quint32 transactionID, const QByteArray &packet, const UDPRequest::Stage stage)
+{
+    UDPRequest &request = m_udpRequests[transactionID];
+    request.stage = stage;
+    m_udpSocket->writeDatagram(packet, request.address, request.port);
+
+    QTimer::singleShot(UDP_TIMEOUT, this, [this, transactionID, stage]
+    {
+        const auto iter = m_udpRequests.constFind(transactionID);
+        if ((iter == m_udpRequests.cend()) || (iter->stage != stage))
+            return;
+
+        const UDPRequest request = m_udpRequests.take(transactionID);
+        handleFailed(request.scrapeURL, request.torrents, tr("Tracker didn't respond in time"));
+    });
+}
+
+void TrackerScraper::onUDPReadyRead()
+{
+    while (m_udpSocket->hasPendingDatagrams())
+    {
+        const QByteArray data = m_udpSocket->receiveDatagram().data();
+        if (data.size() < 8)
+            continue;
+
+        const auto action = qFromBigEndian<quint32>(data.constData());
+        const auto transactionID = qFromBigEndian<quint32>(data.constData() + 4);
+        const auto iter = m_udpRequests.find(transactionID);
+        if (iter == m_udpRequests.end())
+            continue;
+
+        if (action == UDP_ACTION_ERROR)
+        {
+            const UDPRequest request = m_udpRequests.take(transactionID);
+            handleFailed(request.scrapeURL, request.torrents, QString::fromUtf8(data.sliced(8)));
+        }
+        else if ((iter->stage == UDPRequest::Stage::Connecting) && (action == UDP_ACTION_CONNECT) && (data.size() >= 16))
+        {
+            const auto connectionID = qFromBigEndian<quint64>(data.constData() + 8);
+
+            QByteArray packet ((16 + (iter->torrents.size() * TorrentID::length())), 0);
+            qToBigEndian<quint64>(connectionID, packet.data());
+            qToBigEndian<quint32>(UDP_ACTION_SCRAPE, packet.data() + 8);
+            qToBigEndian<quint32>(transactionID, packet.data() + 12);
+            qsizetype offset = 16;
+            for (const TorrentID &torrentID : asConst(iter->torrents))
+            {
+                const QByteArray rawHash = toRawHash(torrentID);
+                std::copy(rawHash.cbegin(), rawHash.cend(), (packet.begin() + offset));
+                offset += rawHash.size();
+            }
+
+            sendUDPRequest(transactionID, packet, UDPRequest::Stage::Scraping);
+        }
+        else if ((iter->stage == UDPRequest::Stage::Scraping) && (action == UDP_ACTION_SCRAPE))
+        {
+            const UDPRequest request = m_udpRequests.take(transactionID);
+            const QDateTime now = QDateTime::currentDateTimeUtc();
+
+            QHash<TorrentID, SwarmStats> stats;
+            stats.reserve(request.torrents.size());
+            for (qsizetype i = 0; i < request.torrents.size(); ++i)
+            {
+                SwarmStats torrentStats {.updateTime = now};
+                if (const qsizetype offset = 8 + (i * 12); (offset + 12) <= data.size())
+                {
+                    torrentStats.seedsCount = qFromBigEndian<qint32>(data.constData() + offset);
+                    torrentStats.downloadedCount = qFromBigEndian<qint32>(data.constData() + offset + 4);
+                    torrentStats.leechersCount = qFromBigEndian<qint32>(data.constData() + offset + 8);
+                }
+                stats.insert(request.torrents[i], torrentStats);
+            }
+
+            handleSucceeded(request.scrapeURL, request.torrents, stats, 0s);
+        }
+    }
+}
+
+void TrackerScraper::handleSucceeded(const QString &scrapeURL, const QList<TorrentID> &torrents
+        , const QHash<TorrentID, SwarmStats> &stats, const std::chrono::seconds minInterval)
+{
+    --m_activeRequestsCount;
+    for (const TorrentID &torrentID : torrents)
+        m_pendingTorrents.remove(torrentID);
+
+    if (const auto iter = m_trackers.find(scrapeURL); iter != m_trackers.end())
+    {
+        iter->isBusy = false;
+        iter->failuresCount = 0;
+        iter->nextRequestTime = std::chrono::steady_clock::now() + std::max(minInterval, MIN_REQUEST_INTERVAL);
+    }
+
+    if (!stats.isEmpty())
+        emit statsReceived(stats);
+
+    scheduleProcessing(0ms);
+}
+
+void TrackerScraper::handleFailed(const QString &scrapeURL, const QList<TorrentID> &torrents, const QString &error)
+{
+    qDebug("Failed to scrape tracker \"%s\": %s", qUtf8Printable(scrapeURL), qUtf8Printable(error));
+
+    --m_activeRequestsCount;
+    for (const TorrentID &torrentID : torrents)
+        m_pendingTorrents.remove(torrentID);
+
+    if (const auto iter = m_trackers.find(scrapeURL); iter != m_trackers.end())
+    {
+        iter->isBusy = false;
+        iter->failuresCount = std::min((iter->failuresCount + 1), 8);
+        const std::chrono::seconds retryInterval = std::min((BASE_RETRY_INTERVAL * (1 << (iter->failuresCount - 1))), MAX_RETRY_INTERVAL);
+        iter->nextRequestTime = std::chrono::steady_clock::now() + retryInterval;
+    }
+
+    scheduleProcessing(0ms);
+}
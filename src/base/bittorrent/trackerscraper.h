@@ -0,0 +1,113 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <QtContainerFwd>
+#include <QByteArray>
+#include <QHash>
+#include <QHostAddress>
+#include <QList>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QTimer>
+
+#include "infohash.h"
+#include "swarmstats.h"
+
+class QUdpSocket;
+
+namespace BitTorrent
+{
+    // Scrapes the trackers for the statistics of several torrents at once.
+    // Torrents are queued per tracker and sent in batches, one request per tracker at a time.
+    class TrackerScraper final : public QObject
+    {
+        Q_OBJECT
+        Q_DISABLE_COPY_MOVE(TrackerScraper)
+
+    public:
+        explicit TrackerScraper(QObject *parent = nullptr);
+
+        // Returns the URL to scrape the tracker at, or empty string if the tracker cannot be scraped
+        static QString scrapeURL(const QString &announceURL);
+
+        void enqueue(const QString &scrapeURL, const TorrentID &torrentID);
+        bool isPending(const TorrentID &torrentID) const;
+        // Drops the torrents which are not being scraped yet
+        void clearQueue();
+
+    signals:
+        void statsReceived(const QHash<BitTorrent::TorrentID, BitTorrent::SwarmStats> &stats);
+
+    private:
+        struct Tracker
+        {
+            QList<TorrentID> pendingTorrents;
+            bool isBusy = false;
+            std::chrono::steady_clock::time_point nextRequestTime;
+            int failuresCount = 0;
+        };
+
+        struct UDPRequest
+        {
+            enum class Stage
+            {
+                Connecting,
+                Scraping
+            };
+
+            QString scrapeURL;
+            QList<TorrentID> torrents;
+            QHostAddress address;
+            quint16 port = 0;
+            Stage stage = Stage::Connecting;
+        };
+
+        void processQueue();
+        void scheduleProcessing(std::chrono::milliseconds delay);
+        void scrapeHTTP(const QString &scrapeURL, const QList<TorrentID> &torrents);
+        void scrapeUDP(const QString &scrapeURL, const QList<TorrentID> &torrents);
+        void sendUDPRequest(quint32 transactionID, const QByteArray &packet, UDPRequest::Stage stage);
+        void onUDPReadyRead();
+        void handleSucceeded(const QString &scrapeURL, const QList<TorrentID> &torrents
+                , const QHash<TorrentID, SwarmStats> &stats, std::chrono::seconds minInterval);
+        void handleFailed(const QString &scrapeURL, const QList<TorrentID> &torrents, const QString &error);
+
+        QHash<QString, Tracker> m_trackers;
+        QSet<TorrentID> m_pendingTorrents;
+        int m_activeRequestsCount = 0;
+        QTimer m_processingTimer;
+
+        QUdpSocket *m_udpSocket = nullptr;
+        QHash<quint32, UDPRequest> m_udpRequests;
+    };
+}
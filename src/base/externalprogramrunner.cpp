@@ -0,0 +1,439 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "externalprogramrunner.h"
+
+#include <chrono>
+
+#ifdef Q_OS_WIN
+#include <memory>
+#include <windows.h>
+#include <shellapi.h>
+#endif
+
+#include <QDeadlineTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QTimer>
+
+#include "base/bittorrent/infohash.h"
+#include "base/bittorrent/torrent.h"
+#include "base/global.h"
+#include "base/logger.h"
+#include "base/preferences.h"
+#include "base/utils/string.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    const int MAX_BATCH_SIZE = 100;
+    const std::chrono::milliseconds BATCH_DELAY = 1s;
+    const std::chrono::milliseconds SHUTDOWN_TIMEOUT = 5s;
+
+    QString replaceVariables(QString str, const BitTorrent::Torrent *torrent)
+    {
+        for (qsizetype i = (str.length() - 2); i >= 0; --i)
+        {
+            if (str[i] != u'%')
+                continue;
+
+            const ushort specifier = str[i + 1].unicode();
+            switch (specifier)
+            {
+            case u'C':
+                str.replace(i, 2, QString::number(torrent->filesCount()));
+                break;
+            case u'D':
+                str.replace(i, 2, torrent->savePath().toString());
+                break;
+            case u'F':
+                str.replace(i, 2, torrent->contentPath().toString());
+                break;
+            case u'G':
+                str.replace(i, 2, Utils::String::joinIntoString(torrent->tags(), u","_s));
+                break;
+            case u'I':
+                str.replace(i, 2, (torrent->infoHash().v1().isValid() ? torrent->infoHash().v1().toString() : u"-"_s));
+                break;
+            case u'J':
+                str.replace(i, 2, (torrent->infoHash().v2().isValid() ? torrent->infoHash().v2().toString() : u"-"_s));
+                break;
+            case u'K':
+                str.replace(i, 2, torrent->id().toString());
+                break;
+            case u'L':
+                str.replace(i, 2, torrent->category());
+                break;
+            case u'M':
+                str.replace(i, 2, torrent->comment());
+                break;
+            case u'N':
+                str.replace(i, 2, torrent->name());
+                break;
+            case u'R':
+                str.replace(i, 2, torrent->rootPath().toString());
+                break;
+            case u'T':
+                str.replace(i, 2, torrent->currentTracker());
+                break;
+            case u'Z':
+                str.replace(i, 2, QString::number(torrent->totalSize()));
+                break;
+            default:
+                // do nothing
+                break;
+            }
+
+            // decrement `i` to avoid unwanted replacement, example pattern: "%%N"
+            --i;
+        }
+
+        return str;
+    }
+
+    QJsonObject serializeTorrent(const BitTorrent::Torrent *torrent)
+    {
+        return {
+            {u"name"_s, torrent->name()},
+            {u"id"_s, torrent->id().toString()},
+            {u"info_hash_v1"_s, (torrent->infoHash().v1().isValid() ? torrent->infoHash().v1().toString() : u"-"_s)},
+            {u"info_hash_v2"_s, (torrent->infoHash().v2().isValid() ? torrent->infoHash().v2().toString() : u"-"_s)},
+            {u"category"_s, torrent->category()},
+            {u"tags"_s, Utils::String::joinIntoString(torrent->tags(), u","_s)},
+            {u"content_path"_s, torrent->contentPath().toString()},
+            {u"root_path"_s, torrent->rootPath().toString()},
+            {u"save_path"_s, torrent->savePath().toString()},
+            {u"files_count"_s, torrent->filesCount()},
+            {u"total_size"_s, torrent->totalSize()},
+            {u"tracker"_s, torrent->currentTracker()},
+            {u"comment"_s, torrent->comment()}
+        };
+    }
+
+#ifdef Q_OS_WIN
+    void setConsoleFlags(QProcess::CreateProcessArguments *args)
+    {
+        if (Preferences::instance()->isAutoRunConsoleEnabled())
+        {
+            args->flags |= CREATE_NEW_CONSOLE;
+            args->flags &= ~(CREATE_NO_WINDOW | DETACHED_PROCESS);
+        }
+        else
+        {
+            args->flags |= CREATE_NO_WINDOW;
+            args->flags &= ~(CREATE_NEW_CONSOLE | DETACHED_PROCESS);
+        }
+    }
+#endif
+}
+
+ExternalProgramRunner::ExternalProgramRunner(QObject *parent)
+    : QObject(parent)
+    , m_batchTimer {new QTimer(this)}
+{
+    m_batchTimer->setSingleShot(true);
+    m_batchTimer->setInterval(BATCH_DELAY);
+    connect(m_batchTimer, &QTimer::timeout, this, &ExternalProgramRunner::flushBatches);
+}
+
+ExternalProgramRunner::~ExternalProgramRunner()
+{
+    // Give the running programs a chance to complete,
+    // the remaining ones are killed when their QProcess instances are destroyed
+    const QDeadlineTimer deadline {SHUTDOWN_TIMEOUT};
+    const QList<QProcess *> processes = m_runningJobs.keys();
+    for (QProcess *process : processes)
+    {
+        disconnect(process, nullptr, this, nullptr);
+        process->waitForFinished(static_cast<int>(deadline.remainingTime()));
+    }
+}
+
+void ExternalProgramRunner::run(const QString &programTemplate, const BitTorrent::Torrent *torrent)
+{
+    // Cannot give users shell environment by default, as doing so could
+    // enable command injection via torrent name and other arguments
+    // (especially when some automated download mechanism has been setup).
+    // See: https://github.com/qbittorrent/qBittorrent/issues/10925
+
+    const Preferences *pref = Preferences::instance();
+    if (pref->isAutoRunBatchingEnabled())
+    {
+        QJsonArray &batch = m_batches[programTemplate];
+        batch.append(serializeTorrent(torrent));
+        if (batch.size() >= MAX_BATCH_SIZE)
+            flushBatches();
+        else if (!m_batchTimer->isActive())
+            m_batchTimer->start();
+        return;
+    }
+
+    std::optional<Job> job = makeJob(programTemplate, torrent);
+    if (!job)
+        return;
+
+    if (pref->getAutoRunMaxConcurrentProcesses() <= 0)
+    {
+        startDetached(job.value());
+        return;
+    }
+
+    m_queue.enqueue(std::move(job.value()));
+    startJobs();
+}
+
+ExternalProgramStats ExternalProgramRunner::stats() const
+{
+    ExternalProgramStats stats = m_stats;
+    stats.runningCount = m_runningJobs.size();
+    stats.queuedCount = m_queue.size();
+    return stats;
+}
+
+std::optional<ExternalProgramRunner::Job> ExternalProgramRunner::makeJob(const QString &programTemplate, const BitTorrent::Torrent *torrent)
+{
+    // Variables are replaced only when the program is run for a single torrent,
+    // in batching mode it receives the properties of torrents via standard input
+    const auto replace = [torrent](const QString &str)
+    {
+        return (torrent ? replaceVariables(str, torrent) : str);
+    };
+
+    Job job;
+    if (torrent)
+        job.subject = tr("Torrent: \"%1\"").arg(torrent->name());
+
+    // The processing sequence is different for Windows and other OS, this is intentional
+#if defined(Q_OS_WIN)
+    const QString program = replace(programTemplate);
+    const std::wstring programWStr = program.toStdWString();
+
+    // Need to split arguments manually because QProcess::startDetached(QString)
+    // will strip off empty parameters.
+    // E.g. `python.exe "1" "" "3"` will become `python.exe "1" "3"`
+    int argCount = 0;
+    std::unique_ptr<LPWSTR[], decltype(&::LocalFree)> args {::CommandLineToArgvW(programWStr.c_str(), &argCount), ::LocalFree};
+
+    if (argCount <= 0)
+        return std::nullopt;
+
+    for (int i = 1; i < argCount; ++i)
+        job.arguments += QString::fromWCharArray(args[i]);
+
+    job.program = QString::fromWCharArray(args[0]);
+    job.command = program;
+#else // Q_OS_WIN
+    QStringList args = Utils::String::splitCommand(programTemplate);
+
+    if (args.isEmpty())
+        return std::nullopt;
+
+    for (QString &arg : args)
+    {
+        // strip redundant quotes
+        if (arg.startsWith(u'"') && arg.endsWith(u'"'))
+        {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 8, 0)
+            arg.slice(1, (arg.size() - 2));
+#else
+            arg.removeLast().removeFirst();
+#endif
+        }
+
+        arg = replace(arg);
+    }
+
+    job.program = args.takeFirst();
+    job.arguments = args;
+    // show intended command in log
+    job.command = replace(programTemplate);
+#endif
+
+    return job;
+}
+
+void ExternalProgramRunner::flushBatches()
+{
+    m_batchTimer->stop();
+
+    for (auto it = m_batches.cbegin(); it != m_batches.cend(); ++it)
+    {
+        std::optional<Job> job = makeJob(it.key(), nullptr);
+        if (!job)
+            continue;
+
+        job->subject = tr("Torrents: %1").arg(it.value().size());
+        job->input = QJsonDocument(it.value()).toJson(QJsonDocument::Compact);
+        m_queue.enqueue(std::move(job.value()));
+    }
+    m_batches.clear();
+
+    startJobs();
+}
+
+void ExternalProgramRunner::startJobs()
+{
+    const int maxConcurrentProcesses = Preferences::instance()->getAutoRunMaxConcurrentProcesses();
+    while (!m_queue.isEmpty() && ((maxConcurrentProcesses <= 0) || (m_runningJobs.size() < maxConcurrentProcesses)))
+        startJob(m_queue.dequeue());
+}
+
+void ExternalProgramRunner::startJob(const Job &job)
+{
+    auto *process = new QProcess(this);
+    process->setProgram(job.program);
+    process->setArguments(job.arguments);
+    process->setStandardOutputFile(QProcess::nullDevice());
+    process->setStandardErrorFile(QProcess::nullDevice());
+    if (job.input.isEmpty())
+        process->setStandardInputFile(QProcess::nullDevice());
+#ifdef Q_OS_WIN
+    process->setCreateProcessArgumentsModifier(setConsoleFlags);
+#else
+    process->setUnixProcessParameters(QProcess::UnixProcessFlag::CloseFileDescriptors);
+#endif
+
+    connect(process, &QProcess::started, this, [this]
+    {
+        ++m_stats.startedCount;
+    });
+    connect(process, &QProcess::finished, this, [this, process](const int exitCode, const QProcess::ExitStatus exitStatus)
+    {
+        handleProcessFinished(process, exitCode, (exitStatus == QProcess::CrashExit));
+    });
+    connect(process, &QProcess::errorOccurred, this, [this, process](const QProcess::ProcessError error)
+    {
+        if (error == QProcess::FailedToStart)
+            handleProcessFailedToStart(process);
+    });
+
+    RunningJob &runningJob = m_runningJobs[process];
+    runningJob.command = job.command;
+    runningJob.subject = job.subject;
+    runningJob.elapsedTimer.start();
+
+    LogMsg(tr("Running external program. %1. Command: `%2`").arg(job.subject, job.command));
+
+    process->start();
+    if (!job.input.isEmpty())
+    {
+        process->write(job.input);
+        process->closeWriteChannel();
+    }
+
+    const int timeout = Preferences::instance()->getAutoRunTimeout();
+    if (timeout > 0)
+    {
+        QTimer::singleShot(std::chrono::seconds(timeout), process, [this, process]
+        {
+            const auto it = m_runningJobs.find(process);
+            if (it == m_runningJobs.end())
+                return;
+
+            it->isTimedOut = true;
+            process->kill();
+        });
+    }
+}
+
+void ExternalProgramRunner::startDetached(const Job &job)
+{
+    QProcess proc;
+    proc.setProgram(job.program);
+    proc.setArguments(job.arguments);
+#ifdef Q_OS_WIN
+    proc.setCreateProcessArgumentsModifier([](QProcess::CreateProcessArguments *args)
+    {
+        setConsoleFlags(args);
+        args->inheritHandles = false;
+        args->startupInfo->dwFlags &= ~STARTF_USESTDHANDLES;
+        ::CloseHandle(args->startupInfo->hStdInput);
+        ::CloseHandle(args->startupInfo->hStdOutput);
+        ::CloseHandle(args->startupInfo->hStdError);
+        args->startupInfo->hStdInput = nullptr;
+        args->startupInfo->hStdOutput = nullptr;
+        args->startupInfo->hStdError = nullptr;
+    });
+#else
+    proc.setUnixProcessParameters(QProcess::UnixProcessFlag::CloseFileDescriptors);
+#endif
+
+    if (proc.startDetached())
+    {
+        ++m_stats.startedCount;
+        LogMsg(tr("Running external program. %1. Command: `%2`").arg(job.subject, job.command));
+    }
+    else
+    {
+        ++m_stats.failedCount;
+        LogMsg(tr("Failed to run external program. %1. Command: `%2`").arg(job.subject, job.command));
+    }
+}
+
+void ExternalProgramRunner::handleProcessFinished(QProcess *process, const int exitCode, const bool isCrashed)
+{
+    const RunningJob job = m_runningJobs.take(process);
+    process->deleteLater();
+
+    const qint64 runTime = job.elapsedTimer.elapsed();
+    m_stats.totalRunTime += runTime;
+
+    if (job.isTimedOut)
+    {
+        ++m_stats.timedOutCount;
+        LogMsg(tr("External program was terminated due to timeout. %1. Command: `%2`. Run time: %3 ms")
+            .arg(job.subject, job.command, QString::number(runTime)), Log::WARNING);
+    }
+    else if (isCrashed || (exitCode != 0))
+    {
+        ++m_stats.failedCount;
+        LogMsg(tr("External program failed. %1. Command: `%2`. Exit code: %3. Run time: %4 ms")
+            .arg(job.subject, job.command, QString::number(exitCode), QString::number(runTime)), Log::WARNING);
+    }
+    else
+    {
+        ++m_stats.succeededCount;
+        LogMsg(tr("External program completed. %1. Command: `%2`. Run time: %3 ms")
+            .arg(job.subject, job.command, QString::number(runTime)));
+    }
+
+    startJobs();
+}
+
+void ExternalProgramRunner::handleProcessFailedToStart(QProcess *process)
+{
+    const RunningJob job = m_runningJobs.take(process);
+    process->deleteLater();
+
+    ++m_stats.failedCount;
+    LogMsg(tr("Failed to run external program. %1. Command: `%2`").arg(job.subject, job.command), Log::WARNING);
+
+    startJobs();
+}
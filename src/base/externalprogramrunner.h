@@ -0,0 +1,112 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonArray>
+#include <QObject>
+#include <QQueue>
+#include <QString>
+#include <QStringList>
+
+class QProcess;
+class QTimer;
+
+namespace BitTorrent
+{
+    class Torrent;
+}
+
+struct ExternalProgramStats
+{
+    qint64 startedCount = 0;
+    qint64 succeededCount = 0;
+    qint64 failedCount = 0;
+    qint64 timedOutCount = 0;
+    // of the programs which completion is tracked, in milliseconds
+    qint64 totalRunTime = 0;
+    int runningCount = 0;
+    int queuedCount = 0;
+};
+
+// Runs the programs configured to be launched when torrents are added or finished.
+// If the number of simultaneously running programs is limited (or batching is enabled)
+// the programs are tracked until they exit and the ones exceeding the limit are queued.
+// In batching mode the program is run once for several torrents, it receives
+// their properties via standard input as JSON array.
+class ExternalProgramRunner final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(ExternalProgramRunner)
+
+public:
+    explicit ExternalProgramRunner(QObject *parent = nullptr);
+    ~ExternalProgramRunner() override;
+
+    void run(const QString &programTemplate, const BitTorrent::Torrent *torrent);
+    ExternalProgramStats stats() const;
+
+private:
+    struct Job
+    {
+        QString program;
+        QStringList arguments;
+        QString command;
+        QString subject;
+        QByteArray input;
+    };
+
+    struct RunningJob
+    {
+        QString command;
+        QString subject;
+        QElapsedTimer elapsedTimer;
+        bool isTimedOut = false;
+    };
+
+    static std::optional<Job> makeJob(const QString &programTemplate, const BitTorrent::Torrent *torrent);
+
+    void flushBatches();
+    void startJobs();
+    void startJob(const Job &job);
+    void startDetached(const Job &job);
+    void handleProcessFinished(QProcess *process, int exitCode, bool isCrashed);
+    void handleProcessFailedToStart(QProcess *process);
+
+    QQueue<Job> m_queue;
+    // torrents waiting to be passed to the program, by program template
+    QHash<QString, QJsonArray> m_batches;
+    QTimer *m_batchTimer = nullptr;
+    QHash<QProcess *, RunningJob> m_runningJobs;
+    ExternalProgramStats m_stats;
+};
@@ -36,6 +36,7 @@
 #include "base/pathfwd.h"
 
 class AddTorrentManager;
+class ExternalProgramRunner;
 class WebUI;
 struct QBtCommandLineParameters;
 
@@ -79,6 +80,10 @@ public:
     virtual void setFileLoggerAge(int value) = 0;
     virtual int fileLoggerAgeType() const = 0;
     virtual void setFileLoggerAgeType(int value) = 0;
+    virtual int fileLoggerFormat() const = 0;
+    virtual void setFileLoggerFormat(int value) = 0;
+    virtual bool isFileLoggerCompressBackups() const = 0;
+    virtual void setFileLoggerCompressBackups(bool value) = 0;
 
     virtual int memoryWorkingSetLimit() const = 0;
     virtual void setMemoryWorkingSetLimit(int size) = 0;
@@ -91,6 +96,7 @@ public:
 #endif
 
     virtual AddTorrentManager *addTorrentManager() const = 0;
+    virtual ExternalProgramRunner *externalProgramRunner() const = 0;
 #ifndef DISABLE_WEBUI
     virtual WebUI *webUI() const = 0;
 #endif
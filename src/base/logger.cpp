@@ -34,6 +34,8 @@
 #include <QDateTime>
 #include <QList>
 
+#include "base/memoryusagetracker.h"
+
 namespace
 {
     template <typename T>
@@ -52,6 +54,21 @@ Logger::Logger()
     : m_messages(MAX_LOG_MESSAGES)
     , m_peers(MAX_LOG_MESSAGES)
 {
+    if (auto *memoryUsageTracker = MemoryUsageTracker::instance())
+    {
+        memoryUsageTracker->addEstimator(MemoryComponent::Logs, this, [this]
+        {
+            const QReadLocker locker(&m_lock);
+
+            MemoryUsage usage;
+            usage.count = static_cast<qint64>(m_messages.size() + m_peers.size());
+            for (const Log::Msg &msg : m_messages)
+                usage.size += sizeof(Log::Msg) + estimateMemoryUsage(msg.message);
+            for (const Log::Peer &peer : m_peers)
+                usage.size += sizeof(Log::Peer) + estimateMemoryUsage(peer.ip) + estimateMemoryUsage(peer.reason);
+            return usage;
+        });
+    }
 }
 
 Logger *Logger::instance()
@@ -0,0 +1,154 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+
+#include "memoryusagetracker.h"
+
+#include <QByteArray>
+#include <QStringList>
+#include <QVariant>
+#include <QVariantHash>
+#include <QVariantList>
+#include <QVariantMap>
+
+namespace
+{
+    // Qt allocates container payload along with a header holding reference counter and capacity
+    const qint64 CONTAINER_HEADER_SIZE = 16;
+}
+
+MemoryUsageTracker *MemoryUsageTracker::m_instance = nullptr;
+
+void MemoryUsageTracker::initInstance()
+{
+    if (!m_instance)
+        m_instance = new MemoryUsageTracker;
+}
+
+void MemoryUsageTracker::freeInstance()
+{
+    delete m_instance;
+    m_instance = nullptr;
+}
+
+MemoryUsageTracker *MemoryUsageTracker::instance()
+{
+    return m_instance;
+}
+
+void MemoryUsageTracker::addEstimator(const QString &component, const QObject *owner, Estimator estimator)
+{
+    Q_ASSERT(owner);
+
+    m_estimators.append({.component = component, .owner = owner, .estimator = std::move(estimator)});
+    connect(owner, &QObject::destroyed, this, [this, owner]
+    {
+        m_estimators.removeIf([owner](const EstimatorEntry &entry) { return entry.owner == owner; });
+    });
+}
+
+QHash<QString, MemoryUsage> MemoryUsageTracker::estimate() const
+{
+    QHash<QString, MemoryUsage> result;
+    for (const EstimatorEntry &entry : m_estimators)
+    {
+        const MemoryUsage usage = entry.estimator();
+        MemoryUsage &total = result[entry.component];
+        total.size += usage.size;
+        total.count += usage.count;
+    }
+
+    return result;
+}
+
+qint64 estimateMemoryUsage(const QString &str)
+{
+    if (str.isEmpty())
+        return 0;
+
+    return CONTAINER_HEADER_SIZE + (str.capacity() * static_cast<qint64>(sizeof(QChar)));
+}
+
+qint64 estimateMemoryUsage(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return 0;
+
+    return CONTAINER_HEADER_SIZE + data.capacity();
+}
+
+qint64 estimateMemoryUsage(const QVariant &value)
+{
+    qint64 size = sizeof(QVariant);
+
+    switch (value.typeId())
+    {
+    case QMetaType::QString:
+        size += estimateMemoryUsage(value.toString());
+        break;
+    case QMetaType::QByteArray:
+        size += estimateMemoryUsage(value.toByteArray());
+        break;
+    case QMetaType::QStringList:
+        {
+            const QStringList list = value.toStringList();
+            size += CONTAINER_HEADER_SIZE;
+            for (const QString &str : list)
+                size += sizeof(QString) + estimateMemoryUsage(str);
+        }
+        break;
+    case QMetaType::QVariantList:
+        {
+            const QVariantList list = value.toList();
+            size += CONTAINER_HEADER_SIZE;
+            for (const QVariant &item : list)
+                size += estimateMemoryUsage(item);
+        }
+        break;
+    case QMetaType::QVariantMap:
+        {
+            const QVariantMap map = value.toMap();
+            size += CONTAINER_HEADER_SIZE;
+            for (auto it = map.cbegin(); it != map.cend(); ++it)
+                size += sizeof(QString) + estimateMemoryUsage(it.key()) + estimateMemoryUsage(it.value());
+        }
+        break;
+    case QMetaType::QVariantHash:
+        {
+            const QVariantHash hash = value.toHash();
+            size += CONTAINER_HEADER_SIZE;
+            for (auto it = hash.cbegin(); it != hash.cend(); ++it)
+                size += sizeof(QString) + estimateMemoryUsage(it.key()) + estimateMemoryUsage(it.value());
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
@@ -0,0 +1,97 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+
+#pragma once
+
+#include <functional>
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QString>
+
+#include "base/global.h"
+
+class QVariant;
+
+// Components of which the memory usage is estimated
+namespace MemoryComponent
+{
+    inline const QString Torrents = u"torrents"_s;
+    inline const QString Metadata = u"metadata"_s;
+    inline const QString Peers = u"peers"_s;
+    inline const QString DiskCache = u"disk_cache"_s;
+    inline const QString Logs = u"logs"_s;
+    inline const QString RSS = u"rss"_s;
+    inline const QString Search = u"search"_s;
+    inline const QString WebUISync = u"webui_sync"_s;
+}
+
+struct MemoryUsage
+{
+    qint64 size = 0;
+    qint64 count = 0;
+};
+
+class MemoryUsageTracker final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(MemoryUsageTracker)
+
+public:
+    using Estimator = std::function<MemoryUsage ()>;
+
+    static void initInstance();
+    static void freeInstance();
+    static MemoryUsageTracker *instance();
+
+    // Estimator is removed when its owner is destroyed.
+    // Estimations of the same component (e.g. of several WebUI clients) are summed up.
+    void addEstimator(const QString &component, const QObject *owner, Estimator estimator);
+    QHash<QString, MemoryUsage> estimate() const;
+
+private:
+    struct EstimatorEntry
+    {
+        QString component;
+        const QObject *owner = nullptr;
+        Estimator estimator;
+    };
+
+    MemoryUsageTracker() = default;
+    ~MemoryUsageTracker() override = default;
+
+    static MemoryUsageTracker *m_instance;
+    QList<EstimatorEntry> m_estimators;
+};
+
+// Helpers for approximating the heap memory held by Qt containers
+qint64 estimateMemoryUsage(const QString &str);
+qint64 estimateMemoryUsage(const QByteArray &data);
+qint64 estimateMemoryUsage(const QVariant &value);
@@ -28,25 +28,61 @@
 
 #include "reverseresolution.h"
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include <QDateTime>
 #include <QHostInfo>
-#include <QString>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
 
-const int CACHE_SIZE = 2048;
+#include "base/global.h"
+#include "base/logger.h"
+#include "base/path.h"
+#include "base/profile.h"
+#include "base/utils/io.h"
 
+using namespace std::chrono_literals;
 using namespace Net;
 
 namespace
 {
+    const int MAX_CACHE_SIZE = 8192;
+    const int MAX_CONCURRENT_LOOKUPS = 16;
+    const qint64 HOSTNAME_TTL = 7 * 24 * 60 * 60;  // in seconds
+    const qint64 NEGATIVE_TTL = 60 * 60;  // in seconds
+    const auto NOTIFY_INTERVAL = 500ms;
+
+    const QString CACHE_FILE_NAME = u"hostnames.json"_s;
+    const QString KEY_HOSTNAME = u"hostname"_s;
+    const QString KEY_EXPIRATION_TIME = u"expires"_s;
+
     bool isUsefulHostName(const QString &hostname, const QHostAddress &ip)
     {
         return (!hostname.isEmpty() && (hostname != ip.toString()));
     }
+
+    Path cacheFilePath()
+    {
+        return specialFolderLocation(SpecialFolder::Cache) / Path(CACHE_FILE_NAME);
+    }
 }
 
 ReverseResolution::ReverseResolution(QObject *parent)
     : QObject(parent)
+    , m_notifyTimer {new QTimer(this)}
 {
-    m_cache.setMaxCost(CACHE_SIZE);
+    m_notifyTimer->setSingleShot(true);
+    m_notifyTimer->setInterval(NOTIFY_INTERVAL);
+    connect(m_notifyTimer, &QTimer::timeout, this, [this]
+    {
+        if (!m_resolvedHostnames.isEmpty())
+            emit ipsResolved(std::exchange(m_resolvedHostnames, {}));
+    });
+
+    loadCache();
 }
 
 ReverseResolution::~ReverseResolution()
@@ -54,35 +90,149 @@ ReverseResolution::~ReverseResolution()
     // abort on-going lookups instead of waiting them
     for (auto iter = m_lookups.cbegin(); iter != m_lookups.cend(); ++iter)
         QHostInfo::abortHostLookup(iter.key());
+
+    storeCache();
 }
 
 void ReverseResolution::resolve(const QHostAddress &ip)
 {
-    const QString *hostname = m_cache.object(ip);
-    if (hostname)
+    if (const auto iter = m_cache.constFind(ip); iter != m_cache.cend())
     {
-        emit ipResolved(ip, *hostname);
-        return;
+        if (iter->expirationTime > QDateTime::currentSecsSinceEpoch())
+        {
+            notifyResolved(ip, iter->hostname);
+            return;
+        }
+
+        m_cache.erase(iter);
     }
 
-    // do reverse lookup: IP -> hostname
-    const int lookupId = QHostInfo::lookupHost(ip.toString(), this, &ReverseResolution::hostResolved);
-    m_lookups.insert(lookupId, ip);
+    if (m_pendingIPs.contains(ip))
+        return;
+
+    m_pendingIPs.insert(ip);
+    m_lookupQueue.append(ip);
+    startLookups();
+}
+
+void ReverseResolution::startLookups()
+{
+    while (!m_lookupQueue.isEmpty() && (m_lookups.size() < MAX_CONCURRENT_LOOKUPS))
+    {
+        // do reverse lookup: IP -> hostname
+        const QHostAddress ip = m_lookupQueue.takeFirst();
+        const int lookupId = QHostInfo::lookupHost(ip.toString(), this, &ReverseResolution::hostResolved);
+        m_lookups.insert(lookupId, ip);
+    }
 }
 
 void ReverseResolution::hostResolved(const QHostInfo &host)
 {
     const QHostAddress ip = m_lookups.take(host.lookupId());
+    m_pendingIPs.remove(ip);
+
+    const QString hostname = ((host.error() == QHostInfo::NoError) && isUsefulHostName(host.hostName(), ip))
+        ? host.hostName()
+        : QString();
+    cacheHostName(ip, hostname);
+    notifyResolved(ip, hostname);
+
+    startLookups();
+}
+
+void ReverseResolution::cacheHostName(const QHostAddress &ip, const QString &hostname)
+{
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+
+    if (m_cache.size() >= MAX_CACHE_SIZE)
+    {
+        for (auto iter = m_cache.begin(); iter != m_cache.end();)
+        {
+            if (iter->expirationTime <= now)
+                iter = m_cache.erase(iter);
+            else
+                ++iter;
+        }
+
+        while (m_cache.size() >= MAX_CACHE_SIZE)
+            m_cache.erase(m_cache.begin());
+    }
 
-    if (host.error() != QHostInfo::NoError)
+    const qint64 ttl = hostname.isEmpty() ? NEGATIVE_TTL : HOSTNAME_TTL;
+    m_cache.insert(ip, {.hostname = hostname, .expirationTime = (now + ttl)});
+}
+
+void ReverseResolution::notifyResolved(const QHostAddress &ip, const QString &hostname)
+{
+    if (hostname.isEmpty())
+        return;
+
+    m_resolvedHostnames.insert(ip, hostname);
+    if (!m_notifyTimer->isActive())
+        m_notifyTimer->start();
+}
+
+void ReverseResolution::loadCache()
+{
+    const int fileMaxSize = 16 * 1024 * 1024;
+    const Path path = cacheFilePath();
+
+    const auto readResult = Utils::IO::readFile(path, fileMaxSize);
+    if (!readResult)
     {
-        emit ipResolved(ip, {});
+        if (readResult.error().status != Utils::IO::ReadError::NotExist)
+            LogMsg(tr("Failed to load host name cache. %1").arg(readResult.error().message), Log::WARNING);
         return;
     }
 
-    const QString hostname = isUsefulHostName(host.hostName(), ip)
-        ? host.hostName()
-        : QString();
-    m_cache.insert(ip, new QString(hostname));
-    emit ipResolved(ip, hostname);
+    QJsonParseError jsonError;
+    const QJsonDocument jsonDoc = QJsonDocument::fromJson(readResult.value(), &jsonError);
+    if (jsonError.error != QJsonParseError::NoError)
+    {
+        LogMsg(tr("Failed to parse host name cache from %1. Error: \"%2\"")
+            .arg(path.toString(), jsonError.errorString()), Log::WARNING);
+        return;
+    }
+
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+    const QJsonObject jsonObj = jsonDoc.object();
+    m_cache.reserve(std::min<qsizetype>(jsonObj.size(), MAX_CACHE_SIZE));
+    for (auto iter = jsonObj.constBegin(); (iter != jsonObj.constEnd()) && (m_cache.size() < MAX_CACHE_SIZE); ++iter)
+    {
+        const QHostAddress ip {iter.key()};
+        if (ip.isNull())
+            continue;
+
+        const QJsonObject entryObj = iter.value().toObject();
+        const qint64 expirationTime = entryObj.value(KEY_EXPIRATION_TIME).toInteger();
+        if (expirationTime <= now)
+            continue;
+
+        m_cache.insert(ip, {.hostname = entryObj.value(KEY_HOSTNAME).toString(), .expirationTime = expirationTime});
+    }
+}
+
+void ReverseResolution::storeCache() const
+{
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+
+    QJsonObject jsonObj;
+    for (auto iter = m_cache.cbegin(); iter != m_cache.cend(); ++iter)
+    {
+        if (iter->expirationTime <= now)
+            continue;
+
+        jsonObj[iter.key().toString()] = QJsonObject {
+            {KEY_HOSTNAME, iter->hostname},
+            {KEY_EXPIRATION_TIME, iter->expirationTime}
+        };
+    }
+
+    const Path path = cacheFilePath();
+    const nonstd::expected<void, QString> result = Utils::IO::saveToFile(path, QJsonDocument(jsonObj).toJson(QJsonDocument::Compact));
+    if (!result)
+    {
+        LogMsg(tr("Couldn't store host name cache to %1. Error: %2")
+            .arg(path.toString(), result.error()), Log::WARNING);
+    }
 }
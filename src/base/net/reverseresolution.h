@@ -28,12 +28,15 @@
 
 #pragma once
 
-#include <QCache>
+#include <QHash>
 #include <QHostAddress>
+#include <QList>
 #include <QObject>
+#include <QSet>
+#include <QString>
 
 class QHostInfo;
-class QString;
+class QTimer;
 
 namespace Net
 {
@@ -44,18 +47,33 @@ namespace Net
 
     public:
         explicit ReverseResolution(QObject *parent = nullptr);
-        ~ReverseResolution();
+        ~ReverseResolution() override;
 
         void resolve(const QHostAddress &ip);
 
     signals:
-        void ipResolved(const QHostAddress &ip, const QString &hostname);
+        // Resolved host names are reported in batches, IPs without useful host name are omitted
+        void ipsResolved(const QHash<QHostAddress, QString> &hostnames);
 
-    private slots:
+    private:
+        struct CacheEntry
+        {
+            QString hostname;  // empty for failed lookups
+            qint64 expirationTime = 0;
+        };
+
+        void startLookups();
         void hostResolved(const QHostInfo &host);
+        void cacheHostName(const QHostAddress &ip, const QString &hostname);
+        void notifyResolved(const QHostAddress &ip, const QString &hostname);
+        void loadCache();
+        void storeCache() const;
 
-    private:
         QHash<int, QHostAddress> m_lookups;  // <LookupID, IP>
-        QCache<QHostAddress, QString> m_cache;  // <IP, HostName>
+        QList<QHostAddress> m_lookupQueue;
+        QSet<QHostAddress> m_pendingIPs;  // queued or being looked up
+        QHash<QHostAddress, CacheEntry> m_cache;
+        QHash<QHostAddress, QString> m_resolvedHostnames;  // not reported yet
+        QTimer *m_notifyTimer = nullptr;
     };
 }
@@ -32,11 +32,14 @@
 
 #include "smtp.h"
 
+#include <chrono>
+
 #include <QCryptographicHash>
 #include <QDateTime>
 #include <QDebug>
 #include <QHostInfo>
 #include <QStringList>
+#include <QTimer>
 
 #ifndef QT_NO_OPENSSL
 #include <QSslSocket>
@@ -49,8 +52,14 @@
 #include "base/preferences.h"
 #include "base/utils/string.h"
 
+using namespace std::chrono_literals;
+
 namespace
 {
+    // RFC 5321 suggests servers to wait at least 5 minutes for the next command
+    // so keeping idle connection for a shorter time should be safe
+    const std::chrono::milliseconds IDLE_TIMEOUT = 1min;
+
     const short DEFAULT_PORT = 25;
 #ifndef QT_NO_OPENSSL
     const short DEFAULT_PORT_SSL = 465;
@@ -117,6 +126,10 @@ Smtp::Smtp(QObject *parent)
 #else
     m_socket = new QTcpSocket(this);
 #endif
+    m_idleTimer = new QTimer(this);
+    m_idleTimer->setSingleShot(true);
+    m_idleTimer->setInterval(IDLE_TIMEOUT);
+    connect(m_idleTimer, &QTimer::timeout, this, &Smtp::handleIdleTimeout);
 
     connect(m_socket, &QIODevice::readyRead, this, &Smtp::readyRead);
     connect(m_socket, &QAbstractSocket::disconnected, this, &QObject::deleteLater);
@@ -136,8 +149,7 @@ Smtp::~Smtp()
 
 void Smtp::sendMail(const QString &from, const QString &to, const QString &subject, const QString &body)
 {
-    const Preferences *const pref = Preferences::instance();
-    m_message = "Date: " + getCurrentDateTime().toLatin1() + "\r\n"
+    QByteArray message = "Date: " + getCurrentDateTime().toLatin1() + "\r\n"
                 + encodeMimeHeader(u"From"_s, u"qBittorrent <%1>"_s.arg(from))
                 + encodeMimeHeader(u"Subject"_s, subject)
                 + encodeMimeHeader(u"To"_s, to)
@@ -149,9 +161,22 @@ void Smtp::sendMail(const QString &from, const QString &to, const QString &subje
     QString crlfBody = body;
     const QByteArray b = crlfBody.replace(u"\n"_s, u"\r\n"_s).toUtf8().toBase64();
     for (qsizetype i = 0, end = b.length(); i < end; i += 78)
-        m_message += b.mid(i, 78);
-    m_from = from;
-    m_rcpt = to;
+        message += b.mid(i, 78);
+    m_mails.enqueue({.from = from, .rcpt = to, .message = message});
+
+    if (m_socket->state() != QAbstractSocket::UnconnectedState)
+    {
+        // reuse the established connection, the message is sent
+        // once the previously queued ones are done
+        if (m_state == Idle)
+        {
+            m_idleTimer->stop();
+            sendMailFrom();
+        }
+        return;
+    }
+
+    const Preferences *const pref = Preferences::instance();
     // Authentication
     if (pref->getMailNotificationSMTPAuth())
     {
@@ -178,6 +203,12 @@ void Smtp::sendMail(const QString &from, const QString &to, const QString &subje
 #ifndef QT_NO_OPENSSL
     }
 #endif
+    m_idleTimer->start();
+}
+
+bool Smtp::canSendMail() const
+{
+    return (m_state != Close) && (m_socket->state() != QAbstractSocket::ClosingState);
 }
 
 void Smtp::readyRead()
@@ -185,6 +216,8 @@ void Smtp::readyRead()
     qDebug() << Q_FUNC_INFO;
     // SMTP is line-oriented
     m_buffer += m_socket->readAll();
+    // also limits the time to wait for the server replies
+    m_idleTimer->start();
     while (true)
     {
         const qsizetype pos = m_buffer.indexOf("\r\n");
@@ -245,10 +278,7 @@ void Smtp::readyRead()
         case Authenticated:
             if (code[0] == '2')
             {
-                qDebug() << "Sending <mail from>...";
-                m_socket->write("mail from:<" + m_from.toLatin1() + ">\r\n");
-                m_socket->flush();
-                m_state = Rcpt;
+                sendMailFrom();
             }
             else
             {
@@ -260,7 +290,7 @@ void Smtp::readyRead()
         case Rcpt:
             if (code[0] == '2')
             {
-                m_socket->write("rcpt to:<" + m_rcpt.toLatin1() + ">\r\n");
+                m_socket->write("rcpt to:<" + m_mails.head().rcpt.toLatin1() + ">\r\n");
                 m_socket->flush();
                 m_state = Data;
             }
@@ -286,7 +316,7 @@ void Smtp::readyRead()
         case Body:
             if (code[0] == '3')
             {
-                m_socket->write(m_message + "\r\n.\r\n");
+                m_socket->write(m_mails.head().message + "\r\n.\r\n");
                 m_socket->flush();
                 m_state = Quit;
             }
@@ -299,10 +329,13 @@ void Smtp::readyRead()
         case Quit:
             if (code[0] == '2')
             {
-                m_socket->write("QUIT\r\n");
-                m_socket->flush();
-                // here, we just close.
-                m_state = Close;
+                m_mails.dequeue();
+                emit mailSent();
+                // keep the connection open for the messages which may be queued later
+                if (m_mails.isEmpty())
+                    m_state = Idle;
+                else
+                    sendMailFrom();
             }
             else
             {
@@ -560,6 +593,33 @@ void Smtp::authLogin()
     }
 }
 
+void Smtp::sendMailFrom()
+{
+    qDebug() << "Sending <mail from>...";
+    m_socket->write("mail from:<" + m_mails.head().from.toLatin1() + ">\r\n");
+    m_socket->flush();
+    m_state = Rcpt;
+}
+
+void Smtp::handleIdleTimeout()
+{
+    if (m_state == Idle)
+    {
+        qDebug() << "Closing idle connection";
+        m_socket->write("QUIT\r\n");
+        m_socket->flush();
+        m_state = Close;
+        return;
+    }
+
+    // the server doesn't reply or we gave up after the error
+    if (m_state != Close)
+        logError(tr("Timed out waiting for the server reply"));
+    m_state = Close;
+    m_socket->abort();
+    deleteLater();
+}
+
 void Smtp::logError(const QString &msg)
 {
     qDebug() << "Email Notification Error:" << msg;
@@ -581,4 +641,8 @@ void Smtp::error(QAbstractSocket::SocketError socketError)
     // an email
     if (socketError != QAbstractSocket::RemoteHostClosedError)
         logError(m_socket->errorString());
+
+    // failed to connect so there will be no "disconnected" signal
+    if (m_socket->state() == QAbstractSocket::UnconnectedState)
+        deleteLater();
 }
@@ -36,6 +36,7 @@
 #include <QByteArray>
 #include <QHash>
 #include <QObject>
+#include <QQueue>
 #include <QString>
 
 #ifndef QT_NO_OPENSSL
@@ -43,9 +44,13 @@ class QSslSocket;
 #else
 class QTcpSocket;
 #endif
+class QTimer;
 
 namespace Net
 {
+    // Sends the queued messages over single connection which is kept open
+    // for a while after the last one is sent so that the messages queued later
+    // can reuse it. The object deletes itself once it is disconnected.
     class Smtp : public QObject
     {
         Q_OBJECT
@@ -56,6 +61,11 @@ namespace Net
         ~Smtp();
 
         void sendMail(const QString &from, const QString &to, const QString &subject, const QString &body);
+        // Returns false if the connection is being closed so no more messages can be sent
+        bool canSendMail() const;
+
+    signals:
+        void mailSent();
 
     private slots:
         void readyRead();
@@ -78,6 +88,7 @@ namespace Net
             Init,
             Body,
             Quit,
+            Idle,
             Close
         };
 
@@ -88,6 +99,13 @@ namespace Net
             AuthCramMD5
         };
 
+        struct Mail
+        {
+            QString from;
+            QString rcpt;
+            QByteArray message;
+        };
+
         QByteArray encodeMimeHeader(const QString &key, const QString &value, const QByteArray &prefix = {});
         void ehlo();
         void helo();
@@ -97,17 +115,18 @@ namespace Net
         void authCramMD5(const QByteArray &challenge = {});
         void authPlain();
         void authLogin();
+        void sendMailFrom();
+        void handleIdleTimeout();
         void logError(const QString &msg);
         QString getCurrentDateTime() const;
 
-        QByteArray m_message;
+        QQueue<Mail> m_mails;
 #ifndef QT_NO_OPENSSL
         QSslSocket *m_socket = nullptr;
 #else
         QTcpSocket *m_socket = nullptr;
 #endif
-        QString m_from;
-        QString m_rcpt;
+        QTimer *m_idleTimer = nullptr;
         QString m_response;
         int m_state = Init;
         QHash<QString, QString> m_extensions;
@@ -74,7 +74,10 @@ namespace
 
 Preferences *Preferences::m_instance = nullptr;
 
-Preferences::Preferences() = default;
+Preferences::Preferences()
+{
+    updateSnapshot();
+}
 
 Preferences *Preferences::instance()
 {
@@ -93,6 +96,24 @@ void Preferences::freeInstance()
     m_instance = nullptr;
 }
 
+const PreferencesSnapshot &Preferences::snapshot() const
+{
+    return m_snapshot;
+}
+
+void Preferences::updateSnapshot()
+{
+    m_snapshot = PreferencesSnapshot
+    {
+        .useTorrentStatesColors = useTorrentStatesColors(),
+        .progressBarFollowsTextColor = getProgressBarFollowsTextColor(),
+        .hideZeroValues = getHideZeroValues(),
+        .hideZeroComboValues = getHideZeroComboValues(),
+        .hideZeroStatusFilters = getHideZeroStatusFilters(),
+        .resolvePeerCountries = resolvePeerCountries()
+    };
+}
+
 // General options
 QString Preferences::getLocale() const
 {
@@ -634,6 +655,19 @@ void Preferences::setMailNotificationSMTPPassword(const QString &password)
     setValue(u"Preferences/MailNotification/password"_s, password);
 }
 
+int Preferences::getMailNotificationDigestInterval() const
+{
+    return std::max(value(u"Preferences/MailNotification/DigestInterval"_s, 0), 0);
+}
+
+void Preferences::setMailNotificationDigestInterval(const int minutes)
+{
+    if (minutes == getMailNotificationDigestInterval())
+        return;
+
+    setValue(u"Preferences/MailNotification/DigestInterval"_s, std::max(minutes, 0));
+}
+
 int Preferences::getActionOnDblClOnTorrentDl() const
 {
     return value<int>(u"Preferences/Downloads/DblClOnTorDl"_s, 0);
@@ -1269,6 +1303,45 @@ void Preferences::setAutoRunOnTorrentFinishedProgram(const QString &program)
     setValue(u"AutoRun/program"_s, program);
 }
 
+int Preferences::getAutoRunMaxConcurrentProcesses() const
+{
+    return std::max(value(u"AutoRun/MaxConcurrentProcesses"_s, 0), 0);
+}
+
+void Preferences::setAutoRunMaxConcurrentProcesses(const int count)
+{
+    if (count == getAutoRunMaxConcurrentProcesses())
+        return;
+
+    setValue(u"AutoRun/MaxConcurrentProcesses"_s, std::max(count, 0));
+}
+
+int Preferences::getAutoRunTimeout() const
+{
+    return std::max(value(u"AutoRun/Timeout"_s, 0), 0);
+}
+
+void Preferences::setAutoRunTimeout(const int seconds)
+{
+    if (seconds == getAutoRunTimeout())
+        return;
+
+    setValue(u"AutoRun/Timeout"_s, std::max(seconds, 0));
+}
+
+bool Preferences::isAutoRunBatchingEnabled() const
+{
+    return value(u"AutoRun/BatchingEnabled"_s, false);
+}
+
+void Preferences::setAutoRunBatchingEnabled(const bool enabled)
+{
+    if (enabled == isAutoRunBatchingEnabled())
+        return;
+
+    setValue(u"AutoRun/BatchingEnabled"_s, enabled);
+}
+
 #if defined(Q_OS_WIN)
 bool Preferences::isAutoRunConsoleEnabled() const
 {
@@ -2127,6 +2200,10 @@ void Preferences::setAddNewTorrentDialogAttached(const bool attached)
 
 void Preferences::apply()
 {
+    // the snapshot is replaced as a whole before the listeners are notified
+    // so they never observe partially updated values
+    updateSnapshot();
+
     if (SettingsStorage::instance()->save())
         emit changed();
 }
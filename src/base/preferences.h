@@ -86,6 +86,20 @@ namespace TrayIcon
     Q_ENUM_NS(Style)
 }
 
+// Immutable copy of the preferences read in hot paths (e.g. when painting
+// or updating every item of the lists), so they are read as plain fields
+// instead of being looked up in SettingsStorage and converted from QVariant.
+// It is rebuilt when the preferences are applied.
+struct PreferencesSnapshot
+{
+    bool useTorrentStatesColors = true;
+    bool progressBarFollowsTextColor = false;
+    bool hideZeroValues = false;
+    int hideZeroComboValues = 0;
+    bool hideZeroStatusFilters = false;
+    bool resolvePeerCountries = true;
+};
+
 class Preferences final : public QObject
 {
     Q_OBJECT
@@ -98,6 +112,8 @@ public:
     static void freeInstance();
     static Preferences *instance();
 
+    const PreferencesSnapshot &snapshot() const;
+
     // General options
     QString getLocale() const;
     void setLocale(const QString &locale);
@@ -163,6 +179,8 @@ public:
     void setMailNotificationSMTPUsername(const QString &username);
     QString getMailNotificationSMTPPassword() const;
     void setMailNotificationSMTPPassword(const QString &password);
+    int getMailNotificationDigestInterval() const;
+    void setMailNotificationDigestInterval(int minutes);
     int getActionOnDblClOnTorrentDl() const;
     void setActionOnDblClOnTorrentDl(int act);
     int getActionOnDblClOnTorrentFn() const;
@@ -280,6 +298,12 @@ public:
     void setAutoRunOnTorrentFinishedEnabled(bool enabled);
     QString getAutoRunOnTorrentFinishedProgram() const;
     void setAutoRunOnTorrentFinishedProgram(const QString &program);
+    int getAutoRunMaxConcurrentProcesses() const;
+    void setAutoRunMaxConcurrentProcesses(int count);
+    int getAutoRunTimeout() const;
+    void setAutoRunTimeout(int seconds);
+    bool isAutoRunBatchingEnabled() const;
+    void setAutoRunBatchingEnabled(bool enabled);
 #if defined(Q_OS_WIN)
     bool isAutoRunConsoleEnabled() const;
     void setAutoRunConsoleEnabled(bool enabled);
@@ -456,5 +480,9 @@ signals:
     void changed();
 
 private:
+    void updateSnapshot();
+
     static Preferences *m_instance;
+
+    PreferencesSnapshot m_snapshot;
 };
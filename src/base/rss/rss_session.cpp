@@ -39,10 +39,12 @@
 #include <QJsonValue>
 #include <QString>
 #include <QThread>
+#include <QVariant>
 
 #include "../asyncfilestorage.h"
 #include "../global.h"
 #include "../logger.h"
+#include "../memoryusagetracker.h"
 #include "../profile.h"
 #include "../settingsstorage.h"
 #include "../utils/fs.h"
@@ -100,6 +102,23 @@ Session::Session()
     if (isProcessingEnabled())
         refresh();
 
+    if (auto *memoryUsageTracker = MemoryUsageTracker::instance())
+    {
+        memoryUsageTracker->addEstimator(MemoryComponent::RSS, this, [this]
+        {
+            MemoryUsage usage;
+            for (const Feed *feed : asConst(feeds()))
+            {
+                for (const Article *article : asConst(feed->articles()))
+                {
+                    ++usage.count;
+                    usage.size += sizeof(Article) + estimateMemoryUsage(QVariant(article->data()));
+                }
+            }
+            return usage;
+        });
+    }
+
     // Remove legacy/corrupted settings
     // (at least on Windows, QSettings is case-insensitive and it can get
     // confused when asked about settings that differ only in their case)
@@ -34,16 +34,15 @@
 #include <QtLogging>
 #include <QList>
 #include <QMetaObject>
-#include <QProcess>
 #include <QTimer>
 
 #include "base/global.h"
 #include "base/logger.h"
-#include "base/path.h"
+#include "base/memoryusagetracker.h"
 #include "base/utils/bytearray.h"
-#include "base/utils/foreignapps.h"
-#include "base/utils/fs.h"
 #include "searchpluginmanager.h"
+#include "searchresultstore.h"
+#include "searchworkerpool.h"
 
 using namespace std::chrono_literals;
 
@@ -61,26 +60,6 @@ namespace
         PL_PUB_DATE,
         NB_PLUGIN_COLUMNS
     };
-
-    QString toString(const QProcess::ProcessError error)
-    {
-        switch (error)
-        {
-        case QProcess::FailedToStart:
-            return SearchHandler::tr("Process failed to start");
-        case QProcess::Crashed:
-            return SearchHandler::tr("Process crashed");
-        case QProcess::Timedout:
-            return SearchHandler::tr("Process timed out");
-        case QProcess::WriteError:
-            return SearchHandler::tr("Process write error");
-        case QProcess::ReadError:
-            return SearchHandler::tr("Process read error");
-        case QProcess::UnknownError:
-            return SearchHandler::tr("Process unknown error");
-        }
-        return {};
-    };
 }
 
 SearchHandler::SearchHandler(const QString &pattern, const QString &category, const QStringList &usedPlugins, SearchPluginManager *manager)
@@ -89,115 +68,126 @@ SearchHandler::SearchHandler(const QString &pattern, const QString &category, co
     , m_category {category}
     , m_usedPlugins {usedPlugins}
     , m_manager {manager}
-    , m_searchProcess {new QProcess(this)}
     , m_searchTimeout {new QTimer(this)}
+    , m_resultStore {std::make_unique<SearchResultStore>()}
 {
-    // Load environment variables (proxy)
-    m_searchProcess->setProcessEnvironment(m_manager->proxyEnvironment());
-    m_searchProcess->setProgram(Utils::ForeignApps::pythonInfo().executablePath.data());
-#ifdef Q_OS_UNIX
-    m_searchProcess->setUnixProcessParameters(QProcess::UnixProcessFlag::CloseFileDescriptors);
-#endif
-
-    const QStringList params
-    {
-        Utils::ForeignApps::PYTHON_ISOLATE_MODE_FLAG,
-        (SearchPluginManager::engineLocation() / Path(u"nova2.py"_s)).toString(),
-        m_usedPlugins.join(u','),
-        m_category
-    };
-    m_searchProcess->setArguments(params + m_pattern.split(u' '));
-
-    connect(m_searchProcess, &QProcess::errorOccurred, this, [this](const QProcess::ProcessError error)
-    {
-        if (!m_searchCancelled)
-        {
-            const auto errMsg = toString(error);
-            LogMsg(tr("Search process failed. Search query: \"%1\". Category: \"%2\". Engines: \"%3\". Error: \"%4\".")
-                .arg(m_pattern, m_category, m_usedPlugins.join(u", "), errMsg), Log::WARNING);
-            emit searchFailed(errMsg);
-        }
-    });
-    connect(m_searchProcess, &QProcess::readyReadStandardOutput, this, &SearchHandler::readSearchOutput);
-    connect(m_searchProcess, qOverload<int, QProcess::ExitStatus>(&QProcess::finished)
-            , this, &SearchHandler::processFinished);
-
     m_searchTimeout->setSingleShot(true);
     connect(m_searchTimeout, &QTimer::timeout, this, &SearchHandler::cancelSearch);
     m_searchTimeout->start(3min);
 
+    if (auto *memoryUsageTracker = MemoryUsageTracker::instance())
+    {
+        memoryUsageTracker->addEstimator(MemoryComponent::Search, this, [this]
+        {
+            return MemoryUsage {.size = m_resultStore->memoryUsage(), .count = m_resultStore->size()};
+        });
+    }
+
     // Launch search
     // deferred start allows clients to handle starting-related signals
-    QMetaObject::invokeMethod(this, [this]() { m_searchProcess->start(QIODevice::ReadOnly); }
-        , Qt::QueuedConnection);
+    QMetaObject::invokeMethod(this, &SearchHandler::start, Qt::QueuedConnection);
+}
+
+SearchHandler::~SearchHandler()
+{
+    if (m_worker)
+    {
+        m_worker->cancel();
+        releaseWorker();
+    }
 }
 
 bool SearchHandler::isActive() const
 {
-    return (m_searchProcess->state() != QProcess::NotRunning);
+    return (m_worker != nullptr) || (!m_searchCancelled && m_searchTimeout->isActive());
+}
+
+void SearchHandler::start()
+{
+    if (m_searchCancelled)
+        return;
+
+    m_worker = m_manager->workerPool()->acquireWorker();
+    connect(m_worker, &SearchWorker::resultLinesReceived, this, &SearchHandler::handleResultLines);
+    connect(m_worker, &SearchWorker::searchFinished, this, &SearchHandler::handleSearchFinished);
+    connect(m_worker, &SearchWorker::searchFailed, this, &SearchHandler::handleSearchFailed);
+    m_worker->search(m_pattern, m_category, m_usedPlugins);
 }
 
 void SearchHandler::cancelSearch()
 {
-    if ((m_searchProcess->state() == QProcess::NotRunning) || m_searchCancelled)
+    if (!isActive() || m_searchCancelled)
         return;
 
-#ifdef Q_OS_WIN
-    m_searchProcess->kill();
-#else
-    m_searchProcess->terminate();
-#endif
     m_searchCancelled = true;
     m_searchTimeout->stop();
+
+    if (m_worker)
+    {
+        // killing the worker is the only reliable way to interrupt running plugins,
+        // the pool replaces it with a new one when needed
+        m_worker->cancel();
+        releaseWorker();
+    }
+
+    QMetaObject::invokeMethod(this, [this] { emit searchFinished(true); }, Qt::QueuedConnection);
 }
 
-// Slot called when QProcess is Finished
-// QProcess can be finished for 3 reasons:
-// Error | Stopped by user | Finished normally
-void SearchHandler::processFinished(const int exitcode)
+void SearchHandler::releaseWorker()
+{
+    m_worker->disconnect(this);
+    m_manager->workerPool()->releaseWorker(m_worker);
+    m_worker = nullptr;
+}
+
+void SearchHandler::handleSearchFinished(const bool success, const QString &errorOutput)
 {
     m_searchTimeout->stop();
+    releaseWorker();
 
-    const auto errMsg = QString::fromUtf8(m_searchProcess->readAllStandardError()).trimmed();
-    if (!errMsg.isEmpty())
+    if (!errorOutput.isEmpty())
     {
-        qWarning("%s", qUtf8Printable(errMsg));
+        qWarning("%s", qUtf8Printable(errorOutput));
         LogMsg(tr("Error occurred in search engine. Search query: \"%1\". Category: \"%2\". Engines: \"%3\". Error: \"%4\".")
-            .arg(m_pattern, m_category, m_usedPlugins.join(u", "), errMsg), Log::WARNING);
+            .arg(m_pattern, m_category, m_usedPlugins.join(u", "), errorOutput), Log::WARNING);
     }
 
-    if (m_searchCancelled)
-        emit searchFinished(true);
-    else if ((m_searchProcess->exitStatus() == QProcess::NormalExit) && (exitcode == 0))
+    if (success)
         emit searchFinished(false);
     else
-        emit searchFailed(errMsg);
+        emit searchFailed(errorOutput);
 }
 
-// search QProcess return output as soon as it gets new
-// stuff to read. We split it into lines and parse each
-// line to SearchResult calling parseSearchResult().
-void SearchHandler::readSearchOutput()
+void SearchHandler::handleSearchFailed(const QString &errorMessage)
 {
-    const QByteArray output = m_searchResultLineTruncated + m_searchProcess->readAllStandardOutput();
-    QList<QByteArrayView> lines = Utils::ByteArray::splitToViews(output, "\n", Qt::KeepEmptyParts);
+    m_searchTimeout->stop();
+    releaseWorker();
 
-    m_searchResultLineTruncated = lines.takeLast().trimmed().toByteArray();
+    LogMsg(tr("Search process failed. Search query: \"%1\". Category: \"%2\". Engines: \"%3\". Error: \"%4\".")
+        .arg(m_pattern, m_category, m_usedPlugins.join(u", "), errorMessage), Log::WARNING);
+    emit searchFailed(errorMessage);
+}
 
+// Search worker returns output as soon as it gets new stuff to read.
+// Each line is parsed to SearchResult calling parseSearchResult().
+void SearchHandler::handleResultLines(const QList<QByteArray> &lines)
+{
     QList<SearchResult> searchResultList;
     searchResultList.reserve(lines.size());
 
-    for (const QByteArrayView &line : asConst(lines))
+    for (const QByteArray &line : lines)
     {
         if (SearchResult searchResult; parseSearchResult(line, searchResult))
             searchResultList.append(std::move(searchResult));
     }
 
-    if (!searchResultList.isEmpty())
-    {
-        m_results.append(searchResultList);
-        emit newSearchResults(searchResultList);
-    }
+    if (searchResultList.isEmpty())
+        return;
+
+    // the same torrent can be reported by several engines
+    if (const QList<SearchResult> newResults = m_resultStore->append(searchResultList); !newResults.isEmpty())
+        emit newSearchResults(newResults);
+    emit resultsUpdated();
 }
 
 // Parse one line of search results list
@@ -249,7 +239,12 @@ SearchPluginManager *SearchHandler::manager() const
 
 QList<SearchResult> SearchHandler::results() const
 {
-    return m_results;
+    return m_resultStore->results();
+}
+
+const SearchResultStore &SearchHandler::resultStore() const
+{
+    return *m_resultStore;
 }
 
 QString SearchHandler::pattern() const
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <QByteArray>
 #include <QDateTime>
 #include <QList>
@@ -36,7 +38,6 @@
 #include <QString>
 #include <QtContainerFwd>
 
-class QProcess;
 class QTimer;
 
 struct SearchResult
@@ -53,6 +54,8 @@ struct SearchResult
 };
 
 class SearchPluginManager;
+class SearchResultStore;
+class SearchWorker;
 
 class SearchHandler : public QObject
 {
@@ -65,10 +68,13 @@ class SearchHandler : public QObject
                   , const QStringList &usedPlugins, SearchPluginManager *manager);
 
 public:
+    ~SearchHandler() override;
+
     bool isActive() const;
     QString pattern() const;
     SearchPluginManager *manager() const;
     QList<SearchResult> results() const;
+    const SearchResultStore &resultStore() const;
 
     void cancelSearch();
 
@@ -76,19 +82,23 @@ signals:
     void searchFinished(bool cancelled = false);
     void searchFailed(const QString &errorMessage);
     void newSearchResults(const QList<SearchResult> &results);
+    // Emitted when results are added or swarm stats of known results are updated
+    void resultsUpdated();
 
 private:
-    void readSearchOutput();
-    void processFinished(int exitcode);
+    void start();
+    void handleResultLines(const QList<QByteArray> &lines);
+    void handleSearchFinished(bool success, const QString &errorOutput);
+    void handleSearchFailed(const QString &errorMessage);
+    void releaseWorker();
     bool parseSearchResult(QByteArrayView line, SearchResult &searchResult);
 
     const QString m_pattern;
     const QString m_category;
     const QStringList m_usedPlugins;
     SearchPluginManager *m_manager = nullptr;
-    QProcess *m_searchProcess = nullptr;
+    SearchWorker *m_worker = nullptr;
     QTimer *m_searchTimeout = nullptr;
-    QByteArray m_searchResultLineTruncated;
     bool m_searchCancelled = false;
-    QList<SearchResult> m_results;
+    std::unique_ptr<SearchResultStore> m_resultStore;
 };
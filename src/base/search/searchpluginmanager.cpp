@@ -53,6 +53,7 @@
 #include "base/utils/fs.h"
 #include "searchdownloadhandler.h"
 #include "searchhandler.h"
+#include "searchworkerpool.h"
 
 namespace
 {
@@ -90,6 +91,7 @@ QPointer<SearchPluginManager> SearchPluginManager::m_instance = nullptr;
 SearchPluginManager::SearchPluginManager()
     : m_updateUrl(u"https://raw.githubusercontent.com/qbittorrent/search-plugins/refs/heads/master/nova3/engines/"_s)
     , m_proxyEnv {QProcessEnvironment::systemEnvironment()}
+    , m_workerPool {new SearchWorkerPool(this)}
 {
     Q_ASSERT(!m_instance); // only one instance is allowed
     m_instance = this;
@@ -98,7 +100,13 @@ SearchPluginManager::SearchPluginManager()
             , this, &SearchPluginManager::applyProxySettings);
     connect(Preferences::instance(), &Preferences::changed
             , this, &SearchPluginManager::applyProxySettings);
-    applyProxySettings();
+    updateProxyEnvironment();
+    resetWorkers();
+
+    // running workers have already imported the old plugin modules
+    connect(this, &SearchPluginManager::pluginInstalled, this, &SearchPluginManager::resetWorkers);
+    connect(this, &SearchPluginManager::pluginUpdated, this, &SearchPluginManager::resetWorkers);
+    connect(this, &SearchPluginManager::pluginUninstalled, this, &SearchPluginManager::resetWorkers);
 
     updateNova();
     update();
@@ -369,6 +377,16 @@ QProcessEnvironment SearchPluginManager::proxyEnvironment() const
     return m_proxyEnv;
 }
 
+SearchWorkerPool *SearchPluginManager::workerPool() const
+{
+    return m_workerPool;
+}
+
+QHash<QString, SearchEngineStats> SearchPluginManager::engineStats() const
+{
+    return m_workerPool->engineStats();
+}
+
 QString SearchPluginManager::categoryFullName(const QString &categoryName)
 {
     const QHash<QString, QString> categoryTable
@@ -409,6 +427,19 @@ Path SearchPluginManager::engineLocation()
 }
 
 void SearchPluginManager::applyProxySettings()
+{
+    const QProcessEnvironment oldProxyEnv = m_proxyEnv;
+    updateProxyEnvironment();
+    if (m_proxyEnv != oldProxyEnv)
+        resetWorkers();
+}
+
+void SearchPluginManager::resetWorkers()
+{
+    m_workerPool->reset(m_proxyEnv);
+}
+
+void SearchPluginManager::updateProxyEnvironment()
 {
     // for python `urllib`: https://docs.python.org/3/library/urllib.request.html#urllib.request.ProxyHandler
     const QString HTTP_PROXY = u"http_proxy"_s;
@@ -58,6 +58,8 @@ struct PluginInfo
 
 class SearchDownloadHandler;
 class SearchHandler;
+class SearchWorkerPool;
+struct SearchEngineStats;
 
 class SearchPluginManager final : public QObject
 {
@@ -89,6 +91,8 @@ public:
     SearchDownloadHandler *downloadTorrent(const QString &pluginName, const QString &url);
 
     QProcessEnvironment proxyEnvironment() const;
+    SearchWorkerPool *workerPool() const;
+    QHash<QString, SearchEngineStats> engineStats() const;
 
     static PluginVersion getPluginVersion(const Path &filePath);
     static QString categoryFullName(const QString &categoryName);
@@ -109,6 +113,8 @@ signals:
 
 private:
     void applyProxySettings();
+    void updateProxyEnvironment();
+    void resetWorkers();
     void update();
     void updateNova();
     void parseVersionInfo(const QByteArray &info);
@@ -126,4 +132,5 @@ private:
 
     QHash<QString, PluginInfo*> m_plugins;
     QProcessEnvironment m_proxyEnv;
+    SearchWorkerPool *m_workerPool = nullptr;
 };
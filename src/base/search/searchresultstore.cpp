@@ -0,0 +1,250 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "searchresultstore.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "base/bittorrent/infohash.h"
+#include "base/bittorrent/torrentdescriptor.h"
+#include "base/global.h"
+#include "base/memoryusagetracker.h"
+
+namespace
+{
+    QString torrentIDFromMagnetURI(const QString &url)
+    {
+        if (!url.startsWith(u"magnet:", Qt::CaseInsensitive))
+            return {};
+
+        // Info hash can be encoded either in hex or in base32 so compare the parsed one
+        const auto parseResult = BitTorrent::TorrentDescriptor::parse(url);
+        if (!parseResult)
+            return {};
+
+        const BitTorrent::TorrentID torrentID = parseResult.value().infoHash().toTorrentID();
+        return torrentID.isValid() ? torrentID.toString() : QString();
+    }
+
+    bool matches(const SearchResult &result, const SearchResultStore::Query &query)
+    {
+        if (query.minSize && (result.fileSize < *query.minSize))
+            return false;
+        if (query.maxSize && (result.fileSize > *query.maxSize))
+            return false;
+        if (query.minSeeders && (result.nbSeeders < *query.minSeeders))
+            return false;
+        if (query.maxSeeders && (result.nbSeeders > *query.maxSeeders))
+            return false;
+        for (const QString &term : query.nameTerms)
+        {
+            if (!result.fileName.contains(term, Qt::CaseInsensitive))
+                return false;
+        }
+        if (!query.namePattern.pattern().isEmpty() && !query.namePattern.match(result.fileName).hasMatch())
+            return false;
+
+        return true;
+    }
+}
+
+QString SearchResultStore::resultKey(const SearchResult &result)
+{
+    if (const QString torrentID = torrentIDFromMagnetURI(result.fileUrl); !torrentID.isEmpty())
+        return torrentID;
+
+    return result.fileUrl;
+}
+
+QList<SearchResult> SearchResultStore::append(const QList<SearchResult> &results)
+{
+    QList<SearchResult> newResults;
+    newResults.reserve(results.size());
+
+    const qsizetype firstNewIndex = m_results.size();
+    bool isSeedersOrderChanged = false;
+    bool isLeechersOrderChanged = false;
+    for (const SearchResult &result : results)
+    {
+        const QString key = resultKey(result);
+        if (const auto iter = m_resultIndexesByKey.constFind(key); iter != m_resultIndexesByKey.cend())
+        {
+            // Prefer the most optimistic swarm stats reported by different engines
+            // since they are usually collected at different time
+            // (results added by this call aren't in sort indexes yet)
+            const bool isIndexed = (iter.value() < firstNewIndex);
+            SearchResult &knownResult = m_results[iter.value()];
+            if (result.nbSeeders > knownResult.nbSeeders)
+            {
+                knownResult.nbSeeders = result.nbSeeders;
+                isSeedersOrderChanged |= isIndexed;
+            }
+            if (result.nbLeechers > knownResult.nbLeechers)
+            {
+                knownResult.nbLeechers = result.nbLeechers;
+                isLeechersOrderChanged |= isIndexed;
+            }
+            continue;
+        }
+
+        m_resultIndexesByKey.insert(key, m_results.size());
+        m_results.append(result);
+        newResults.append(result);
+    }
+
+    // Updated swarm stats of known results break existing sort indexes
+    if (isSeedersOrderChanged)
+        m_sortIndexes.erase(SortColumn::Seeders);
+    if (isLeechersOrderChanged)
+        m_sortIndexes.erase(SortColumn::Leechers);
+
+    for (auto &[column, index] : m_sortIndexes)
+    {
+        const auto middle = static_cast<std::ptrdiff_t>(index.size());
+        index.resize(static_cast<std::size_t>(m_results.size()));
+        std::iota((index.begin() + middle), index.end(), firstNewIndex);
+
+        const auto compare = [this, column = column](const qsizetype left, const qsizetype right) { return lessThan(column, left, right); };
+        std::stable_sort((index.begin() + middle), index.end(), compare);
+        std::inplace_merge(index.begin(), (index.begin() + middle), index.end(), compare);
+    }
+
+    return newResults;
+}
+
+const QList<SearchResult> &SearchResultStore::results() const
+{
+    return m_results;
+}
+
+qsizetype SearchResultStore::size() const
+{
+    return m_results.size();
+}
+
+qint64 SearchResultStore::memoryUsage() const
+{
+    qint64 size = 0;
+    for (const SearchResult &result : m_results)
+    {
+        size += sizeof(SearchResult) + estimateMemoryUsage(result.fileName) + estimateMemoryUsage(result.fileUrl)
+                + estimateMemoryUsage(result.engineName) + estimateMemoryUsage(result.siteUrl)
+                + estimateMemoryUsage(result.descrLink);
+    }
+
+    for (auto it = m_resultIndexesByKey.cbegin(); it != m_resultIndexesByKey.cend(); ++it)
+        size += sizeof(QString) + sizeof(qsizetype) + estimateMemoryUsage(it.key());
+
+    for (const auto &[column, index] : m_sortIndexes)
+        size += index.capacity() * sizeof(qsizetype);
+
+    return size;
+}
+
+SearchResultStore::QueryResult SearchResultStore::query(const Query &query) const
+{
+    QueryResult queryResult;
+    const qsizetype offset = std::max<qsizetype>(0, query.offset);
+    const qsizetype limit = (query.limit >= 0) ? query.limit : m_results.size();
+
+    const auto process = [&queryResult, &query, offset, limit](const SearchResult &result)
+    {
+        if (!matches(result, query))
+            return;
+
+        const qsizetype position = queryResult.matchedCount++;
+        if ((position >= offset) && ((position - offset) < limit))
+            queryResult.results.append(result);
+    };
+
+    if (query.sortColumn == SortColumn::None)
+    {
+        for (const SearchResult &result : m_results)
+            process(result);
+    }
+    else
+    {
+        const std::vector<qsizetype> &index = sortIndex(query.sortColumn);
+        if (query.sortDescending)
+        {
+            for (auto iter = index.crbegin(); iter != index.crend(); ++iter)
+                process(m_results[*iter]);
+        }
+        else
+        {
+            for (const qsizetype resultIndex : index)
+                process(m_results[resultIndex]);
+        }
+    }
+
+    return queryResult;
+}
+
+const std::vector<qsizetype> &SearchResultStore::sortIndex(const SortColumn column) const
+{
+    auto iter = m_sortIndexes.find(column);
+    if (iter == m_sortIndexes.end())
+    {
+        std::vector<qsizetype> index(static_cast<std::size_t>(m_results.size()));
+        std::iota(index.begin(), index.end(), 0);
+        std::stable_sort(index.begin(), index.end()
+                , [this, column](const qsizetype left, const qsizetype right) { return lessThan(column, left, right); });
+        iter = m_sortIndexes.emplace(column, std::move(index)).first;
+    }
+
+    return iter->second;
+}
+
+bool SearchResultStore::lessThan(const SortColumn column, const qsizetype left, const qsizetype right) const
+{
+    const SearchResult &leftResult = m_results[left];
+    const SearchResult &rightResult = m_results[right];
+
+    switch (column)
+    {
+    case SortColumn::Name:
+        return m_naturalLessThan(leftResult.fileName, rightResult.fileName);
+    case SortColumn::Size:
+        return (leftResult.fileSize < rightResult.fileSize);
+    case SortColumn::Seeders:
+        return (leftResult.nbSeeders < rightResult.nbSeeders);
+    case SortColumn::Leechers:
+        return (leftResult.nbLeechers < rightResult.nbLeechers);
+    case SortColumn::EngineName:
+        return m_naturalLessThan(leftResult.engineName, rightResult.engineName);
+    case SortColumn::SiteURL:
+        return m_naturalLessThan(leftResult.siteUrl, rightResult.siteUrl);
+    case SortColumn::PubDate:
+        return (leftResult.pubDate < rightResult.pubDate);
+    case SortColumn::None:
+        break;
+    }
+
+    return (left < right);
+}
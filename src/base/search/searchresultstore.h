@@ -0,0 +1,105 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <QHash>
+#include <QList>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+
+#include "base/utils/compare.h"
+#include "searchhandler.h"
+
+// Keeps the results of a single search.
+// Results are deduplicated by info hash (or by download URL if it isn't available)
+// and can be queried by pages with server-side sorting and filtering.
+class SearchResultStore
+{
+public:
+    enum class SortColumn
+    {
+        None,
+        Name,
+        Size,
+        Seeders,
+        Leechers,
+        EngineName,
+        SiteURL,
+        PubDate
+    };
+
+    struct Query
+    {
+        SortColumn sortColumn = SortColumn::None;
+        bool sortDescending = false;
+        // Result name must contain all the terms
+        QStringList nameTerms;
+        // Result name must match the pattern unless it is empty
+        QRegularExpression namePattern;
+        std::optional<qlonglong> minSize;
+        std::optional<qlonglong> maxSize;
+        std::optional<qlonglong> minSeeders;
+        std::optional<qlonglong> maxSeeders;
+        qsizetype offset = 0;
+        qsizetype limit = -1;
+    };
+
+    struct QueryResult
+    {
+        QList<SearchResult> results;
+        qsizetype matchedCount = 0;
+    };
+
+    // Returns results that weren't known before
+    QList<SearchResult> append(const QList<SearchResult> &results);
+
+    const QList<SearchResult> &results() const;
+    qsizetype size() const;
+    // Approximate amount of memory held by the results and their indexes
+    qint64 memoryUsage() const;
+
+    QueryResult query(const Query &query) const;
+
+    static QString resultKey(const SearchResult &result);
+
+private:
+    const std::vector<qsizetype> &sortIndex(SortColumn column) const;
+    bool lessThan(SortColumn column, qsizetype left, qsizetype right) const;
+
+    QList<SearchResult> m_results;
+    QHash<QString, qsizetype> m_resultIndexesByKey;
+    // Sort indexes are built on first use and then kept up to date incrementally
+    mutable std::map<SortColumn, std::vector<qsizetype>> m_sortIndexes;
+    Utils::Compare::NaturalLessThan<Qt::CaseInsensitive> m_naturalLessThan;
+};
@@ -0,0 +1,243 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "searchworkerpool.h"
+
+#include <QProcess>
+
+#include "base/global.h"
+#include "base/logger.h"
+#include "base/path.h"
+#include "base/utils/bytearray.h"
+#include "base/utils/foreignapps.h"
+#include "searchpluginmanager.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Max number of idle workers kept for reuse. Busy workers aren't limited.
+    const qsizetype MAX_IDLE_WORKERS = 3;
+
+    const QByteArray CONTROL_LINE_PREFIX = QByteArrayLiteral("@@\t");
+
+    QString sanitizeRequestField(QString field)
+    {
+        // request fields are separated by tab and request is terminated by newline
+        return field.replace(u'\t', u' ').replace(u'\n', u' ').replace(u'\r', u' ');
+    }
+}
+
+SearchWorker::SearchWorker(const QProcessEnvironment &environment, const int generation, QObject *parent)
+    : QObject(parent)
+    , m_process {new QProcess(this)}
+    , m_generation {generation}
+{
+    m_process->setProcessEnvironment(environment);
+    m_process->setProgram(Utils::ForeignApps::pythonInfo().executablePath.data());
+#ifdef Q_OS_UNIX
+    m_process->setUnixProcessParameters(QProcess::UnixProcessFlag::CloseFileDescriptors);
+#endif
+    m_process->setArguments({Utils::ForeignApps::PYTHON_ISOLATE_MODE_FLAG
+            , (SearchPluginManager::engineLocation() / Path(u"nova2.py"_s)).toString(), u"--serve"_s});
+
+    connect(m_process, &QProcess::readyReadStandardOutput, this, &SearchWorker::readOutput);
+    connect(m_process, &QProcess::readyReadStandardError, this, &SearchWorker::readErrorOutput);
+    connect(m_process, qOverload<int, QProcess::ExitStatus>(&QProcess::finished), this, &SearchWorker::handleProcessFinished);
+    connect(m_process, &QProcess::errorOccurred, this, [this](const QProcess::ProcessError error)
+    {
+        if ((error == QProcess::FailedToStart) && m_isBusy)
+        {
+            m_isBusy = false;
+            emit searchFailed(tr("Search process failed to start"));
+        }
+    });
+
+    m_process->start(QIODevice::ReadWrite);
+}
+
+int SearchWorker::generation() const
+{
+    return m_generation;
+}
+
+bool SearchWorker::isBusy() const
+{
+    return m_isBusy;
+}
+
+bool SearchWorker::isRunning() const
+{
+    return !m_isCancelled && (m_process->state() != QProcess::NotRunning);
+}
+
+void SearchWorker::search(const QString &pattern, const QString &category, const QStringList &usedPlugins)
+{
+    Q_ASSERT(!m_isBusy);
+
+    m_isBusy = true;
+    m_errorOutput.clear();
+
+    const QString request = u"search\t" + sanitizeRequestField(usedPlugins.join(u','))
+            + u'\t' + sanitizeRequestField(category) + u'\t' + sanitizeRequestField(pattern) + u'\n';
+    m_process->write(request.toUtf8());
+}
+
+void SearchWorker::cancel()
+{
+    if (m_isCancelled)
+        return;
+
+    m_isCancelled = true;
+    m_isBusy = false;
+    m_process->kill();
+}
+
+void SearchWorker::readOutput()
+{
+    const QByteArray output = m_truncatedLine + m_process->readAllStandardOutput();
+    QList<QByteArrayView> lines = Utils::ByteArray::splitToViews(output, "\n", Qt::KeepEmptyParts);
+
+    m_truncatedLine = lines.takeLast().trimmed().toByteArray();
+
+    QList<QByteArray> resultLines;
+    resultLines.reserve(lines.size());
+    for (const QByteArrayView line : asConst(lines))
+    {
+        if (line.startsWith(CONTROL_LINE_PREFIX))
+        {
+            if (!resultLines.isEmpty())
+            {
+                emit resultLinesReceived(resultLines);
+                resultLines.clear();
+            }
+
+            handleControlLine(line.sliced(CONTROL_LINE_PREFIX.size()).trimmed());
+        }
+        else
+        {
+            resultLines.append(line.toByteArray());
+        }
+    }
+
+    if (!resultLines.isEmpty())
+        emit resultLinesReceived(resultLines);
+}
+
+void SearchWorker::readErrorOutput()
+{
+    m_errorOutput += QString::fromUtf8(m_process->readAllStandardError());
+}
+
+void SearchWorker::handleControlLine(const QByteArrayView line)
+{
+    const QList<QByteArrayView> fields = Utils::ByteArray::splitToViews(line, "\t");
+    if (fields.isEmpty())
+        return;
+
+    if ((fields[0] == "engine") && (fields.size() == 4))
+    {
+        const std::chrono::milliseconds elapsed {fields[3].toLongLong()};
+        emit engineFinished(QString::fromUtf8(fields[1]), (fields[2] == "1"), elapsed);
+    }
+    else if ((fields[0] == "done") && (fields.size() == 2))
+    {
+        readErrorOutput();
+        m_isBusy = false;
+        emit searchFinished((fields[1] == "1"), m_errorOutput.trimmed());
+    }
+}
+
+void SearchWorker::handleProcessFinished()
+{
+    if (m_isCancelled || !m_isBusy)
+        return;
+
+    m_isBusy = false;
+    readErrorOutput();
+    emit searchFailed(m_errorOutput.trimmed().isEmpty() ? tr("Search process exited unexpectedly") : m_errorOutput.trimmed());
+}
+
+SearchWorker *SearchWorkerPool::acquireWorker()
+{
+    while (!m_idleWorkers.isEmpty())
+    {
+        SearchWorker *worker = m_idleWorkers.takeLast();
+        if (worker->isRunning())
+            return worker;
+
+        worker->deleteLater();
+    }
+
+    auto *worker = new SearchWorker(m_environment, m_generation, this);
+    connect(worker, &SearchWorker::engineFinished, this, &SearchWorkerPool::handleEngineFinished);
+    return worker;
+}
+
+void SearchWorkerPool::releaseWorker(SearchWorker *worker)
+{
+    Q_ASSERT(worker);
+
+    if (worker->isBusy() || !worker->isRunning() || (worker->generation() != m_generation)
+            || (m_idleWorkers.size() >= MAX_IDLE_WORKERS))
+    {
+        worker->cancel();
+        worker->deleteLater();
+        return;
+    }
+
+    m_idleWorkers.append(worker);
+}
+
+void SearchWorkerPool::reset(const QProcessEnvironment &environment)
+{
+    m_environment = environment;
+    ++m_generation;
+
+    for (SearchWorker *worker : asConst(m_idleWorkers))
+    {
+        worker->cancel();
+        worker->deleteLater();
+    }
+    m_idleWorkers.clear();
+}
+
+QHash<QString, SearchEngineStats> SearchWorkerPool::engineStats() const
+{
+    return m_engineStats;
+}
+
+void SearchWorkerPool::handleEngineFinished(const QString &engineName, const bool success, const std::chrono::milliseconds elapsed)
+{
+    SearchEngineStats &stats = m_engineStats[engineName];
+    ++stats.searchCount;
+    if (!success)
+        ++stats.failureCount;
+    stats.totalElapsed += elapsed;
+    stats.lastElapsed = elapsed;
+}
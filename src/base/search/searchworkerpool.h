@@ -0,0 +1,111 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QProcessEnvironment>
+#include <QString>
+
+class QProcess;
+
+struct SearchEngineStats
+{
+    int searchCount = 0;
+    int failureCount = 0;
+    std::chrono::milliseconds totalElapsed {};
+    std::chrono::milliseconds lastElapsed {};
+};
+
+// Long-lived nova2 process serving search requests one by one
+class SearchWorker final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(SearchWorker)
+
+public:
+    SearchWorker(const QProcessEnvironment &environment, int generation, QObject *parent = nullptr);
+
+    int generation() const;
+    bool isBusy() const;
+    bool isRunning() const;
+
+    void search(const QString &pattern, const QString &category, const QStringList &usedPlugins);
+    // Kills the process. The worker cannot be used after that.
+    void cancel();
+
+signals:
+    void resultLinesReceived(const QList<QByteArray> &lines);
+    void engineFinished(const QString &engineName, bool success, std::chrono::milliseconds elapsed);
+    void searchFinished(bool success, const QString &errorOutput);
+    void searchFailed(const QString &errorMessage);
+
+private:
+    void readOutput();
+    void readErrorOutput();
+    void handleControlLine(QByteArrayView line);
+    void handleProcessFinished();
+
+    QProcess *m_process = nullptr;
+    const int m_generation = 0;
+    QByteArray m_truncatedLine;
+    QString m_errorOutput;
+    bool m_isBusy = false;
+    bool m_isCancelled = false;
+};
+
+class SearchWorkerPool final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(SearchWorkerPool)
+
+public:
+    using QObject::QObject;
+
+    // Returns idle worker or starts a new one
+    SearchWorker *acquireWorker();
+    void releaseWorker(SearchWorker *worker);
+    // Workers started before reset are discarded once they aren't used anymore.
+    // It is required when search plugins or process environment are changed.
+    void reset(const QProcessEnvironment &environment);
+
+    QHash<QString, SearchEngineStats> engineStats() const;
+
+private:
+    void handleEngineFinished(const QString &engineName, bool success, std::chrono::milliseconds elapsed);
+
+    QProcessEnvironment m_environment;
+    int m_generation = 0;
+    QList<SearchWorker *> m_idleWorkers;
+    QHash<QString, SearchEngineStats> m_engineStats;
+};
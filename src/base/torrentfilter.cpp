@@ -160,6 +160,31 @@ bool TorrentFilter::setPrivate(const std::optional<bool> isPrivate)
     return false;
 }
 
+TorrentFilter::Type TorrentFilter::type() const
+{
+    return m_type;
+}
+
+const std::optional<TorrentIDSet> &TorrentFilter::torrentIDSet() const
+{
+    return m_idSet;
+}
+
+const std::optional<QString> &TorrentFilter::category() const
+{
+    return m_category;
+}
+
+const std::optional<Tag> &TorrentFilter::tag() const
+{
+    return m_tag;
+}
+
+std::optional<bool> TorrentFilter::isPrivate() const
+{
+    return m_private;
+}
+
 bool TorrentFilter::match(const Torrent *const torrent) const
 {
     if (!torrent) return false;
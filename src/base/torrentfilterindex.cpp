@@ -0,0 +1,388 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "torrentfilterindex.h"
+
+#include <algorithm>
+
+#include "base/bittorrent/session.h"
+#include "base/bittorrent/torrent.h"
+#include "base/global.h"
+
+namespace
+{
+    const qsizetype MIN_SLOTS_CAPACITY = 64;
+
+    QList<int> collectSlots(const QBitArray &bitmap)
+    {
+        QList<int> slots;
+        slots.reserve(bitmap.count(true));
+
+        // skip empty words of the bitmap instead of testing each bit
+        const auto *bits = reinterpret_cast<const uchar *>(bitmap.bits());
+        const qsizetype bytesCount = (bitmap.size() + 7) / 8;
+        for (qsizetype byteIndex = 0; byteIndex < bytesCount; ++byteIndex)
+        {
+            if (bits[byteIndex] == 0)
+                continue;
+
+            for (int bitIndex = 0; bitIndex < 8; ++bitIndex)
+            {
+                if (const qsizetype slot = (byteIndex * 8) + bitIndex; (slot < bitmap.size()) && bitmap.testBit(slot))
+                    slots.append(static_cast<int>(slot));
+            }
+        }
+
+        return slots;
+    }
+}
+
+TorrentFilterIndex::TorrentFilterIndex(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void TorrentFilterIndex::watch(const BitTorrent::Session *session)
+{
+    using BitTorrent::Session;
+    using BitTorrent::Torrent;
+
+    m_session = session;
+    m_isSubcategoriesEnabled = session->isSubcategoriesEnabled();
+
+    const auto updateTorrentStates = [this](const Torrent *torrent)
+    {
+        setTorrentStates(torrent->slotIndex(), torrentStates(torrent));
+    };
+
+    connect(session, &Session::torrentsLoaded, this, &TorrentFilterIndex::handleTorrentsLoaded);
+    connect(session, &Session::torrentsUpdated, this, &TorrentFilterIndex::handleTorrentsUpdated);
+    connect(session, &Session::torrentAboutToBeRemoved, this, [this](const Torrent *torrent)
+    {
+        removeTorrent(torrent->slotIndex());
+    });
+    connect(session, &Session::torrentStarted, this, updateTorrentStates);
+    connect(session, &Session::torrentStopped, this, updateTorrentStates);
+    connect(session, &Session::torrentFinished, this, updateTorrentStates);
+    connect(session, &Session::torrentCategoryChanged, this, [this](const Torrent *torrent)
+    {
+        setTorrentCategory(torrent->slotIndex(), torrent->category());
+    });
+    connect(session, &Session::torrentTagAdded, this, [this](const Torrent *torrent, const Tag &tag)
+    {
+        addTorrentTag(torrent->slotIndex(), tag);
+    });
+    connect(session, &Session::torrentTagRemoved, this, [this](const Torrent *torrent, const Tag &tag)
+    {
+        removeTorrentTag(torrent->slotIndex(), tag);
+    });
+    connect(session, &Session::torrentMetadataReceived, this, [this](const Torrent *torrent)
+    {
+        setTorrentPrivate(torrent->slotIndex(), torrent->isPrivate());
+    });
+    connect(session, &Session::subcategoriesSupportChanged, this, [this, session]
+    {
+        setSubcategoriesEnabled(session->isSubcategoriesEnabled());
+    });
+}
+
+TorrentFilterIndex::States TorrentFilterIndex::torrentStates(const BitTorrent::Torrent *torrent)
+{
+    States states;
+    for (int type = (TorrentFilter::All + 1); type < TorrentFilter::_Count; ++type)
+        states.set(type, TorrentFilter(static_cast<TorrentFilter::Type>(type)).match(torrent));
+
+    return states;
+}
+
+QList<BitTorrent::Torrent *> TorrentFilterIndex::torrents(const TorrentFilter &filter) const
+{
+    Q_ASSERT(m_session);
+    if (!m_session) [[unlikely]]
+        return {};
+
+    const QList<int> slots = torrentSlots(filter);
+
+    QList<BitTorrent::Torrent *> torrents;
+    torrents.reserve(slots.size());
+    for (const int slot : slots)
+        torrents.append(m_session->torrentAt(slot));
+
+    return torrents;
+}
+
+QList<int> TorrentFilterIndex::torrentSlots(const TorrentFilter &filter) const
+{
+    QBitArray result = m_stateBitmaps[filter.type()];
+
+    if (const std::optional<QString> &category = filter.category())
+        result &= categoryBitmap(*category);
+
+    if (const std::optional<Tag> &tag = filter.tag())
+    {
+        // Empty tag is a special value to indicate we're filtering for untagged torrents.
+        if (tag->isEmpty())
+            result &= m_untaggedBitmap;
+        else
+            result &= m_tagBitmaps.value(tag->toString(), QBitArray(result.size()));
+    }
+
+    if (const std::optional<bool> isPrivate = filter.isPrivate())
+        result &= (*isPrivate ? m_privateBitmap : ~m_privateBitmap);
+
+    if (const std::optional<TorrentIDSet> &idSet = filter.torrentIDSet())
+    {
+        // keep only the requested torrents so that the result is still listed in slot order
+        QBitArray requested {result.size()};
+        for (const BitTorrent::TorrentID &id : asConst(*idSet))
+        {
+            if (const int slot = m_slotsByID.value(id, -1); slot >= 0)
+                requested.setBit(slot);
+        }
+        result &= requested;
+    }
+
+    return collectSlots(result);
+}
+
+qsizetype TorrentFilterIndex::torrentsCount(const TorrentFilter::Type type) const
+{
+    return m_stateBitmaps[type].count(true);
+}
+
+void TorrentFilterIndex::addTorrent(const int slot, const BitTorrent::TorrentID &id, const QString &category
+        , const TagSet &tags, const bool isPrivate, const States states)
+{
+    if (insertTorrent(slot, id, category, tags, isPrivate, states))
+        emit statesUpdated();
+}
+
+void TorrentFilterIndex::removeTorrent(const int slot)
+{
+    if (!isIndexed(slot))
+        return;
+
+    for (QBitArray &stateBitmap : m_stateBitmaps)
+        stateBitmap.clearBit(slot);
+    for (QBitArray &categoryBitmap : m_categoryBitmaps)
+        categoryBitmap.clearBit(slot);
+    for (QBitArray &tagBitmap : m_tagBitmaps)
+        tagBitmap.clearBit(slot);
+    m_untaggedBitmap.clearBit(slot);
+    m_privateBitmap.clearBit(slot);
+    m_slotsByID.remove(m_idsBySlot[slot]);
+
+    emit statesUpdated();
+}
+
+void TorrentFilterIndex::setTorrentStates(const int slot, const States states)
+{
+    if (updateStates(slot, states))
+        emit statesUpdated();
+}
+
+void TorrentFilterIndex::setTorrentCategory(const int slot, const QString &category)
+{
+    if (!isIndexed(slot))
+        return;
+
+    for (auto iter = m_categoryBitmaps.begin(); iter != m_categoryBitmaps.end();)
+    {
+        if ((iter.key() == category) || !iter->testBit(slot))
+        {
+            ++iter;
+            continue;
+        }
+
+        iter->clearBit(slot);
+        if ((iter->count(true) == 0) && !iter.key().isEmpty())
+            iter = m_categoryBitmaps.erase(iter);
+        else
+            ++iter;
+    }
+
+    bitmap(m_categoryBitmaps, category).setBit(slot);
+}
+
+void TorrentFilterIndex::addTorrentTag(const int slot, const Tag &tag)
+{
+    if (!isIndexed(slot))
+        return;
+
+    bitmap(m_tagBitmaps, tag.toString()).setBit(slot);
+    m_untaggedBitmap.clearBit(slot);
+}
+
+void TorrentFilterIndex::removeTorrentTag(const int slot, const Tag &tag)
+{
+    if (!isIndexed(slot))
+        return;
+
+    if (const auto iter = m_tagBitmaps.find(tag.toString()); iter != m_tagBitmaps.end())
+    {
+        iter->clearBit(slot);
+        if (iter->count(true) == 0)
+            m_tagBitmaps.erase(iter);
+    }
+
+    const bool isTagged = std::ranges::any_of(asConst(m_tagBitmaps), [slot](const QBitArray &tagBitmap) { return tagBitmap.testBit(slot); });
+    if (!isTagged)
+        m_untaggedBitmap.setBit(slot);
+}
+
+void TorrentFilterIndex::setTorrentPrivate(const int slot, const bool isPrivate)
+{
+    if (isIndexed(slot))
+        m_privateBitmap.setBit(slot, isPrivate);
+}
+
+void TorrentFilterIndex::setSubcategoriesEnabled(const bool enabled)
+{
+    m_isSubcategoriesEnabled = enabled;
+}
+
+void TorrentFilterIndex::handleTorrentsLoaded(const QList<BitTorrent::Torrent *> &torrents)
+{
+    reserveSlots(m_session->torrentSlotsCount());
+
+    bool isUpdated = false;
+    for (const BitTorrent::Torrent *torrent : torrents)
+    {
+        isUpdated |= insertTorrent(torrent->slotIndex(), torrent->id(), torrent->category()
+                , torrent->tags(), torrent->isPrivate(), torrentStates(torrent));
+    }
+
+    if (isUpdated)
+        emit statesUpdated();
+}
+
+void TorrentFilterIndex::handleTorrentsUpdated(const QList<BitTorrent::Torrent *> &torrents)
+{
+    bool isUpdated = false;
+    for (const BitTorrent::Torrent *torrent : torrents)
+        isUpdated |= updateStates(torrent->slotIndex(), torrentStates(torrent));
+
+    if (isUpdated)
+        emit statesUpdated();
+}
+
+bool TorrentFilterIndex::isIndexed(const int slot) const
+{
+    // torrent slot can be beyond the bitmaps until the torrent is loaded
+    if ((slot < 0) || (slot >= m_untaggedBitmap.size()))
+        return false;
+
+    return m_stateBitmaps[TorrentFilter::All].testBit(slot);
+}
+
+bool TorrentFilterIndex::insertTorrent(const int slot, const BitTorrent::TorrentID &id, const QString &category
+        , const TagSet &tags, const bool isPrivate, const States states)
+{
+    if ((slot < 0) || isIndexed(slot))
+        return false;
+
+    reserveSlots(slot + 1);
+
+    m_slotsByID.insert(id, slot);
+    m_idsBySlot[slot] = id;
+    m_stateBitmaps[TorrentFilter::All].setBit(slot);
+    bitmap(m_categoryBitmaps, category).setBit(slot);
+
+    if (tags.isEmpty())
+        m_untaggedBitmap.setBit(slot);
+    for (const Tag &tag : tags)
+        bitmap(m_tagBitmaps, tag.toString()).setBit(slot);
+
+    m_privateBitmap.setBit(slot, isPrivate);
+
+    updateStates(slot, states);
+    return true;
+}
+
+bool TorrentFilterIndex::updateStates(const int slot, const States states)
+{
+    if (!isIndexed(slot))
+        return false;
+
+    bool isUpdated = false;
+    for (int type = (TorrentFilter::All + 1); type < TorrentFilter::_Count; ++type)
+    {
+        QBitArray &stateBitmap = m_stateBitmaps[type];
+        if (stateBitmap.testBit(slot) == states.test(type))
+            continue;
+
+        stateBitmap.toggleBit(slot);
+        isUpdated = true;
+    }
+
+    return isUpdated;
+}
+
+void TorrentFilterIndex::reserveSlots(const qsizetype count)
+{
+    const qsizetype capacity = m_untaggedBitmap.size();
+    if (count <= capacity)
+        return;
+
+    // grow geometrically so that bitmaps aren't reallocated for each added torrent
+    const qsizetype newCapacity = std::max({count, (capacity * 2), MIN_SLOTS_CAPACITY});
+
+    for (QBitArray &stateBitmap : m_stateBitmaps)
+        stateBitmap.resize(newCapacity);
+    for (QBitArray &categoryBitmap : m_categoryBitmaps)
+        categoryBitmap.resize(newCapacity);
+    for (QBitArray &tagBitmap : m_tagBitmaps)
+        tagBitmap.resize(newCapacity);
+    m_untaggedBitmap.resize(newCapacity);
+    m_privateBitmap.resize(newCapacity);
+    m_idsBySlot.resize(newCapacity);
+}
+
+QBitArray &TorrentFilterIndex::bitmap(QHash<QString, QBitArray> &bitmaps, const QString &key)
+{
+    auto iter = bitmaps.find(key);
+    if (iter == bitmaps.end())
+        iter = bitmaps.insert(key, QBitArray(m_untaggedBitmap.size()));
+    return iter.value();
+}
+
+QBitArray TorrentFilterIndex::categoryBitmap(const QString &category) const
+{
+    QBitArray result = m_categoryBitmaps.value(category, QBitArray(m_untaggedBitmap.size()));
+    if (category.isEmpty() || !m_isSubcategoriesEnabled)
+        return result;
+
+    const QString prefix = category + u'/';
+    for (auto iter = m_categoryBitmaps.cbegin(); iter != m_categoryBitmaps.cend(); ++iter)
+    {
+        if (iter.key().startsWith(prefix))
+            result |= iter.value();
+    }
+
+    return result;
+}
@@ -0,0 +1,108 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+
+#include <QBitArray>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QString>
+
+#include "base/bittorrent/infohash.h"
+#include "base/tagset.h"
+#include "torrentfilter.h"
+
+namespace BitTorrent
+{
+    class Session;
+    class Torrent;
+}
+
+// Keeps bitmaps (indexed by torrent slots) of torrents matching each state, category and tag filter,
+// so filtering is reduced to intersection of bitmaps instead of matching every torrent.
+class TorrentFilterIndex final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TorrentFilterIndex)
+
+public:
+    // Filter types matched by torrent (TorrentFilter::All is ignored)
+    using States = std::bitset<TorrentFilter::_Count>;
+
+    explicit TorrentFilterIndex(QObject *parent = nullptr);
+
+    // Keeps the index updated from the signals of the given session
+    void watch(const BitTorrent::Session *session);
+
+    static States torrentStates(const BitTorrent::Torrent *torrent);
+
+    // Torrents are listed in the order of their slots
+    QList<BitTorrent::Torrent *> torrents(const TorrentFilter &filter) const;
+    QList<int> torrentSlots(const TorrentFilter &filter) const;
+    qsizetype torrentsCount(TorrentFilter::Type type) const;
+
+    void addTorrent(int slot, const BitTorrent::TorrentID &id, const QString &category, const TagSet &tags, bool isPrivate, States states);
+    void removeTorrent(int slot);
+    void setTorrentStates(int slot, States states);
+    void setTorrentCategory(int slot, const QString &category);
+    void addTorrentTag(int slot, const Tag &tag);
+    void removeTorrentTag(int slot, const Tag &tag);
+    void setTorrentPrivate(int slot, bool isPrivate);
+    void setSubcategoriesEnabled(bool enabled);
+
+signals:
+    // Emitted when some torrent starts or stops matching some state filter
+    void statesUpdated();
+
+private:
+    void handleTorrentsLoaded(const QList<BitTorrent::Torrent *> &torrents);
+    void handleTorrentsUpdated(const QList<BitTorrent::Torrent *> &torrents);
+
+    bool isIndexed(int slot) const;
+    bool insertTorrent(int slot, const BitTorrent::TorrentID &id, const QString &category, const TagSet &tags, bool isPrivate, States states);
+    bool updateStates(int slot, States states);
+    void reserveSlots(qsizetype count);
+    QBitArray &bitmap(QHash<QString, QBitArray> &bitmaps, const QString &key);
+    QBitArray categoryBitmap(const QString &category) const;
+
+    const BitTorrent::Session *m_session = nullptr;
+    bool m_isSubcategoriesEnabled = false;
+
+    QHash<BitTorrent::TorrentID, int> m_slotsByID;
+    QList<BitTorrent::TorrentID> m_idsBySlot;
+    // bitmap for TorrentFilter::All holds slots of indexed torrents
+    std::array<QBitArray, TorrentFilter::_Count> m_stateBitmaps;
+    QHash<QString, QBitArray> m_categoryBitmaps;
+    QHash<QString, QBitArray> m_tagBitmaps;
+    QBitArray m_untaggedBitmap;
+    QBitArray m_privateBitmap;
+};
@@ -211,6 +211,27 @@ qint64 Utils::Fs::freeDiskSpaceOnPath(const Path &path)
     return QStorageInfo(path.data()).bytesAvailable();
 }
 
+QString Utils::Fs::deviceID(const Path &path)
+{
+    // path to be created doesn't exist yet so check the directory it will be created in
+    Path existingPath = toAbsolutePath(path);
+    while (!existingPath.isEmpty() && !existingPath.exists())
+        existingPath = existingPath.parentPath();
+
+    if (existingPath.isEmpty())
+        return {};
+
+#ifdef Q_OS_WIN
+    return QString::fromUtf8(QStorageInfo(existingPath.data()).device());
+#else
+    struct stat buf {};
+    if (::stat(existingPath.toString().toLocal8Bit().constData(), &buf) != 0)
+        return {};
+
+    return QString::number(static_cast<quint64>(buf.st_dev));
+#endif
+}
+
 Path Utils::Fs::tempPath()
 {
     static const Path path = Path(QDir::tempPath()) / Path(u".qBittorrent"_s);
@@ -45,6 +45,9 @@ namespace Utils::Fs
 {
     qint64 computePathSize(const Path &path);
     qint64 freeDiskSpaceOnPath(const Path &path);
+    // Identifies the device the path (or its nearest existing parent) resides on,
+    // returns empty string if it cannot be determined
+    QString deviceID(const Path &path);
 
     bool isValidName(const QString &name);
     bool isRegularFile(const Path &path);
@@ -33,12 +33,15 @@
 
 #include <QtAssert>
 #include <QByteArray>
+#include <QFile>
 
 #ifndef ZLIB_CONST
 #define ZLIB_CONST  // make z_stream.next_in const
 #endif
 #include <zlib.h>
 
+#include "base/path.h"
+
 QByteArray Utils::Gzip::compress(const QByteArray &data, const int level, bool *ok)
 {
     if (ok)
@@ -135,3 +138,60 @@ QByteArray Utils::Gzip::decompress(const QByteArray &data, bool *ok)
     if (ok) *ok = true;
     return output;
 }
+
+bool Utils::Gzip::compressFile(const Path &source, const Path &destination, const int level)
+{
+    QFile sourceFile {source.data()};
+    if (!sourceFile.open(QIODevice::ReadOnly))
+        return false;
+
+    QFile destinationFile {destination.data()};
+    if (!destinationFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    z_stream strm {};
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    // windowBits = 15 + 16 to enable gzip
+    if (deflateInit2(&strm, level, Z_DEFLATED, (15 + 16), 9, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+
+    const int BUFSIZE = 256 * 1024;
+    std::vector<char> inBuf(BUFSIZE);
+    std::vector<char> outBuf(BUFSIZE);
+
+    bool result = true;
+    int flush = Z_NO_FLUSH;
+    while (result && (flush != Z_FINISH))
+    {
+        const qint64 bytesRead = sourceFile.read(inBuf.data(), BUFSIZE);
+        if (bytesRead < 0)
+        {
+            result = false;
+            break;
+        }
+
+        flush = sourceFile.atEnd() ? Z_FINISH : Z_NO_FLUSH;
+        strm.next_in = reinterpret_cast<const Bytef *>(inBuf.data());
+        strm.avail_in = static_cast<uInt>(bytesRead);
+
+        do
+        {
+            strm.next_out = reinterpret_cast<Bytef *>(outBuf.data());
+            strm.avail_out = BUFSIZE;
+            deflate(&strm, flush);
+
+            const qint64 bytesToWrite = BUFSIZE - strm.avail_out;
+            if (destinationFile.write(outBuf.data(), bytesToWrite) != bytesToWrite)
+            {
+                result = false;
+                break;
+            }
+        } while (strm.avail_out == 0);
+    }
+
+    deflateEnd(&strm);
+    return result;
+}
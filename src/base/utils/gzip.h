@@ -29,10 +29,15 @@
 
 #pragma once
 
+#include "base/pathfwd.h"
+
 class QByteArray;
 
 namespace Utils::Gzip
 {
     QByteArray compress(const QByteArray &data, int level = 6, bool *ok = nullptr);
     QByteArray decompress(const QByteArray &data, bool *ok = nullptr);
+
+    // Compresses file in chunks so that large files don't need to be loaded into memory
+    bool compressFile(const Path &source, const Path &destination, int level = 6);
 }
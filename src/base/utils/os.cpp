@@ -35,6 +35,7 @@
 
 #include <windows.h>
 #include <powrprof.h>
+#include <psapi.h>
 #include <shlobj.h>
 #endif // Q_OS_WIN
 
@@ -42,8 +43,13 @@
 #include <Carbon/Carbon.h>
 #include <CoreFoundation/CoreFoundation.h>
 #include <CoreServices/CoreServices.h>
+#include <mach/mach.h>
 #endif // Q_OS_MACOS
 
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif // Q_OS_LINUX
+
 #include <QScopeGuard>
 
 #ifdef QBT_USES_DBUS
@@ -54,6 +60,10 @@
 #include <QCoreApplication>
 #endif // Q_OS_WIN
 
+#ifdef Q_OS_LINUX
+#include <QFile>
+#endif // Q_OS_LINUX
+
 #include "base/global.h"
 #include "base/types.h"
 
@@ -193,6 +203,36 @@ void Utils::OS::shutdownComputer([[maybe_unused]] const ShutdownDialogAction &ac
 #endif
 }
 
+qint64 Utils::OS::residentMemorySize()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters {};
+    if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+        return -1;
+    return counters.WorkingSetSize;
+#elif defined(Q_OS_MACOS)
+    mach_task_basic_info info {};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (::task_info(::mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+        return -1;
+    return info.resident_size;
+#elif defined(Q_OS_LINUX)
+    // The second field of "statm" is the number of resident pages
+    QFile statm {u"/proc/self/statm"_s};
+    if (!statm.open(QIODevice::ReadOnly))
+        return -1;
+
+    const QList<QByteArray> fields = statm.readLine().split(' ');
+    bool ok = false;
+    const qint64 residentPages = fields.value(1).toLongLong(&ok);
+    if (!ok)
+        return -1;
+    return residentPages * ::sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
 #ifdef Q_OS_WIN
 Path Utils::OS::windowsSystemPath()
 {
@@ -47,6 +47,8 @@ enum class ShutdownDialogAction;
 namespace Utils::OS
 {
     void shutdownComputer(const ShutdownDialogAction &action);
+    // Returns -1 if it cannot be determined on the current platform
+    qint64 residentMemorySize();
 
 #ifdef Q_OS_WIN
     Path windowsSystemPath();
@@ -35,11 +35,15 @@
 #include <QHostAddress>
 #include <QLabel>
 #include <QNetworkInterface>
+#include <QStringList>
 
 #include "base/bittorrent/session.h"
 #include "base/global.h"
+#include "base/memoryusagetracker.h"
 #include "base/preferences.h"
 #include "base/unicodestrings.h"
+#include "base/utils/misc.h"
+#include "base/utils/os.h"
 #include "gui/desktopintegration.h"
 #include "gui/mainwindow.h"
 #include "interfaces/iguiapplication.h"
@@ -70,6 +74,11 @@ namespace
 #if defined(Q_OS_WIN)
         OS_MEMORY_PRIORITY,
 #endif
+        MEMORY_USAGE,
+        METADATA_UNLOADING,
+        // log file
+        LOG_FILE_FORMAT,
+        LOG_FILE_COMPRESS_BACKUPS,
         // network interface
         NETWORK_IFACE,
         //Optional network address
@@ -216,6 +225,11 @@ void AdvancedSettings::saveAdvancedSettings() const
 #if defined(Q_OS_WIN)
     app()->setProcessMemoryPriority(m_comboBoxOSMemoryPriority.currentData().value<MemoryPriority>());
 #endif
+    // Unload metadata of inactive torrents
+    session->setMetadataUnloadingEnabled(m_checkBoxMetadataUnloading.isChecked());
+    // Log file
+    app()->setFileLoggerFormat(m_comboBoxLogFileFormat.currentIndex());
+    app()->setFileLoggerCompressBackups(m_checkBoxCompressLogFileBackups.isChecked());
     // Bdecode depth limit
     pref->setBdecodeDepthLimit(m_spinBoxBdecodeDepthLimit.value());
     // Bdecode token limit
@@ -514,6 +528,43 @@ void AdvancedSettings::loadAdvancedSettings()
         + u' ' + makeLink(u"https://docs.microsoft.com/en-us/windows/win32/api/processthreadsapi/ns-processthreadsapi-memory_priority_information", u"(?)"))
         , &m_comboBoxOSMemoryPriority);
 #endif
+    // Memory usage
+    const QHash<QString, MemoryUsage> memoryUsage = MemoryUsageTracker::instance()->estimate();
+    const std::pair<QString, QString> memoryComponents[] =
+    {
+        {MemoryComponent::Torrents, tr("Torrents")},
+        {MemoryComponent::Metadata, tr("Metadata")},
+        {MemoryComponent::Peers, tr("Peers")},
+        {MemoryComponent::DiskCache, tr("Disk cache")},
+        {MemoryComponent::Logs, tr("Logs")},
+        {MemoryComponent::RSS, tr("RSS")},
+        {MemoryComponent::Search, tr("Search")},
+        {MemoryComponent::WebUISync, tr("WebUI")}
+    };
+    QStringList memoryUsageDetails;
+    for (const auto &[component, componentName] : memoryComponents)
+    {
+        memoryUsageDetails.append(tr("%1: %2", "Torrents: 20 MiB")
+            .arg(componentName, Utils::Misc::friendlyUnit(memoryUsage.value(component).size)));
+    }
+    const qint64 residentMemorySize = Utils::OS::residentMemorySize();
+    m_labelMemoryUsage.setText(u"%1 (%2)"_s.arg(((residentMemorySize >= 0) ? Utils::Misc::friendlyUnit(residentMemorySize) : tr("N/A"))
+        , memoryUsageDetails.join(u", ")));
+    m_labelMemoryUsage.setToolTip(tr("Memory used by qBittorrent along with the estimated usage of its components"));
+    addRow(MEMORY_USAGE, tr("Memory usage"), &m_labelMemoryUsage);
+    // Unload metadata of inactive torrents
+    m_checkBoxMetadataUnloading.setChecked(session->isMetadataUnloadingEnabled());
+    m_checkBoxMetadataUnloading.setToolTip(tr("Stopped and queued torrents release the copy of their metadata kept by qBittorrent."
+        " The metadata kept by libtorrent remains loaded, so it saves at most half of the memory used by metadata."));
+    addRow(METADATA_UNLOADING, tr("Unload metadata of inactive torrents"), &m_checkBoxMetadataUnloading);
+    // Log file format
+    m_comboBoxLogFileFormat.addItem(tr("Plain text"));
+    m_comboBoxLogFileFormat.addItem(tr("JSON lines"));
+    m_comboBoxLogFileFormat.setCurrentIndex(app()->fileLoggerFormat());
+    addRow(LOG_FILE_FORMAT, tr("Log file format"), &m_comboBoxLogFileFormat);
+    // Compress log file backups
+    m_checkBoxCompressLogFileBackups.setChecked(app()->isFileLoggerCompressBackups());
+    addRow(LOG_FILE_COMPRESS_BACKUPS, tr("Compress log file backups (gzip)"), &m_checkBoxCompressLogFileBackups);
     // Bdecode depth limit
     m_spinBoxBdecodeDepthLimit.setMinimum(0);
     m_spinBoxBdecodeDepthLimit.setMaximum(std::numeric_limits<int>::max());
@@ -0,0 +1,115 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+
+#include <QCache>
+#include <QDateTime>
+#include <QList>
+#include <QString>
+
+// Caches display strings of table cells so that sizes, speeds, durations etc.
+// aren't formatted again every time the view repaints. The string returned by
+// `format` is reused until any of the `values` it was formatted from changes.
+// Only the most recently used rows are kept.
+template <typename RowKey>
+class DisplayValueCache
+{
+public:
+    explicit DisplayValueCache(const int columnCount, const qsizetype maxRowCount = 1000)
+        : m_columnCount {columnCount}
+        , m_rows {maxRowCount}
+    {
+    }
+
+    template <typename Formatter, typename ...Values>
+    QString value(const RowKey &row, const int column, const Formatter &format, const Values &...values)
+    {
+        static_assert(sizeof...(Values) <= KEY_SIZE);
+
+        Q_ASSERT((column >= 0) && (column < m_columnCount));
+
+        QList<Entry> *entries = m_rows.object(row);
+        if (!entries)
+        {
+            entries = new QList<Entry>(m_columnCount);
+            m_rows.insert(row, entries);
+        }
+
+        const Key key {toKey(values)...};
+        Entry &entry = (*entries)[column];
+        if (!entry.isValid || (entry.key != key))
+        {
+            entry.key = key;
+            entry.text = format();
+            entry.isValid = true;
+        }
+
+        return entry.text;
+    }
+
+    void remove(const RowKey &row)
+    {
+        m_rows.remove(row);
+    }
+
+    void clear()
+    {
+        m_rows.clear();
+    }
+
+private:
+    static constexpr int KEY_SIZE = 3;
+    using Key = std::array<qint64, KEY_SIZE>;
+
+    struct Entry
+    {
+        Key key {};
+        QString text;
+        bool isValid = false;
+    };
+
+    template <typename T>
+    static qint64 toKey(const T &value)
+    {
+        if constexpr (std::floating_point<T>)
+            return std::bit_cast<qint64>(static_cast<double>(value));
+        else if constexpr (std::same_as<T, QDateTime>)
+            return value.isValid() ? value.toMSecsSinceEpoch() : std::numeric_limits<qint64>::min();
+        else
+            return static_cast<qint64>(value);
+    }
+
+    int m_columnCount = 0;
+    QCache<RowKey, QList<Entry>> m_rows;
+};
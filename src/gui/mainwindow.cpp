@@ -88,6 +88,7 @@
 #include "properties/peerlistwidget.h"
 #include "properties/propertieswidget.h"
 #include "properties/proptabbar.h"
+#include "refreshscheduleroverlay.h"
 #include "rss/rsswidget.h"
 #include "search/searchwidget.h"
 #include "speedlimitdialog.h"
@@ -134,6 +135,7 @@ MainWindow::MainWindow(IGUIApplication *app, const WindowState initialState, con
     , m_uploadRate {Utils::Misc::friendlyUnit(0, true)}
     , m_pwr {new PowerManagement}
     , m_preventTimer {new QTimer(this)}
+    , m_refreshScheduler {new RefreshScheduler(this)}
     , m_storeExecutionLogEnabled {EXECUTIONLOG_SETTINGS_KEY(u"Enabled"_s)}
     , m_storeDownloadTrackerFavicon {SETTINGS_KEY(u"DownloadTrackerFavicon"_s)}
     , m_storeExecutionLogTypes {EXECUTIONLOG_SETTINGS_KEY(u"Types"_s), Log::MsgType::ALL}
@@ -251,6 +253,8 @@ MainWindow::MainWindow(IGUIApplication *app, const WindowState initialState, con
     m_transferListWidget = new TransferListWidget(app, this);
     m_propertiesWidget = new PropertiesWidget(hSplitter);
     connect(m_transferListWidget, &TransferListWidget::currentTorrentChanged, m_propertiesWidget, &PropertiesWidget::loadTorrentInfos);
+    m_propertiesRefreshTask = m_refreshScheduler->addTask(u"Properties"_s, m_propertiesWidget
+        , RefreshScheduler::Priority::High, [this] { m_propertiesWidget->loadDynamicData(); });
     hSplitter->addWidget(m_transferListWidget);
     hSplitter->addWidget(m_propertiesWidget);
     m_splitter->addWidget(hSplitter);
@@ -350,7 +354,14 @@ MainWindow::MainWindow(IGUIApplication *app, const WindowState initialState, con
     // Configure BT session according to options
     loadPreferences();
 
-    connect(BitTorrent::Session::instance(), &BitTorrent::Session::statsUpdated, this, &MainWindow::loadSessionStats);
+    // Window title and tray icon tooltip are refreshed even if window is hidden
+    m_sessionStatsRefreshTask = m_refreshScheduler->addTask(u"Session statistics"_s, nullptr
+        , RefreshScheduler::Priority::Low, [this] { loadSessionStats(); });
+    connect(BitTorrent::Session::instance(), &BitTorrent::Session::statsUpdated, this, [this]
+    {
+        m_refreshScheduler->schedule(m_sessionStatsRefreshTask);
+        m_refreshScheduler->schedule(m_statusBarRefreshTask);
+    });
     connect(BitTorrent::Session::instance(), &BitTorrent::Session::torrentsUpdated, this, &MainWindow::reloadTorrentStats);
 
     createKeyboardShortcuts();
@@ -780,6 +791,14 @@ void MainWindow::toggleFocusBetweenLineEdits()
     }
 }
 
+void MainWindow::toggleRefreshSchedulerOverlay()
+{
+    if (!m_refreshSchedulerOverlay)
+        m_refreshSchedulerOverlay = new RefreshSchedulerOverlay(m_refreshScheduler, this);
+
+    m_refreshSchedulerOverlay->setVisible(!m_refreshSchedulerOverlay->isVisible());
+}
+
 void MainWindow::updateNbTorrents()
 {
     m_tabs->setTabText(0, tr("Transfers (%1)").arg(m_transferListWidget->getSourceModel()->rowCount()));
@@ -909,6 +928,8 @@ void MainWindow::createKeyboardShortcuts()
     connect(switchSearchFilterShortcut, &QShortcut::activated, this, &MainWindow::toggleFocusBetweenLineEdits);
     const auto *switchSearchFilterShortcutAlternative = new QShortcut((Qt::CTRL | Qt::Key_E), m_transferListWidget);
     connect(switchSearchFilterShortcutAlternative, &QShortcut::activated, this, &MainWindow::toggleFocusBetweenLineEdits);
+    const auto *refreshSchedulerOverlayShortcut = new QShortcut((Qt::CTRL | Qt::SHIFT | Qt::Key_F12), this);
+    connect(refreshSchedulerOverlayShortcut, &QShortcut::activated, this, &MainWindow::toggleRefreshSchedulerOverlay);
 
     m_ui->actionDocumentation->setShortcut(QKeySequence::HelpContents);
     m_ui->actionOptions->setShortcut(Qt::ALT | Qt::Key_O);
@@ -1347,6 +1368,9 @@ void MainWindow::showStatusBar(bool show)
         m_statusBar = new StatusBar;
         connect(m_statusBar.data(), &StatusBar::connectionButtonClicked, this, &MainWindow::showConnectionSettings);
         connect(m_statusBar.data(), &StatusBar::alternativeSpeedsButtonClicked, this, &MainWindow::toggleAlternativeSpeeds);
+        connect(app()->addTorrentManager(), &AddTorrentManager::addTorrentsProgress, m_statusBar.data(), &StatusBar::showAddTorrentsProgress);
+        m_statusBarRefreshTask = m_refreshScheduler->addTask(u"Status bar"_s, m_statusBar
+            , RefreshScheduler::Priority::Normal, [statusBar = m_statusBar.data()] { statusBar->refresh(); });
         setStatusBar(m_statusBar);
     }
 }
@@ -1356,10 +1380,6 @@ void MainWindow::showFiltersSidebar(const bool show)
     if (show && !m_transferListFiltersWidget)
     {
         m_transferListFiltersWidget = new TransferListFiltersWidget(m_splitter, m_transferListWidget, isDownloadTrackerFavicon());
-        connect(BitTorrent::Session::instance(), &BitTorrent::Session::trackersAdded, m_transferListFiltersWidget, &TransferListFiltersWidget::addTrackers);
-        connect(BitTorrent::Session::instance(), &BitTorrent::Session::trackersRemoved, m_transferListFiltersWidget, &TransferListFiltersWidget::removeTrackers);
-        connect(BitTorrent::Session::instance(), &BitTorrent::Session::trackersChanged, m_transferListFiltersWidget, &TransferListFiltersWidget::refreshTrackers);
-        connect(BitTorrent::Session::instance(), &BitTorrent::Session::trackerEntryStatusesUpdated, m_transferListFiltersWidget, &TransferListFiltersWidget::trackerEntryStatusesUpdated);
 
         m_splitter->insertWidget(0, m_transferListFiltersWidget);
         m_splitter->setCollapsible(0, true);
@@ -1481,7 +1501,7 @@ void MainWindow::reloadTorrentStats(const QList<BitTorrent::Torrent *> &torrents
     if (currentTabWidget() == m_transferListWidget)
     {
         if (torrents.contains(m_propertiesWidget->getCurrentTorrent()))
-            m_propertiesWidget->loadDynamicData();
+            m_refreshScheduler->schedule(m_propertiesRefreshTask);
     }
 }
 
@@ -36,6 +36,7 @@
 #include "base/logger.h"
 #include "base/settingvalue.h"
 #include "guiapplicationcomponent.h"
+#include "refreshscheduler.h"
 #include "windowstate.h"
 
 class QCloseEvent;
@@ -54,6 +55,7 @@ class OptionsDialog;
 class PowerManagement;
 class ProgramUpdater;
 class PropertiesWidget;
+class RefreshSchedulerOverlay;
 class RSSWidget;
 class SearchWidget;
 class StatsDialog;
@@ -128,6 +130,7 @@ private slots:
     void displayRSSTab();
     void displayExecutionLogTab();
     void toggleFocusBetweenLineEdits();
+    void toggleRefreshSchedulerOverlay();
     void loadSessionStats();
     void reloadTorrentStats(const QList<BitTorrent::Torrent *> &torrents);
     void loadPreferences();
@@ -249,6 +252,12 @@ private:
     PowerManagement *m_pwr = nullptr;
     QTimer *m_preventTimer = nullptr;
     QMenu *m_toolbarMenu = nullptr;
+    // GUI refreshes
+    RefreshScheduler *m_refreshScheduler = nullptr;
+    RefreshScheduler::TaskID m_sessionStatsRefreshTask = 0;
+    RefreshScheduler::TaskID m_propertiesRefreshTask = 0;
+    RefreshScheduler::TaskID m_statusBarRefreshTask = 0;
+    QPointer<RefreshSchedulerOverlay> m_refreshSchedulerOverlay;
 
     SettingValue<bool> m_storeExecutionLogEnabled;
     SettingValue<bool> m_storeDownloadTrackerFavicon;
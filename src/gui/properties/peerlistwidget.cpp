@@ -249,7 +249,7 @@ void PeerListWidget::updatePeerHostNameResolutionState()
         if (!m_resolver)
         {
             m_resolver = new Net::ReverseResolution(this);
-            connect(m_resolver, &Net::ReverseResolution::ipResolved, this, &PeerListWidget::handleResolved);
+            connect(m_resolver, &Net::ReverseResolution::ipsResolved, this, &PeerListWidget::handleResolved);
             loadPeers(m_properties->getCurrentTorrent());
         }
     }
@@ -262,7 +262,7 @@ void PeerListWidget::updatePeerHostNameResolutionState()
 
 void PeerListWidget::updatePeerCountryResolutionState()
 {
-    const bool resolveCountries = Preferences::instance()->resolvePeerCountries();
+    const bool resolveCountries = Preferences::instance()->snapshot().resolvePeerCountries;
     if (resolveCountries == m_resolveCountries)
         return;
 
@@ -425,8 +425,8 @@ void PeerListWidget::loadPeers(const BitTorrent::Torrent *torrent)
         for (auto i = m_peerItems.cbegin(); i != m_peerItems.cend(); ++i)
             existingPeers.insert(i.key());
 
-        const Preferences *pref = Preferences::instance();
-        const bool hideZeroValues = (pref->getHideZeroValues() && (pref->getHideZeroComboValues() == 0));
+        const PreferencesSnapshot &pref = Preferences::instance()->snapshot();
+        const bool hideZeroValues = (pref.hideZeroValues && (pref.hideZeroComboValues == 0));
         for (const BitTorrent::PeerInfo &peer : peers)
         {
             const PeerEndpoint peerEndpoint {peer.address(), peer.connectionType()};
@@ -556,14 +556,19 @@ int PeerListWidget::visibleColumnsCount() const
     return count;
 }
 
-void PeerListWidget::handleResolved(const QHostAddress &ip, const QString &hostname) const
+void PeerListWidget::handleResolved(const QHash<QHostAddress, QString> &hostnames) const
 {
-    if (hostname.isEmpty())
-        return;
+    // resort only once for the whole batch
+    m_proxyModel->setDynamicSortFilter(false);
 
-    const QSet<QStandardItem *> items = m_itemsByIP.value(ip);
-    for (QStandardItem *item : items)
-        item->setData(hostname, Qt::DisplayRole);
+    for (auto iter = hostnames.cbegin(); iter != hostnames.cend(); ++iter)
+    {
+        const QSet<QStandardItem *> items = m_itemsByIP.value(iter.key());
+        for (QStandardItem *item : items)
+            item->setData(iter.value(), Qt::DisplayRole);
+    }
+
+    m_proxyModel->setDynamicSortFilter(true);
 }
 
 void PeerListWidget::handleSortColumnChanged(const int col)
@@ -95,7 +95,7 @@ private slots:
     void banSelectedPeers();
     void copySelectedPeers();
     void handleSortColumnChanged(int col);
-    void handleResolved(const QHostAddress &ip, const QString &hostname) const;
+    void handleResolved(const QHash<QHostAddress, QString> &hostnames) const;
 
 private:
     void updatePeer(int row, const BitTorrent::Torrent *torrent, const BitTorrent::PeerInfo &peer, bool hideZeroValues);
@@ -0,0 +1,193 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "refreshscheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QTimer>
+#include <QWidget>
+
+#include "base/global.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    // keep some time of the frame for event processing and painting
+    const auto FRAME_BUDGET = 8ms;
+    const auto FRAME_INTERVAL = 16ms;
+
+    std::chrono::microseconds elapsedTime(const QElapsedTimer &timer)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(timer.nsecsElapsed()));
+    }
+}
+
+RefreshScheduler::RefreshScheduler(QObject *parent)
+    : QObject(parent)
+    , m_frameTimer {new QTimer(this)}
+{
+    m_frameTimer->setSingleShot(true);
+    connect(m_frameTimer, &QTimer::timeout, this, &RefreshScheduler::runFrame);
+}
+
+RefreshScheduler::TaskID RefreshScheduler::addTask(const QString &name, QWidget *widget
+        , const Priority priority, std::function<void ()> handler)
+{
+    const TaskID id = ++m_lastTaskID;
+    m_tasks.insert(id, {.name = name, .widget = widget, .hasWidget = (widget != nullptr)
+        , .priority = priority, .handler = std::move(handler), .stats = {.name = name}});
+
+    if (widget)
+    {
+        connect(widget, &QObject::destroyed, this, [this, id] { removeTask(id); });
+        widget->installEventFilter(this);
+    }
+
+    return id;
+}
+
+void RefreshScheduler::removeTask(const TaskID id)
+{
+    m_tasks.remove(id);
+    m_pendingTasks.removeOne(id);
+}
+
+void RefreshScheduler::schedule(const TaskID id)
+{
+    if (!m_tasks.contains(id) || m_pendingTasks.contains(id))
+        return;
+
+    m_pendingTasks.append(id);
+    if (!m_frameTimer->isActive())
+        m_frameTimer->start(0);
+}
+
+std::chrono::milliseconds RefreshScheduler::frameBudget() const
+{
+    return FRAME_BUDGET;
+}
+
+QList<RefreshScheduler::TaskStats> RefreshScheduler::taskStats() const
+{
+    QList<TaskStats> stats;
+    stats.reserve(m_tasks.size());
+    for (const Task &task : m_tasks)
+        stats.append(task.stats);
+    return stats;
+}
+
+RefreshScheduler::FrameStats RefreshScheduler::frameStats() const
+{
+    return m_frameStats;
+}
+
+bool RefreshScheduler::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Show)
+    {
+        for (auto iter = m_tasks.cbegin(); iter != m_tasks.cend(); ++iter)
+        {
+            if (iter->isOutdated && (iter->widget == watched))
+                schedule(iter.key());
+        }
+    }
+
+    return QObject::eventFilter(watched, event);
+}
+
+void RefreshScheduler::runFrame()
+{
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+
+    QList<TaskID> pendingTasks = std::exchange(m_pendingTasks, {});
+    std::ranges::stable_sort(pendingTasks, std::less(), [this](const TaskID id)
+    {
+        return m_tasks.value(id).priority;
+    });
+
+    qsizetype processedCount = 0;
+    for (const TaskID id : asConst(pendingTasks))
+    {
+        // at least one task is run per frame so none of them can be starved
+        if ((processedCount > 0) && (elapsedTime(frameTimer) >= FRAME_BUDGET))
+            break;
+
+        ++processedCount;
+
+        auto iter = m_tasks.find(id);
+        if (iter == m_tasks.end())
+            continue;
+
+        if (iter->hasWidget && (!iter->widget || !iter->widget->isVisible()))
+        {
+            iter->isOutdated = true;
+            ++iter->stats.skips;
+            continue;
+        }
+
+        iter->isOutdated = false;
+
+        // handler can add or remove tasks so it must not be called through the iterator
+        const std::function<void ()> handler = iter->handler;
+        QElapsedTimer taskTimer;
+        taskTimer.start();
+        handler();
+        const std::chrono::microseconds cost = elapsedTime(taskTimer);
+
+        iter = m_tasks.find(id);
+        if (iter == m_tasks.end())
+            continue;
+
+        TaskStats &stats = iter->stats;
+        stats.averageCost = (stats.runs == 0) ? cost : ((stats.averageCost * 7) + cost) / 8;
+        stats.lastCost = cost;
+        stats.maxCost = std::max(stats.maxCost, cost);
+        ++stats.runs;
+    }
+
+    // deferred tasks go before the ones requested while running this frame
+    const QList<TaskID> deferredTasks = pendingTasks.sliced(processedCount);
+    for (const TaskID id : deferredTasks)
+        m_pendingTasks.removeOne(id);
+    m_pendingTasks = deferredTasks + m_pendingTasks;
+
+    m_frameStats.lastFrameTime = elapsedTime(frameTimer);
+    m_frameStats.maxFrameTime = std::max(m_frameStats.maxFrameTime, m_frameStats.lastFrameTime);
+    m_frameStats.deferredTasks = deferredTasks.size();
+
+    if (!m_pendingTasks.isEmpty())
+        m_frameTimer->start(FRAME_INTERVAL);
+
+    emit frameFinished();
+}
@@ -0,0 +1,115 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+
+class QTimer;
+class QWidget;
+
+// Coalesces GUI refreshes requested by various sources and runs them on the next frame.
+// Refreshes of visible widgets go first, refreshes of hidden widgets are postponed
+// until the widget is shown again and refreshes that don't fit into frame time budget
+// are deferred to the next frame.
+class RefreshScheduler final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(RefreshScheduler)
+
+public:
+    using TaskID = int;
+
+    enum class Priority
+    {
+        High,
+        Normal,
+        Low
+    };
+
+    struct TaskStats
+    {
+        QString name;
+        qint64 runs = 0;
+        qint64 skips = 0;
+        std::chrono::microseconds lastCost {0};
+        std::chrono::microseconds averageCost {0};
+        std::chrono::microseconds maxCost {0};
+    };
+
+    struct FrameStats
+    {
+        std::chrono::microseconds lastFrameTime {0};
+        std::chrono::microseconds maxFrameTime {0};
+        qsizetype deferredTasks = 0;
+    };
+
+    explicit RefreshScheduler(QObject *parent = nullptr);
+
+    // Task is removed automatically when its widget is destroyed.
+    // Tasks without widget are considered always visible.
+    TaskID addTask(const QString &name, QWidget *widget, Priority priority, std::function<void ()> handler);
+    void removeTask(TaskID id);
+    void schedule(TaskID id);
+
+    std::chrono::milliseconds frameBudget() const;
+    QList<TaskStats> taskStats() const;
+    FrameStats frameStats() const;
+
+signals:
+    void frameFinished();
+
+private:
+    struct Task
+    {
+        QString name;
+        QPointer<QWidget> widget;
+        bool hasWidget = false;
+        // refresh was skipped while the widget was hidden
+        bool isOutdated = false;
+        Priority priority = Priority::Normal;
+        std::function<void ()> handler;
+        TaskStats stats;
+    };
+
+    bool eventFilter(QObject *watched, QEvent *event) override;
+    void runFrame();
+
+    QHash<TaskID, Task> m_tasks;
+    QList<TaskID> m_pendingTasks;
+    TaskID m_lastTaskID = 0;
+    QTimer *m_frameTimer = nullptr;
+    FrameStats m_frameStats;
+};
@@ -0,0 +1,105 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include "refreshscheduleroverlay.h"
+
+#include <algorithm>
+
+#include <QEvent>
+#include <QStringList>
+
+#include "base/global.h"
+#include "refreshscheduler.h"
+
+namespace
+{
+    QString formatCost(const std::chrono::microseconds cost)
+    {
+        return QString::number((cost.count() / 1000.0), 'f', 2);
+    }
+}
+
+RefreshSchedulerOverlay::RefreshSchedulerOverlay(const RefreshScheduler *scheduler, QWidget *parent)
+    : QLabel(parent)
+    , m_scheduler {scheduler}
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setTextFormat(Qt::PlainText);
+    setMargin(6);
+    setStyleSheet(u"QLabel {background-color: rgba(0, 0, 0, 180); color: white; font-family: monospace;}"_s);
+
+    parent->installEventFilter(this);
+    connect(m_scheduler, &RefreshScheduler::frameFinished, this, &RefreshSchedulerOverlay::updateStats);
+}
+
+void RefreshSchedulerOverlay::updateStats()
+{
+    if (!isVisible())
+        return;
+
+    const RefreshScheduler::FrameStats frameStats = m_scheduler->frameStats();
+
+    QStringList lines;
+    lines.append(u"Frame: %1 ms (max %2 ms, budget %3 ms), deferred: %4"_s
+        .arg(formatCost(frameStats.lastFrameTime), formatCost(frameStats.maxFrameTime)
+            , QString::number(m_scheduler->frameBudget().count()), QString::number(frameStats.deferredTasks)));
+
+    QList<RefreshScheduler::TaskStats> taskStats = m_scheduler->taskStats();
+    std::ranges::sort(taskStats, std::greater(), &RefreshScheduler::TaskStats::averageCost);
+    for (const RefreshScheduler::TaskStats &stats : asConst(taskStats))
+    {
+        lines.append(u"%1: %2 ms (avg %3 ms, max %4 ms), runs: %5, skips: %6"_s
+            .arg(stats.name, formatCost(stats.lastCost), formatCost(stats.averageCost), formatCost(stats.maxCost)
+                , QString::number(stats.runs), QString::number(stats.skips)));
+    }
+
+    setText(lines.join(u'\n'));
+    adjustSize();
+    updatePosition();
+}
+
+void RefreshSchedulerOverlay::updatePosition()
+{
+    const int spacing = 8;
+    move(std::max(0, (parentWidget()->width() - width() - spacing)), spacing);
+    raise();
+}
+
+bool RefreshSchedulerOverlay::eventFilter(QObject *watched, QEvent *event)
+{
+    if ((watched == parentWidget()) && (event->type() == QEvent::Resize))
+        updatePosition();
+
+    return QLabel::eventFilter(watched, event);
+}
+
+void RefreshSchedulerOverlay::showEvent(QShowEvent *event)
+{
+    QLabel::showEvent(event);
+    updateStats();
+}
@@ -29,14 +29,18 @@
 
 #include "searchjobwidget.h"
 
+#include <optional>
+
 #include <QApplication>
 #include <QClipboard>
 #include <QDesktopServices>
 #include <QHeaderView>
+#include <QItemSelectionModel>
 #include <QKeyEvent>
 #include <QMenu>
 #include <QMessageBox>
 #include <QPalette>
+#include <QRegularExpression>
 #include <QStandardItemModel>
 #include <QUrl>
 
@@ -45,20 +49,68 @@
 #include "base/search/searchdownloadhandler.h"
 #include "base/search/searchhandler.h"
 #include "base/search/searchpluginmanager.h"
+#include "base/search/searchresultstore.h"
 #include "base/utils/misc.h"
 #include "gui/interfaces/iguiapplication.h"
 #include "gui/lineedit.h"
 #include "gui/uithememanager.h"
-#include "searchsortmodel.h"
 #include "ui_searchjobwidget.h"
 
 namespace
 {
-    enum DataRole
+    enum SearchColumn
     {
-        LinkVisitedRole = Qt::UserRole + 100
+        NAME,
+        SIZE,
+        SEEDS,
+        LEECHES,
+        ENGINE_NAME,
+        ENGINE_URL,
+        PUB_DATE,
+        DL_LINK,
+        DESC_LINK,
+        NB_SEARCH_COLUMNS
     };
 
+    SearchResultStore::SortColumn toSortColumn(const int column)
+    {
+        switch (column)
+        {
+        case NAME:
+            return SearchResultStore::SortColumn::Name;
+        case SIZE:
+            return SearchResultStore::SortColumn::Size;
+        case SEEDS:
+            return SearchResultStore::SortColumn::Seeders;
+        case LEECHES:
+            return SearchResultStore::SortColumn::Leechers;
+        case ENGINE_NAME:
+            return SearchResultStore::SortColumn::EngineName;
+        case ENGINE_URL:
+            return SearchResultStore::SortColumn::SiteURL;
+        case PUB_DATE:
+            return SearchResultStore::SortColumn::PubDate;
+        default:
+            return SearchResultStore::SortColumn::None;
+        }
+    }
+
+    QStringList searchTermWords(const QString &searchTerm)
+    {
+        if ((searchTerm.length() > 2) && searchTerm.startsWith(u'"') && searchTerm.endsWith(u'"'))
+            return QStringList(searchTerm.sliced(1, (searchTerm.length() - 2)));
+
+        return searchTerm.split(u' ', Qt::SkipEmptyParts);
+    }
+
+    std::optional<qlonglong> filterLimit(const qint64 value)
+    {
+        if (value <= 0)
+            return std::nullopt;
+
+        return value;
+    }
+
     QColor visitedRowColor()
     {
         return QApplication::palette().color(QPalette::Disabled, QPalette::WindowText);
@@ -91,6 +143,7 @@ SearchJobWidget::SearchJobWidget(const QString &id, IGUIApplication *app, QWidge
     : GUIApplicationComponent(app, parent)
     , m_nameFilteringMode {u"Search/FilteringMode"_s}
     , m_id {id}
+    , m_resultStore {std::make_unique<SearchResultStore>()}
     , m_ui {new Ui::SearchJobWidget}
 {
     m_ui->setupUi(this);
@@ -104,43 +157,35 @@ SearchJobWidget::SearchJobWidget(const QString &id, IGUIApplication *app, QWidge
     fillFilterComboBoxes();
 
     // Set Search results list model
-    m_searchListModel = new QStandardItemModel(0, SearchSortModel::NB_SEARCH_COLUMNS, this);
-    m_searchListModel->setHeaderData(SearchSortModel::NAME, Qt::Horizontal, tr("Name", "i.e: file name"));
-    m_searchListModel->setHeaderData(SearchSortModel::SIZE, Qt::Horizontal, tr("Size", "i.e: file size"));
-    m_searchListModel->setHeaderData(SearchSortModel::SEEDS, Qt::Horizontal, tr("Seeders", "i.e: Number of full sources"));
-    m_searchListModel->setHeaderData(SearchSortModel::LEECHES, Qt::Horizontal, tr("Leechers", "i.e: Number of partial sources"));
-    m_searchListModel->setHeaderData(SearchSortModel::ENGINE_NAME, Qt::Horizontal, tr("Engine"));
-    m_searchListModel->setHeaderData(SearchSortModel::ENGINE_URL, Qt::Horizontal, tr("Engine URL"));
-    m_searchListModel->setHeaderData(SearchSortModel::PUB_DATE, Qt::Horizontal, tr("Published On"));
+    m_searchListModel = new QStandardItemModel(0, NB_SEARCH_COLUMNS, this);
+    m_searchListModel->setHeaderData(NAME, Qt::Horizontal, tr("Name", "i.e: file name"));
+    m_searchListModel->setHeaderData(SIZE, Qt::Horizontal, tr("Size", "i.e: file size"));
+    m_searchListModel->setHeaderData(SEEDS, Qt::Horizontal, tr("Seeders", "i.e: Number of full sources"));
+    m_searchListModel->setHeaderData(LEECHES, Qt::Horizontal, tr("Leechers", "i.e: Number of partial sources"));
+    m_searchListModel->setHeaderData(ENGINE_NAME, Qt::Horizontal, tr("Engine"));
+    m_searchListModel->setHeaderData(ENGINE_URL, Qt::Horizontal, tr("Engine URL"));
+    m_searchListModel->setHeaderData(PUB_DATE, Qt::Horizontal, tr("Published On"));
     // Set columns text alignment
-    m_searchListModel->setHeaderData(SearchSortModel::SIZE, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
-    m_searchListModel->setHeaderData(SearchSortModel::SEEDS, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
-    m_searchListModel->setHeaderData(SearchSortModel::LEECHES, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
-
-    m_proxyModel = new SearchSortModel(this);
-    m_proxyModel->setDynamicSortFilter(true);
-    m_proxyModel->setSourceModel(m_searchListModel);
-    m_proxyModel->enableNameFilter(m_nameFilteringMode.get(NameFilteringMode::OnlyNames) == NameFilteringMode::OnlyNames);
-    m_proxyModel->setSeedsFilter(m_ui->minSeeds->value(), m_ui->maxSeeds->value());
-    m_proxyModel->setSizeFilter(sizeInBytes(m_ui->minSize->value(), static_cast<SizeUnit>(m_ui->minSizeUnit->currentIndex()))
-        , sizeInBytes(m_ui->maxSize->value(), static_cast<SizeUnit>(m_ui->maxSizeUnit->currentIndex())));
+    m_searchListModel->setHeaderData(SIZE, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
+    m_searchListModel->setHeaderData(SEEDS, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
+    m_searchListModel->setHeaderData(LEECHES, Qt::Horizontal, QVariant(Qt::AlignRight | Qt::AlignVCenter), Qt::TextAlignmentRole);
 
-    updateResultsCount();
+    m_ui->resultsBrowser->setModel(m_searchListModel);
 
-    m_ui->resultsBrowser->setModel(m_proxyModel);
-
-    m_ui->resultsBrowser->hideColumn(SearchSortModel::DL_LINK); // Hide url column
-    m_ui->resultsBrowser->hideColumn(SearchSortModel::DESC_LINK);
+    m_ui->resultsBrowser->hideColumn(DL_LINK); // Hide url column
+    m_ui->resultsBrowser->hideColumn(DESC_LINK);
 
     m_ui->resultsBrowser->setSelectionMode(QAbstractItemView::ExtendedSelection);
     m_ui->resultsBrowser->setRootIsDecorated(false);
     m_ui->resultsBrowser->setAllColumnsShowFocus(true);
-    m_ui->resultsBrowser->setSortingEnabled(true);
     m_ui->resultsBrowser->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    // Results are sorted by the result store so the view only tracks the sort indicator
+    header()->setSectionsClickable(true);
+    header()->setSortIndicatorShown(true);
 
     // Ensure that at least one column is visible at all times
     bool atLeastOne = false;
-    for (int i = 0; i < SearchSortModel::DL_LINK; ++i)
+    for (int i = 0; i < DL_LINK; ++i)
     {
         if (!m_ui->resultsBrowser->isColumnHidden(i))
         {
@@ -149,11 +194,11 @@ SearchJobWidget::SearchJobWidget(const QString &id, IGUIApplication *app, QWidge
         }
     }
     if (!atLeastOne)
-        m_ui->resultsBrowser->setColumnHidden(SearchSortModel::NAME, false);
+        m_ui->resultsBrowser->setColumnHidden(NAME, false);
     // To also mitigate the above issue, we have to resize each column when
     // its size is 0, because explicitly 'showing' the column isn't enough
     // in the above scenario.
-    for (int i = 0; i < SearchSortModel::DL_LINK; ++i)
+    for (int i = 0; i < DL_LINK; ++i)
     {
         if ((m_ui->resultsBrowser->columnWidth(i) <= 0) && !m_ui->resultsBrowser->isColumnHidden(i))
             m_ui->resultsBrowser->resizeColumnToContents(i);
@@ -164,29 +209,28 @@ SearchJobWidget::SearchJobWidget(const QString &id, IGUIApplication *app, QWidge
     connect(header(), &QHeaderView::sectionResized, this, &SearchJobWidget::saveSettings);
     connect(header(), &QHeaderView::sectionMoved, this, &SearchJobWidget::saveSettings);
     connect(header(), &QHeaderView::sortIndicatorChanged, this, &SearchJobWidget::saveSettings);
+    connect(header(), &QHeaderView::sortIndicatorChanged, this, &SearchJobWidget::updateResults);
 
     m_lineEditSearchResultsFilter = new LineEdit(this);
     m_lineEditSearchResultsFilter->setPlaceholderText(tr("Filter search results..."));
     m_lineEditSearchResultsFilter->setContextMenuPolicy(Qt::CustomContextMenu);
     connect(m_lineEditSearchResultsFilter, &QWidget::customContextMenuRequested, this, &SearchJobWidget::showFilterContextMenu);
-    connect(m_lineEditSearchResultsFilter, &LineEdit::textChanged, this, &SearchJobWidget::filterSearchResults);
+    connect(m_lineEditSearchResultsFilter, &LineEdit::textChanged, this, &SearchJobWidget::updateResults);
     m_ui->horizontalLayout->insertWidget(0, m_lineEditSearchResultsFilter);
 
     connect(m_ui->filterMode, qOverload<int>(&QComboBox::currentIndexChanged), this, &SearchJobWidget::updateNameFilter);
-    connect(m_ui->minSeeds, &QAbstractSpinBox::editingFinished, this, &SearchJobWidget::updateSeedsFilter);
-    connect(m_ui->minSeeds, qOverload<int>(&QSpinBox::valueChanged), this, &SearchJobWidget::updateSeedsFilter);
-    connect(m_ui->maxSeeds, &QAbstractSpinBox::editingFinished, this, &SearchJobWidget::updateSeedsFilter);
-    connect(m_ui->maxSeeds, qOverload<int>(&QSpinBox::valueChanged), this, &SearchJobWidget::updateSeedsFilter);
-    connect(m_ui->minSize, &QAbstractSpinBox::editingFinished, this, &SearchJobWidget::updateSizeFilter);
-    connect(m_ui->minSize, qOverload<double>(&QDoubleSpinBox::valueChanged), this, &SearchJobWidget::updateSizeFilter);
-    connect(m_ui->maxSize, &QAbstractSpinBox::editingFinished, this, &SearchJobWidget::updateSizeFilter);
-    connect(m_ui->maxSize, qOverload<double>(&QDoubleSpinBox::valueChanged), this, &SearchJobWidget::updateSizeFilter);
-    connect(m_ui->minSizeUnit, qOverload<int>(&QComboBox::currentIndexChanged), this, &SearchJobWidget::updateSizeFilter);
-    connect(m_ui->maxSizeUnit, qOverload<int>(&QComboBox::currentIndexChanged), this, &SearchJobWidget::updateSizeFilter);
+    connect(m_ui->minSeeds, qOverload<int>(&QSpinBox::valueChanged), this, &SearchJobWidget::updateResults);
+    connect(m_ui->maxSeeds, qOverload<int>(&QSpinBox::valueChanged), this, &SearchJobWidget::updateResults);
+    connect(m_ui->minSize, qOverload<double>(&QDoubleSpinBox::valueChanged), this, &SearchJobWidget::updateResults);
+    connect(m_ui->maxSize, qOverload<double>(&QDoubleSpinBox::valueChanged), this, &SearchJobWidget::updateResults);
+    connect(m_ui->minSizeUnit, qOverload<int>(&QComboBox::currentIndexChanged), this, &SearchJobWidget::updateResults);
+    connect(m_ui->maxSizeUnit, qOverload<int>(&QComboBox::currentIndexChanged), this, &SearchJobWidget::updateResults);
 
     connect(m_ui->resultsBrowser, &QAbstractItemView::doubleClicked, this, &SearchJobWidget::onItemDoubleClicked);
 
     connect(UIThemeManager::instance(), &UIThemeManager::themeChanged, this, &SearchJobWidget::onUIThemeChanged);
+
+    updateResults();
 }
 
 SearchJobWidget::SearchJobWidget(const QString &id, const QString &searchPattern
@@ -194,9 +238,9 @@ SearchJobWidget::SearchJobWidget(const QString &id, const QString &searchPattern
     : SearchJobWidget(id, app, parent)
 {
     m_searchPattern = searchPattern;
-    m_proxyModel->setNameFilter(m_searchPattern);
+    m_resultStore->append(searchResults);
 
-    appendSearchResults(searchResults);
+    updateResults();
 }
 
 SearchJobWidget::SearchJobWidget(const QString &id, SearchHandler *searchHandler, IGUIApplication *app, QWidget *parent)
@@ -223,7 +267,7 @@ QString SearchJobWidget::searchPattern() const
 
 QList<SearchResult> SearchJobWidget::searchResults() const
 {
-    return m_searchResults;
+    return resultStore().results();
 }
 
 void SearchJobWidget::onItemDoubleClicked(const QModelIndex &index)
@@ -239,33 +283,23 @@ QHeaderView *SearchJobWidget::header() const
 // Set the color of a row in data model
 void SearchJobWidget::setRowColor(int row, const QColor &color)
 {
-    for (int i = 0; i < m_proxyModel->columnCount(); ++i)
-        m_proxyModel->setData(m_proxyModel->index(row, i), color, Qt::ForegroundRole);
+    for (int i = 0; i < m_searchListModel->columnCount(); ++i)
+        m_searchListModel->setData(m_searchListModel->index(row, i), color, Qt::ForegroundRole);
 }
 
 void SearchJobWidget::setRowVisited(const int row)
 {
-    m_proxyModel->setDynamicSortFilter(false);
-
-    m_proxyModel->setData(m_proxyModel->index(row, 0), true, LinkVisitedRole);
+    m_visitedResults.insert(m_searchListModel->index(row, DL_LINK).data().toString());
     setRowColor(row, visitedRowColor());
-
-    m_proxyModel->setDynamicSortFilter(true);
 }
 
 void SearchJobWidget::onUIThemeChanged()
 {
-    m_proxyModel->setDynamicSortFilter(false);
-
-    for (int row = 0; row < m_proxyModel->rowCount(); ++row)
+    for (int row = 0; row < m_searchListModel->rowCount(); ++row)
     {
-        const QVariant userData = m_proxyModel->data(m_proxyModel->index(row, 0), LinkVisitedRole);
-        const bool isVisited = userData.toBool();
-        if (isVisited)
+        if (m_visitedResults.contains(m_searchListModel->index(row, DL_LINK).data().toString()))
             setRowColor(row, visitedRowColor());
     }
-
-    m_proxyModel->setDynamicSortFilter(true);
 }
 
 SearchJobWidget::Status SearchJobWidget::status() const
@@ -275,7 +309,7 @@ SearchJobWidget::Status SearchJobWidget::status() const
 
 int SearchJobWidget::visibleResultsCount() const
 {
-    return m_proxyModel->rowCount();
+    return m_searchListModel->rowCount();
 }
 
 LineEdit *SearchJobWidget::lineEditSearchResultsFilter() const
@@ -289,21 +323,19 @@ void SearchJobWidget::assignSearchHandler(SearchHandler *searchHandler)
     if (!searchHandler) [[unlikely]]
         return;
 
-    m_searchResults.clear();
-    m_searchListModel->removeRows(0, m_searchListModel->rowCount());
+    m_resultStore.reset();
+    m_visitedResults.clear();
     delete m_searchHandler;
 
     m_searchHandler = searchHandler;
     m_searchHandler->setParent(this);
-    connect(m_searchHandler, &SearchHandler::newSearchResults, this, &SearchJobWidget::appendSearchResults);
+    connect(m_searchHandler, &SearchHandler::resultsUpdated, this, &SearchJobWidget::updateResults);
     connect(m_searchHandler, &SearchHandler::searchFinished, this, &SearchJobWidget::searchFinished);
     connect(m_searchHandler, &SearchHandler::searchFailed, this, &SearchJobWidget::searchFailed);
 
     m_searchPattern = m_searchHandler->pattern();
 
-    m_proxyModel->setNameFilter(m_searchPattern);
-
-    updateResultsCount();
+    updateResults();
     setStatus(Status::Ongoing);
 }
 
@@ -331,8 +363,8 @@ void SearchJobWidget::openTorrentPages()
     QString warningEntryName;
     for (const QModelIndex &rowIndex : rows)
     {
-        const QString entryName = m_proxyModel->index(rowIndex.row(), SearchSortModel::NAME).data().toString();
-        const QString descrLink = m_proxyModel->index(rowIndex.row(), SearchSortModel::DESC_LINK).data().toString();
+        const QString entryName = m_searchListModel->index(rowIndex.row(), NAME).data().toString();
+        const QString descrLink = m_searchListModel->index(rowIndex.row(), DESC_LINK).data().toString();
 
         const QUrl descrLinkURL {descrLink};
         if (descrLinkURL.isEmpty()) [[unlikely]]
@@ -374,17 +406,17 @@ void SearchJobWidget::openTorrentPages()
 
 void SearchJobWidget::copyTorrentURLs() const
 {
-    copyField(SearchSortModel::DESC_LINK);
+    copyField(DESC_LINK);
 }
 
 void SearchJobWidget::copyTorrentDownloadLinks() const
 {
-    copyField(SearchSortModel::DL_LINK);
+    copyField(DL_LINK);
 }
 
 void SearchJobWidget::copyTorrentNames() const
 {
-    copyField(SearchSortModel::NAME);
+    copyField(NAME);
 }
 
 void SearchJobWidget::copyField(const int column) const
@@ -394,8 +426,8 @@ void SearchJobWidget::copyField(const int column) const
 
     for (const QModelIndex &rowIndex : rows)
     {
-        const QString field = m_proxyModel->data(
-            m_proxyModel->index(rowIndex.row(), column)).toString();
+        const QString field = m_searchListModel->data(
+            m_searchListModel->index(rowIndex.row(), column)).toString();
         if (!field.isEmpty())
             list << field;
     }
@@ -416,10 +448,10 @@ void SearchJobWidget::setStatus(const Status value)
 
 void SearchJobWidget::downloadTorrent(const QModelIndex &rowIndex, const AddTorrentOption option)
 {
-    const QString torrentUrl = m_proxyModel->data(
-                m_proxyModel->index(rowIndex.row(), SearchSortModel::DL_LINK)).toString();
-    const QString engineName = m_proxyModel->data(
-                m_proxyModel->index(rowIndex.row(), SearchSortModel::ENGINE_NAME)).toString();
+    const QString torrentUrl = m_searchListModel->data(
+                m_searchListModel->index(rowIndex.row(), DL_LINK)).toString();
+    const QString engineName = m_searchListModel->data(
+                m_searchListModel->index(rowIndex.row(), ENGINE_NAME)).toString();
 
     if (torrentUrl.startsWith(u"magnet:", Qt::CaseInsensitive))
     {
@@ -444,41 +476,11 @@ void SearchJobWidget::addTorrentToSession(const QString &source, const AddTorren
     app()->addTorrentManager()->addTorrent(source, {}, option);
 }
 
-void SearchJobWidget::updateResultsCount()
-{
-    const int totalResults = m_searchListModel->rowCount();
-    const int filteredResults = m_proxyModel->rowCount();
-    m_ui->resultsLbl->setText(tr("Results (showing <i>%1</i> out of <i>%2</i>):", "i.e: Search results")
-                              .arg(filteredResults).arg(totalResults));
-
-    m_noSearchResults = (totalResults == 0);
-    emit resultsCountUpdated();
-}
-
 void SearchJobWidget::updateNameFilter()
 {
-    const auto filteringMode = static_cast<NameFilteringMode>(m_ui->filterMode->itemData(m_ui->filterMode->currentIndex()).toInt());
-    m_proxyModel->enableNameFilter(filteringMode == NameFilteringMode::OnlyNames);
-    m_nameFilteringMode = filteringMode;
-
-    updateResultsCount();
-}
-
-void SearchJobWidget::updateSeedsFilter()
-{
-    // we update size and seeds filter parameters in the model even if they are disabled
-    m_proxyModel->setSeedsFilter(m_ui->minSeeds->value(), m_ui->maxSeeds->value());
+    m_nameFilteringMode = static_cast<NameFilteringMode>(m_ui->filterMode->itemData(m_ui->filterMode->currentIndex()).toInt());
 
-    updateResultsCount();
-}
-
-void SearchJobWidget::updateSizeFilter()
-{
-    // we update size and seeds filter parameters in the model even if they are disabled
-    m_proxyModel->setSizeFilter(sizeInBytes(m_ui->minSize->value(), static_cast<SizeUnit>(m_ui->minSizeUnit->currentIndex()))
-        , sizeInBytes(m_ui->maxSize->value(), static_cast<SizeUnit>(m_ui->maxSizeUnit->currentIndex())));
-
-    updateResultsCount();
+    updateResults();
 }
 
 void SearchJobWidget::fillFilterComboBoxes()
@@ -514,14 +516,6 @@ void SearchJobWidget::fillFilterComboBoxes()
     m_ui->filterMode->setCurrentIndex((index == -1) ? 0 : index);
 }
 
-void SearchJobWidget::filterSearchResults(const QString &name)
-{
-    const QString pattern = (Preferences::instance()->getRegexAsFilteringPatternForSearchJob()
-        ? name : Utils::String::wildcardToRegexPattern(name));
-    m_proxyModel->setFilterRegularExpression(QRegularExpression(pattern, QRegularExpression::CaseInsensitiveOption));
-    updateResultsCount();
-}
-
 void SearchJobWidget::showFilterContextMenu()
 {
     const Preferences *pref = Preferences::instance();
@@ -534,7 +528,7 @@ void SearchJobWidget::showFilterContextMenu()
     useRegexAct->setCheckable(true);
     useRegexAct->setChecked(pref->getRegexAsFilteringPatternForSearchJob());
     connect(useRegexAct, &QAction::toggled, pref, &Preferences::setRegexAsFilteringPatternForSearchJob);
-    connect(useRegexAct, &QAction::toggled, this, [this]() { filterSearchResults(m_lineEditSearchResultsFilter->text()); });
+    connect(useRegexAct, &QAction::toggled, this, &SearchJobWidget::updateResults);
 
     menu->popup(QCursor::pos());
 }
@@ -594,7 +588,7 @@ void SearchJobWidget::displayColumnHeaderMenu()
     menu->setTitle(tr("Column visibility"));
     menu->setToolTipsVisible(true);
 
-    for (int i = 0; i < SearchSortModel::DL_LINK; ++i)
+    for (int i = 0; i < DL_LINK; ++i)
     {
         const auto columnName = m_searchListModel->headerData(i, Qt::Horizontal, Qt::DisplayRole).toString();
         QAction *action = menu->addAction(columnName, this, [this, i](const bool checked)
@@ -643,39 +637,79 @@ void SearchJobWidget::searchFailed([[maybe_unused]] const QString &errorMessage)
     setStatus(Status::Error);
 }
 
-void SearchJobWidget::appendSearchResults(const QList<SearchResult> &results)
+const SearchResultStore &SearchJobWidget::resultStore() const
 {
-    for (const SearchResult &result : results)
+    return m_searchHandler ? m_searchHandler->resultStore() : *m_resultStore;
+}
+
+void SearchJobWidget::updateResults()
+{
+    const auto filteringMode = static_cast<NameFilteringMode>(m_ui->filterMode->itemData(m_ui->filterMode->currentIndex()).toInt());
+    const QString filterText = m_lineEditSearchResultsFilter->text();
+    const QString filterPattern = (Preferences::instance()->getRegexAsFilteringPatternForSearchJob()
+        ? filterText : Utils::String::wildcardToRegexPattern(filterText));
+    const SearchResultStore::Query query
+    {
+        .sortColumn = toSortColumn(header()->sortIndicatorSection()),
+        .sortDescending = (header()->sortIndicatorOrder() == Qt::DescendingOrder),
+        .nameTerms = ((filteringMode == NameFilteringMode::OnlyNames) ? searchTermWords(m_searchPattern) : QStringList()),
+        .namePattern = QRegularExpression(filterPattern, QRegularExpression::CaseInsensitiveOption),
+        .minSize = filterLimit(sizeInBytes(m_ui->minSize->value(), static_cast<SizeUnit>(m_ui->minSizeUnit->currentIndex()))),
+        .maxSize = filterLimit(sizeInBytes(m_ui->maxSize->value(), static_cast<SizeUnit>(m_ui->maxSizeUnit->currentIndex()))),
+        .minSeeders = filterLimit(m_ui->minSeeds->value()),
+        .maxSeeders = filterLimit(m_ui->maxSeeds->value())
+    };
+    const SearchResultStore::QueryResult queryResult = resultStore().query(query);
+
+    // Rows are recreated in the new order so the selection is restored by download link
+    const QModelIndexList selectedRows = m_ui->resultsBrowser->selectionModel()->selectedRows(DL_LINK);
+    QSet<QString> selectedLinks;
+    for (const QModelIndex &index : selectedRows)
+        selectedLinks.insert(index.data().toString());
+
+    m_searchListModel->removeRows(0, m_searchListModel->rowCount());
+    m_searchListModel->setRowCount(queryResult.results.size());
+
+    QItemSelection selection;
+    for (int row = 0; row < queryResult.results.size(); ++row)
     {
-        // Add item to search result list
-        int row = m_searchListModel->rowCount();
-        m_searchListModel->insertRow(row);
+        const SearchResult &result = queryResult.results[row];
 
-        const auto setModelData = [this, row] (const int column, const QString &displayData
-                , const QVariant &underlyingData, const Qt::Alignment textAlignmentData = {})
+        const auto setModelData = [this, row] (const int column, const QString &displayData, const Qt::Alignment textAlignmentData = {})
         {
             const QMap<int, QVariant> data =
             {
                 {Qt::DisplayRole, displayData},
-                {SearchSortModel::UnderlyingDataRole, underlyingData},
                 {Qt::TextAlignmentRole, QVariant {textAlignmentData}}
             };
             m_searchListModel->setItemData(m_searchListModel->index(row, column), data);
         };
 
-        setModelData(SearchSortModel::NAME, result.fileName, result.fileName);
-        setModelData(SearchSortModel::DL_LINK, result.fileUrl, result.fileUrl);
-        setModelData(SearchSortModel::ENGINE_NAME, result.engineName, result.engineName);
-        setModelData(SearchSortModel::ENGINE_URL, result.siteUrl, result.siteUrl);
-        setModelData(SearchSortModel::DESC_LINK, result.descrLink, result.descrLink);
-        setModelData(SearchSortModel::SIZE, Utils::Misc::friendlyUnit(result.fileSize), result.fileSize, (Qt::AlignRight | Qt::AlignVCenter));
-        setModelData(SearchSortModel::SEEDS, QString::number(result.nbSeeders), result.nbSeeders, (Qt::AlignRight | Qt::AlignVCenter));
-        setModelData(SearchSortModel::LEECHES, QString::number(result.nbLeechers), result.nbLeechers, (Qt::AlignRight | Qt::AlignVCenter));
-        setModelData(SearchSortModel::PUB_DATE, QLocale().toString(result.pubDate.toLocalTime(), QLocale::ShortFormat), result.pubDate);
+        setModelData(NAME, result.fileName);
+        setModelData(DL_LINK, result.fileUrl);
+        setModelData(ENGINE_NAME, result.engineName);
+        setModelData(ENGINE_URL, result.siteUrl);
+        setModelData(DESC_LINK, result.descrLink);
+        setModelData(SIZE, Utils::Misc::friendlyUnit(result.fileSize), (Qt::AlignRight | Qt::AlignVCenter));
+        setModelData(SEEDS, QString::number(result.nbSeeders), (Qt::AlignRight | Qt::AlignVCenter));
+        setModelData(LEECHES, QString::number(result.nbLeechers), (Qt::AlignRight | Qt::AlignVCenter));
+        setModelData(PUB_DATE, QLocale().toString(result.pubDate.toLocalTime(), QLocale::ShortFormat));
+
+        if (m_visitedResults.contains(result.fileUrl))
+            setRowColor(row, visitedRowColor());
+        if (selectedLinks.contains(result.fileUrl))
+            selection.select(m_searchListModel->index(row, 0), m_searchListModel->index(row, (NB_SEARCH_COLUMNS - 1)));
     }
 
-    m_searchResults.append(results);
-    updateResultsCount();
+    if (!selection.isEmpty())
+        m_ui->resultsBrowser->selectionModel()->select(selection, QItemSelectionModel::Select);
+
+    const qsizetype totalResults = resultStore().size();
+    m_ui->resultsLbl->setText(tr("Results (showing <i>%1</i> out of <i>%2</i>):", "i.e: Search results")
+                              .arg(queryResult.matchedCount).arg(totalResults));
+
+    m_noSearchResults = (totalResults == 0);
+    emit resultsCountUpdated();
 }
 
 void SearchJobWidget::keyPressEvent(QKeyEvent *event)
@@ -29,6 +29,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QSet>
 #include <QWidget>
 
 #include "base/settingvalue.h"
@@ -44,7 +47,7 @@ class QStandardItemModel;
 
 class LineEdit;
 class SearchHandler;
-class SearchSortModel;
+class SearchResultStore;
 struct SearchResult;
 
 template <typename T> class SettingValue;
@@ -107,16 +110,13 @@ private:
     void loadSettings();
     void saveSettings() const;
     void updateNameFilter();
-    void updateSeedsFilter();
-    void updateSizeFilter();
-    void filterSearchResults(const QString &name);
     void showFilterContextMenu();
     void contextMenuEvent(QContextMenuEvent *event) override;
     void onItemDoubleClicked(const QModelIndex &index);
     void searchFinished(bool cancelled);
     void searchFailed(const QString &errorMessage);
-    void appendSearchResults(const QList<SearchResult> &results);
-    void updateResultsCount();
+    const SearchResultStore &resultStore() const;
+    void updateResults();
     void setStatus(Status value);
     void downloadTorrent(const QModelIndex &rowIndex, AddTorrentOption option = AddTorrentOption::Default);
     void addTorrentToSession(const QString &source, AddTorrentOption option = AddTorrentOption::Default);
@@ -138,11 +138,12 @@ private:
 
     QString m_id;
     QString m_searchPattern;
-    QList<SearchResult> m_searchResults;
+    // Holds the results restored from previous session, until the search is refreshed
+    std::unique_ptr<SearchResultStore> m_resultStore;
+    QSet<QString> m_visitedResults;
     Ui::SearchJobWidget *m_ui = nullptr;
     SearchHandler *m_searchHandler = nullptr;
     QStandardItemModel *m_searchListModel = nullptr;
-    SearchSortModel *m_proxyModel = nullptr;
     LineEdit *m_lineEditSearchResultsFilter = nullptr;
     Status m_status = Status::Ready;
     bool m_noSearchResults = true;
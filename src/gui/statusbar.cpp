@@ -163,7 +163,6 @@ StatusBar::StatusBar(QWidget *parent)
     m_DHTLbl->setVisible(isDHTVisible);
     m_DHTSeparator->setVisible(isDHTVisible);
     refresh();
-    connect(session, &BitTorrent::Session::statsUpdated, this, &StatusBar::refresh);
 
     updateFreeDiskSpaceLabel(session->freeDiskSpace());
     connect(session, &BitTorrent::Session::freeDiskSpaceChecked, this, &StatusBar::updateFreeDiskSpaceLabel);
@@ -192,6 +191,14 @@ void StatusBar::showRestartRequired()
     insertWidget(1, restartLbl);
 }
 
+void StatusBar::showAddTorrentsProgress(const int processedCount, const int totalCount)
+{
+    if (processedCount < totalCount)
+        showMessage(tr("Adding torrents: %1/%2").arg(processedCount).arg(totalCount));
+    else
+        clearMessage();
+}
+
 void StatusBar::updateConnectionStatus()
 {
     const BitTorrent::SessionStatus &sessionStatus = BitTorrent::Session::instance()->status();
@@ -53,9 +53,10 @@ signals:
 
 public slots:
     void showRestartRequired();
+    void showAddTorrentsProgress(int processedCount, int totalCount);
+    void refresh();
 
 private slots:
-    void refresh();
     void updateAltSpeedsBtn(bool alternative);
     void capSpeed();
     void optionsSaved();
@@ -142,8 +142,9 @@ void TorrentCategoryDialog::setCategoryName(const QString &categoryName)
 
 BitTorrent::CategoryOptions TorrentCategoryDialog::categoryOptions() const
 {
-    BitTorrent::CategoryOptions categoryOptions;
+    BitTorrent::CategoryOptions categoryOptions = m_categoryOptions;
     categoryOptions.savePath = m_ui->comboSavePath->selectedPath();
+    categoryOptions.downloadPath.reset();
     if (m_ui->comboUseDownloadPath->currentIndex() == 1)
         categoryOptions.downloadPath = {true, m_ui->comboDownloadPath->selectedPath()};
     else if (m_ui->comboUseDownloadPath->currentIndex() == 2)
@@ -154,6 +155,7 @@ BitTorrent::CategoryOptions TorrentCategoryDialog::categoryOptions() const
 
 void TorrentCategoryDialog::setCategoryOptions(const BitTorrent::CategoryOptions &categoryOptions)
 {
+    m_categoryOptions = categoryOptions;
     m_ui->comboSavePath->setSelectedPath(categoryOptions.savePath);
     if (categoryOptions.downloadPath)
     {
@@ -30,13 +30,9 @@
 
 #include <QDialog>
 
+#include "base/bittorrent/categoryoptions.h"
 #include "base/path.h"
 
-namespace BitTorrent
-{
-    struct CategoryOptions;
-}
-
 namespace Ui
 {
     class TorrentCategoryDialog;
@@ -67,4 +63,6 @@ private slots:
 private:
     Ui::TorrentCategoryDialog *m_ui = nullptr;
     Path m_lastEnteredDownloadPath;
+    // keeps the options that aren't editable in the dialog
+    BitTorrent::CategoryOptions m_categoryOptions;
 };
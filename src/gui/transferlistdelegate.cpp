@@ -86,7 +86,7 @@ void TransferListDelegate::paint(QPainter *painter, const QStyleOptionViewItem &
             QStyleOptionViewItem customOption {option};
             customOption.state.setFlag(QStyle::State_Enabled, isEnableState(torrentState));
 
-            const QColor color = Preferences::instance()->getProgressBarFollowsTextColor() ? index.data(Qt::ForegroundRole).value<QColor>() : QColor();
+            const QColor color = Preferences::instance()->snapshot().progressBarFollowsTextColor ? index.data(Qt::ForegroundRole).value<QColor>() : QColor();
 
             m_progressBarPainter.paint(painter, customOption, index.data().toString(), progress, color);
         }
@@ -36,6 +36,7 @@
 #include "base/global.h"
 #include "base/preferences.h"
 #include "base/torrentfilter.h"
+#include "base/torrentfilterindex.h"
 #include "gui/transferlistwidget.h"
 #include "gui/uithememanager.h"
 
@@ -86,10 +87,9 @@ StatusFilterWidget::StatusFilterWidget(QWidget *parent, TransferListWidget *tran
     errored->setData(Qt::DisplayRole, tr("Errored (0)"));
     errored->setData(Qt::DecorationRole, UIThemeManager::instance()->getIcon(u"error"_s));
 
-    const QList<BitTorrent::Torrent *> torrents = BitTorrent::Session::instance()->torrents();
-    update(torrents);
-    connect(BitTorrent::Session::instance(), &BitTorrent::Session::torrentsUpdated
-            , this, &StatusFilterWidget::update);
+    updateCounters();
+    connect(BitTorrent::Session::instance()->torrentFilterIndex(), &TorrentFilterIndex::statesUpdated
+            , this, &StatusFilterWidget::updateCounters);
 
     const Preferences *const pref = Preferences::instance();
     connect(pref, &Preferences::changed, this, &StatusFilterWidget::configure);
@@ -124,89 +124,40 @@ QSize StatusFilterWidget::sizeHint() const
         static_cast<int>((sizeHintForRow(0) + 2 * spacing()) * (numVisibleItems + 0.5))};
 }
 
-void StatusFilterWidget::updateTorrentStatus(const BitTorrent::Torrent *torrent)
-{
-    TorrentFilterBitset &torrentStatus = m_torrentsStatus[torrent];
-
-    const auto update = [torrent, &torrentStatus](const TorrentFilter::Type status, int &counter)
-    {
-        const bool hasStatus = torrentStatus[status];
-        const bool needStatus = TorrentFilter(status).match(torrent);
-        if (needStatus && !hasStatus)
-        {
-            ++counter;
-            torrentStatus.set(status);
-        }
-        else if (!needStatus && hasStatus)
-        {
-            --counter;
-            torrentStatus.reset(status);
-        }
-    };
-
-    update(TorrentFilter::Downloading, m_nbDownloading);
-    update(TorrentFilter::Seeding, m_nbSeeding);
-    update(TorrentFilter::Completed, m_nbCompleted);
-    update(TorrentFilter::Running, m_nbRunning);
-    update(TorrentFilter::Stopped, m_nbStopped);
-    update(TorrentFilter::Active, m_nbActive);
-    update(TorrentFilter::Inactive, m_nbInactive);
-    update(TorrentFilter::StalledUploading, m_nbStalledUploading);
-    update(TorrentFilter::StalledDownloading, m_nbStalledDownloading);
-    update(TorrentFilter::Checking, m_nbChecking);
-    update(TorrentFilter::Moving, m_nbMoving);
-    update(TorrentFilter::Errored, m_nbErrored);
-
-    m_nbStalled = m_nbStalledUploading + m_nbStalledDownloading;
-}
-
 void StatusFilterWidget::updateTexts()
 {
-    const qsizetype torrentsCount = BitTorrent::Session::instance()->torrentsCount();
-    item(TorrentFilter::All)->setData(Qt::DisplayRole, tr("All (%1)").arg(torrentsCount));
-    item(TorrentFilter::Downloading)->setData(Qt::DisplayRole, tr("Downloading (%1)").arg(m_nbDownloading));
-    item(TorrentFilter::Seeding)->setData(Qt::DisplayRole, tr("Seeding (%1)").arg(m_nbSeeding));
-    item(TorrentFilter::Completed)->setData(Qt::DisplayRole, tr("Completed (%1)").arg(m_nbCompleted));
-    item(TorrentFilter::Running)->setData(Qt::DisplayRole, tr("Running (%1)").arg(m_nbRunning));
-    item(TorrentFilter::Stopped)->setData(Qt::DisplayRole, tr("Stopped (%1)").arg(m_nbStopped));
-    item(TorrentFilter::Active)->setData(Qt::DisplayRole, tr("Active (%1)").arg(m_nbActive));
-    item(TorrentFilter::Inactive)->setData(Qt::DisplayRole, tr("Inactive (%1)").arg(m_nbInactive));
-    item(TorrentFilter::Stalled)->setData(Qt::DisplayRole, tr("Stalled (%1)").arg(m_nbStalled));
-    item(TorrentFilter::StalledUploading)->setData(Qt::DisplayRole, tr("Stalled Uploading (%1)").arg(m_nbStalledUploading));
-    item(TorrentFilter::StalledDownloading)->setData(Qt::DisplayRole, tr("Stalled Downloading (%1)").arg(m_nbStalledDownloading));
-    item(TorrentFilter::Checking)->setData(Qt::DisplayRole, tr("Checking (%1)").arg(m_nbChecking));
-    item(TorrentFilter::Moving)->setData(Qt::DisplayRole, tr("Moving (%1)").arg(m_nbMoving));
-    item(TorrentFilter::Errored)->setData(Qt::DisplayRole, tr("Errored (%1)").arg(m_nbErrored));
+    const TorrentFilterIndex *filterIndex = BitTorrent::Session::instance()->torrentFilterIndex();
+    item(TorrentFilter::All)->setData(Qt::DisplayRole, tr("All (%1)").arg(filterIndex->torrentsCount(TorrentFilter::All)));
+    item(TorrentFilter::Downloading)->setData(Qt::DisplayRole, tr("Downloading (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Downloading)));
+    item(TorrentFilter::Seeding)->setData(Qt::DisplayRole, tr("Seeding (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Seeding)));
+    item(TorrentFilter::Completed)->setData(Qt::DisplayRole, tr("Completed (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Completed)));
+    item(TorrentFilter::Running)->setData(Qt::DisplayRole, tr("Running (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Running)));
+    item(TorrentFilter::Stopped)->setData(Qt::DisplayRole, tr("Stopped (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Stopped)));
+    item(TorrentFilter::Active)->setData(Qt::DisplayRole, tr("Active (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Active)));
+    item(TorrentFilter::Inactive)->setData(Qt::DisplayRole, tr("Inactive (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Inactive)));
+    item(TorrentFilter::Stalled)->setData(Qt::DisplayRole, tr("Stalled (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Stalled)));
+    item(TorrentFilter::StalledUploading)->setData(Qt::DisplayRole, tr("Stalled Uploading (%1)").arg(filterIndex->torrentsCount(TorrentFilter::StalledUploading)));
+    item(TorrentFilter::StalledDownloading)->setData(Qt::DisplayRole, tr("Stalled Downloading (%1)").arg(filterIndex->torrentsCount(TorrentFilter::StalledDownloading)));
+    item(TorrentFilter::Checking)->setData(Qt::DisplayRole, tr("Checking (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Checking)));
+    item(TorrentFilter::Moving)->setData(Qt::DisplayRole, tr("Moving (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Moving)));
+    item(TorrentFilter::Errored)->setData(Qt::DisplayRole, tr("Errored (%1)").arg(filterIndex->torrentsCount(TorrentFilter::Errored)));
 }
 
 void StatusFilterWidget::hideZeroItems()
 {
-    item(TorrentFilter::Downloading)->setHidden(m_nbDownloading == 0);
-    item(TorrentFilter::Seeding)->setHidden(m_nbSeeding == 0);
-    item(TorrentFilter::Completed)->setHidden(m_nbCompleted == 0);
-    item(TorrentFilter::Running)->setHidden(m_nbRunning == 0);
-    item(TorrentFilter::Stopped)->setHidden(m_nbStopped == 0);
-    item(TorrentFilter::Active)->setHidden(m_nbActive == 0);
-    item(TorrentFilter::Inactive)->setHidden(m_nbInactive == 0);
-    item(TorrentFilter::Stalled)->setHidden(m_nbStalled == 0);
-    item(TorrentFilter::StalledUploading)->setHidden(m_nbStalledUploading == 0);
-    item(TorrentFilter::StalledDownloading)->setHidden(m_nbStalledDownloading == 0);
-    item(TorrentFilter::Checking)->setHidden(m_nbChecking == 0);
-    item(TorrentFilter::Moving)->setHidden(m_nbMoving == 0);
-    item(TorrentFilter::Errored)->setHidden(m_nbErrored == 0);
+    const TorrentFilterIndex *filterIndex = BitTorrent::Session::instance()->torrentFilterIndex();
+    for (int type = TorrentFilter::Downloading; type < TorrentFilter::_Count; ++type)
+        item(type)->setHidden(filterIndex->torrentsCount(static_cast<TorrentFilter::Type>(type)) == 0);
 
     if (currentItem() && currentItem()->isHidden())
         setCurrentRow(TorrentFilter::All, QItemSelectionModel::SelectCurrent);
 }
 
-void StatusFilterWidget::update(const QList<BitTorrent::Torrent *> &torrents)
+void StatusFilterWidget::updateCounters()
 {
-    for (const BitTorrent::Torrent *torrent : torrents)
-        updateTorrentStatus(torrent);
-
     updateTexts();
 
-    if (Preferences::instance()->getHideZeroStatusFilters())
+    if (Preferences::instance()->snapshot().hideZeroStatusFilters)
     {
         hideZeroItems();
         updateGeometry();
@@ -233,54 +184,18 @@ void StatusFilterWidget::applyFilter(int row)
     transferList()->applyStatusFilter(row);
 }
 
-void StatusFilterWidget::handleTorrentsLoaded(const QList<BitTorrent::Torrent *> &torrents)
+void StatusFilterWidget::handleTorrentsLoaded([[maybe_unused]] const QList<BitTorrent::Torrent *> &torrents)
 {
-    update(torrents);
+    // torrent states are counted by TorrentFilterIndex which notifies about changes
 }
 
-void StatusFilterWidget::torrentAboutToBeDeleted(BitTorrent::Torrent *const torrent)
+void StatusFilterWidget::torrentAboutToBeDeleted([[maybe_unused]] BitTorrent::Torrent *const torrent)
 {
-    const TorrentFilterBitset status = m_torrentsStatus.take(torrent);
-
-    if (status[TorrentFilter::Downloading])
-        --m_nbDownloading;
-    if (status[TorrentFilter::Seeding])
-        --m_nbSeeding;
-    if (status[TorrentFilter::Completed])
-        --m_nbCompleted;
-    if (status[TorrentFilter::Running])
-        --m_nbRunning;
-    if (status[TorrentFilter::Stopped])
-        --m_nbStopped;
-    if (status[TorrentFilter::Active])
-        --m_nbActive;
-    if (status[TorrentFilter::Inactive])
-        --m_nbInactive;
-    if (status[TorrentFilter::StalledUploading])
-        --m_nbStalledUploading;
-    if (status[TorrentFilter::StalledDownloading])
-        --m_nbStalledDownloading;
-    if (status[TorrentFilter::Checking])
-        --m_nbChecking;
-    if (status[TorrentFilter::Moving])
-        --m_nbMoving;
-    if (status[TorrentFilter::Errored])
-        --m_nbErrored;
-
-    m_nbStalled = m_nbStalledUploading + m_nbStalledDownloading;
-
-    updateTexts();
-
-    if (Preferences::instance()->getHideZeroStatusFilters())
-    {
-        hideZeroItems();
-        updateGeometry();
-    }
 }
 
 void StatusFilterWidget::configure()
 {
-    if (Preferences::instance()->getHideZeroStatusFilters())
+    if (Preferences::instance()->snapshot().hideZeroStatusFilters)
     {
         hideZeroItems();
     }
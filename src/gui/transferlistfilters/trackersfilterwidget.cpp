@@ -36,10 +36,9 @@
 #include <QMessageBox>
 #include <QUrl>
 
-#include "base/algorithm.h"
 #include "base/bittorrent/session.h"
-#include "base/bittorrent/trackerentry.h"
 #include "base/bittorrent/trackerentrystatus.h"
+#include "base/bittorrent/trackerindex.h"
 #include "base/global.h"
 #include "base/net/downloadmanager.h"
 #include "base/preferences.h"
@@ -69,18 +68,6 @@ namespace
         return !scheme.isEmpty() ? scheme : u"http"_s;
     }
 
-    QString getHost(const QString &url)
-    {
-        // We want the hostname.
-        // If failed to parse the domain, original input should be returned
-
-        const QString host = QUrl(url).host();
-        if (host.isEmpty())
-            return url;
-
-        return host;
-    }
-
     QString getFaviconHost(const QString &trackerHost)
     {
         if (!QHostAddress(trackerHost).isNull())
@@ -89,6 +76,13 @@ namespace
         return trackerHost.section(u'.', -2, -1);
     }
 
+    QString getFaviconURL(const QString &trackerHost)
+    {
+        const QStringList trackers = BitTorrent::Session::instance()->trackerIndex()->trackersByHost(trackerHost);
+        const QString scheme = !trackers.isEmpty() ? getScheme(trackers.first()) : u"http"_s;
+        return u"%1://%2/favicon.ico"_s.arg((scheme.startsWith(u"http") ? scheme : u"http"_s), getFaviconHost(trackerHost));
+    }
+
     QString getFormatStringForRow(const int row)
     {
         switch (row)
@@ -141,8 +135,16 @@ TrackersFilterWidget::TrackersFilterWidget(QWidget *parent, TransferListWidget *
     warningItem->setData(Qt::DisplayRole, formatItemText(WARNING_ROW, 0));
     warningItem->setData(Qt::DecorationRole, UIThemeManager::instance()->getIcon(u"tracker-warning"_s, u"dialog-warning"_s));
 
-    m_trackers[NULL_HOST] = {{}, trackerlessItem};
+    m_trackerItems[NULL_HOST] = trackerlessItem;
 
+    const BitTorrent::TrackerIndex *trackerIndex = BitTorrent::Session::instance()->trackerIndex();
+    connect(trackerIndex, &BitTorrent::TrackerIndex::hostsUpdated, this, &TrackersFilterWidget::handleHostsUpdated);
+    connect(trackerIndex, &BitTorrent::TrackerIndex::hostsRemoved, this, &TrackersFilterWidget::handleHostsRemoved);
+    connect(trackerIndex, &BitTorrent::TrackerIndex::problemsChanged, this, &TrackersFilterWidget::handleProblemsChanged);
+
+    const QStringList hosts = trackerIndex->hosts();
+    handleHostsUpdated({hosts.cbegin(), hosts.cend()});
+    handleProblemsChanged();
     handleTorrentsLoaded(BitTorrent::Session::instance()->torrents());
 
     setCurrentRow(0, QItemSelectionModel::SelectCurrent);
@@ -155,210 +157,82 @@ TrackersFilterWidget::~TrackersFilterWidget()
         Utils::Fs::removeFile(iconPath);
 }
 
-void TrackersFilterWidget::addTrackers(const BitTorrent::Torrent *torrent, const QList<BitTorrent::TrackerEntry> &trackers)
-{
-    const BitTorrent::TorrentID torrentID = torrent->id();
-
-    for (const BitTorrent::TrackerEntry &tracker : trackers)
-        addItems(tracker.url, {torrentID});
-
-    removeItem(NULL_HOST, torrentID);
-}
-
-void TrackersFilterWidget::removeTrackers(const BitTorrent::Torrent *torrent, const QStringList &trackers)
-{
-    const BitTorrent::TorrentID torrentID = torrent->id();
-
-    for (const QString &tracker : trackers)
-        removeItem(tracker, torrentID);
-
-    if (torrent->trackers().isEmpty())
-        addItems(NULL_HOST, {torrentID});
-}
-
-void TrackersFilterWidget::refreshTrackers(const BitTorrent::Torrent *torrent)
+void TrackersFilterWidget::handleHostsUpdated(const QSet<QString> &hosts)
 {
-    const BitTorrent::TorrentID torrentID = torrent->id();
-
-    m_errors.remove(torrentID);
-    m_trackerErrors.remove(torrentID);
-    m_warnings.remove(torrentID);
+    const BitTorrent::TrackerIndex *trackerIndex = BitTorrent::Session::instance()->trackerIndex();
+    QListWidgetItem *currentTrackerItem = currentItem();
+    bool isCurrentItemUpdated = false;
+    bool isItemInserted = false;
 
-    Algorithm::removeIf(m_trackers, [this, &torrentID](const QString &host, TrackerData &trackerData)
+    for (const QString &host : hosts)
     {
-        QSet<BitTorrent::TorrentID> &torrentIDs = trackerData.torrents;
-        if (!torrentIDs.remove(torrentID))
-            return false;
-
-        QListWidgetItem *trackerItem = trackerData.item;
-
-        if (!host.isEmpty() && torrentIDs.isEmpty())
+        const auto torrentsCount = static_cast<int>(trackerIndex->torrentsCountByHost(host));
+        QListWidgetItem *trackerItem = m_trackerItems.value(host);
+        if (trackerItem)
         {
-            if (currentItem() == trackerItem)
-                setCurrentRow(0, QItemSelectionModel::SelectCurrent);
-            delete trackerItem;
-            return true;
+            trackerItem->setText(formatItemText(host, torrentsCount));
+            if (trackerItem == currentTrackerItem)
+                isCurrentItemUpdated = true;
+            continue;
         }
 
-        trackerItem->setText(formatItemText(host, torrentIDs.size()));
-        return false;
-    });
-
-    const QList<BitTorrent::TrackerEntryStatus> trackers = torrent->trackers();
-    if (trackers.isEmpty())
-    {
-        addItems(NULL_HOST, {torrentID});
-    }
-    else
-    {
-        for (const BitTorrent::TrackerEntryStatus &status : trackers)
-            addItems(status.url, {torrentID});
-    }
+        trackerItem = new QListWidgetItem(formatItemText(host, torrentsCount));
+        trackerItem->setData(Qt::DecorationRole, UIThemeManager::instance()->getIcon(u"trackers"_s, u"network-server"_s));
+        m_trackerItems.insert(host, trackerItem);
 
-    item(OTHERERROR_ROW)->setText(formatItemText(OTHERERROR_ROW, m_errors.size()));
-    item(TRACKERERROR_ROW)->setText(formatItemText(TRACKERERROR_ROW, m_trackerErrors.size()));
-    item(WARNING_ROW)->setText(formatItemText(WARNING_ROW, m_warnings.size()));
+        Q_ASSERT(count() >= NUM_SPECIAL_ROWS);
+        const Utils::Compare::NaturalLessThan<Qt::CaseSensitive> naturalLessThan {};
+        int insPos = count();
+        for (int i = NUM_SPECIAL_ROWS; i < count(); ++i)
+        {
+            if (naturalLessThan(host, item(i)->text()))
+            {
+                insPos = i;
+                break;
+            }
+        }
+        QListWidget::insertItem(insPos, trackerItem);
+        isItemInserted = true;
 
-    if (const int row = currentRow(); (row == OTHERERROR_ROW)
-        || (row == TRACKERERROR_ROW) || (row == WARNING_ROW))
-    {
-        applyFilter(row);
+        downloadFavicon(host, getFaviconURL(host));
     }
 
-    updateGeometry();
+    if (isCurrentItemUpdated)
+        applyFilter(currentRow());
+    if (isItemInserted)
+        updateGeometry();
 }
 
-void TrackersFilterWidget::addItems(const QString &trackerURL, const QList<BitTorrent::TorrentID> &torrents)
+void TrackersFilterWidget::handleHostsRemoved(const QSet<QString> &hosts)
 {
-    const QString host = getHost(trackerURL);
-    auto trackersIt = m_trackers.find(host);
-    const bool exists = (trackersIt != m_trackers.end());
-    QListWidgetItem *trackerItem = nullptr;
-
-    if (exists)
-    {
-        trackerItem = trackersIt->item;
-    }
-    else
+    for (const QString &host : hosts)
     {
-        trackerItem = new QListWidgetItem();
-        trackerItem->setData(Qt::DecorationRole, UIThemeManager::instance()->getIcon(u"trackers"_s, u"network-server"_s));
-
-        const TrackerData trackerData {{}, trackerItem};
-        trackersIt = m_trackers.insert(host, trackerData);
-
-        const QString scheme = getScheme(trackerURL);
-        downloadFavicon(host, u"%1://%2/favicon.ico"_s.arg((scheme.startsWith(u"http") ? scheme : u"http"_s), getFaviconHost(host)));
-    }
-
-    Q_ASSERT(trackerItem);
-
-    QSet<BitTorrent::TorrentID> &torrentIDs = trackersIt->torrents;
-    for (const BitTorrent::TorrentID &torrentID : torrents)
-        torrentIDs.insert(torrentID);
+        QListWidgetItem *trackerItem = m_trackerItems.take(host);
+        if (!trackerItem)
+            continue;
 
-    trackerItem->setText(formatItemText(host, torrentIDs.size()));
-    if (exists)
-    {
-        if (item(currentRow()) == trackerItem)
-            applyFilter(currentRow());
-        return;
+        if (currentItem() == trackerItem)
+            setCurrentRow(0, QItemSelectionModel::SelectCurrent);
+        delete trackerItem;
     }
 
-    Q_ASSERT(count() >= NUM_SPECIAL_ROWS);
-    const Utils::Compare::NaturalLessThan<Qt::CaseSensitive> naturalLessThan {};
-    int insPos = count();
-    for (int i = NUM_SPECIAL_ROWS; i < count(); ++i)
-    {
-        if (naturalLessThan(host, item(i)->text()))
-        {
-            insPos = i;
-            break;
-        }
-    }
-    QListWidget::insertItem(insPos, trackerItem);
     updateGeometry();
 }
 
-void TrackersFilterWidget::removeItem(const QString &trackerURL, const BitTorrent::TorrentID &id)
+void TrackersFilterWidget::handleProblemsChanged()
 {
-    const QString host = getHost(trackerURL);
+    using Problem = BitTorrent::TrackerIndex::Problem;
 
-    QSet<BitTorrent::TorrentID> torrentIDs = m_trackers.value(host).torrents;
-    torrentIDs.remove(id);
+    const BitTorrent::TrackerIndex *trackerIndex = BitTorrent::Session::instance()->trackerIndex();
+    item(OTHERERROR_ROW)->setText(formatItemText(OTHERERROR_ROW, static_cast<int>(trackerIndex->torrentsWithProblemCount(Problem::Error))));
+    item(TRACKERERROR_ROW)->setText(formatItemText(TRACKERERROR_ROW, static_cast<int>(trackerIndex->torrentsWithProblemCount(Problem::TrackerError))));
+    item(WARNING_ROW)->setText(formatItemText(WARNING_ROW, static_cast<int>(trackerIndex->torrentsWithProblemCount(Problem::Warning))));
 
-    QListWidgetItem *trackerItem = nullptr;
-
-    if (!host.isEmpty())
-    {
-        // Remove from 'Error', 'Tracker error' and 'Warning' view
-        if (const auto errorHashesIt = m_errors.find(id)
-                ; errorHashesIt != m_errors.end())
-        {
-            QSet<QString> &errored = *errorHashesIt;
-            errored.remove(trackerURL);
-            if (errored.isEmpty())
-            {
-                m_errors.erase(errorHashesIt);
-                item(OTHERERROR_ROW)->setText(formatItemText(OTHERERROR_ROW, m_errors.size()));
-                if (currentRow() == OTHERERROR_ROW)
-                    applyFilter(OTHERERROR_ROW);
-            }
-        }
-
-        if (const auto trackerErrorHashesIt = m_trackerErrors.find(id)
-                ; trackerErrorHashesIt != m_trackerErrors.end())
-        {
-            QSet<QString> &errored = *trackerErrorHashesIt;
-            errored.remove(trackerURL);
-            if (errored.isEmpty())
-            {
-                m_trackerErrors.erase(trackerErrorHashesIt);
-                item(TRACKERERROR_ROW)->setText(formatItemText(TRACKERERROR_ROW, m_trackerErrors.size()));
-                if (currentRow() == TRACKERERROR_ROW)
-                    applyFilter(TRACKERERROR_ROW);
-            }
-        }
-
-        if (const auto warningHashesIt = m_warnings.find(id)
-                ; warningHashesIt != m_warnings.end())
-        {
-            QSet<QString> &warned = *warningHashesIt;
-            warned.remove(trackerURL);
-            if (warned.isEmpty())
-            {
-                m_warnings.erase(warningHashesIt);
-                item(WARNING_ROW)->setText(formatItemText(WARNING_ROW, m_warnings.size()));
-                if (currentRow() == WARNING_ROW)
-                    applyFilter(WARNING_ROW);
-            }
-        }
-
-        trackerItem = m_trackers.value(host).item;
-
-        if (torrentIDs.isEmpty())
-        {
-            if (currentItem() == trackerItem)
-                setCurrentRow(0, QItemSelectionModel::SelectCurrent);
-            delete trackerItem;
-            m_trackers.remove(host);
-            updateGeometry();
-            return;
-        }
-
-        if (trackerItem)
-            trackerItem->setText(u"%1 (%2)"_s.arg(host, QString::number(torrentIDs.size())));
-    }
-    else
+    if (const int row = currentRow(); (row == OTHERERROR_ROW)
+        || (row == TRACKERERROR_ROW) || (row == WARNING_ROW))
     {
-        trackerItem = item(TRACKERLESS_ROW);
-        trackerItem->setText(formatItemText(TRACKERLESS_ROW, torrentIDs.size()));
+        applyFilter(row);
     }
-
-    m_trackers.insert(host, {torrentIDs, trackerItem});
-
-    if (currentItem() == trackerItem)
-        applyFilter(currentRow());
 }
 
 void TrackersFilterWidget::setDownloadTrackerFavicon(bool value)
@@ -368,122 +242,15 @@ void TrackersFilterWidget::setDownloadTrackerFavicon(bool value)
 
     if (m_downloadTrackerFavicon)
     {
-        for (auto i = m_trackers.cbegin(); i != m_trackers.cend(); ++i)
+        for (auto i = m_trackerItems.cbegin(); i != m_trackerItems.cend(); ++i)
         {
             const QString &tracker = i.key();
             if (!tracker.isEmpty())
-            {
-                const QString scheme = getScheme(tracker);
-                downloadFavicon(tracker, u"%1://%2/favicon.ico"_s
-                        .arg((scheme.startsWith(u"http") ? scheme : u"http"_s), getFaviconHost(tracker)));
-             }
+                downloadFavicon(tracker, getFaviconURL(tracker));
         }
     }
 }
 
-void TrackersFilterWidget::handleTrackerStatusesUpdated(const BitTorrent::Torrent *torrent
-        , const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers)
-{
-    const BitTorrent::TorrentID id = torrent->id();
-
-    auto errorHashesIt = m_errors.find(id);
-    auto trackerErrorHashesIt = m_trackerErrors.find(id);
-    auto warningHashesIt = m_warnings.find(id);
-
-    for (const BitTorrent::TrackerEntryStatus &trackerEntryStatus : updatedTrackers)
-    {
-        switch (trackerEntryStatus.state)
-        {
-        case BitTorrent::TrackerEndpointState::Working:
-            {
-                // remove tracker from "error" and "tracker error" categories
-                if (errorHashesIt != m_errors.end())
-                    errorHashesIt->remove(trackerEntryStatus.url);
-                if (trackerErrorHashesIt != m_trackerErrors.end())
-                    trackerErrorHashesIt->remove(trackerEntryStatus.url);
-
-                const bool hasNoWarningMessages = std::ranges::all_of(trackerEntryStatus.endpoints
-                    , [](const BitTorrent::TrackerEndpointStatus &endpointEntry)
-                {
-                    return endpointEntry.message.isEmpty() || (endpointEntry.state != BitTorrent::TrackerEndpointState::Working);
-                });
-                if (hasNoWarningMessages)
-                {
-                    if (warningHashesIt != m_warnings.end())
-                    {
-                        warningHashesIt->remove(trackerEntryStatus.url);
-                    }
-                }
-                else
-                {
-                    if (warningHashesIt == m_warnings.end())
-                        warningHashesIt = m_warnings.insert(id, {});
-                    warningHashesIt->insert(trackerEntryStatus.url);
-                }
-            }
-            break;
-
-        case BitTorrent::TrackerEndpointState::NotWorking:
-        case BitTorrent::TrackerEndpointState::Unreachable:
-            {
-                // remove tracker from "tracker error" and  "warning" categories
-                if (warningHashesIt != m_warnings.end())
-                    warningHashesIt->remove(trackerEntryStatus.url);
-                if (trackerErrorHashesIt != m_trackerErrors.end())
-                    trackerErrorHashesIt->remove(trackerEntryStatus.url);
-
-                if (errorHashesIt == m_errors.end())
-                    errorHashesIt = m_errors.insert(id, {});
-                errorHashesIt->insert(trackerEntryStatus.url);
-            }
-            break;
-
-        case BitTorrent::TrackerEndpointState::TrackerError:
-            {
-                // remove tracker from "error" and  "warning" categories
-                if (warningHashesIt != m_warnings.end())
-                    warningHashesIt->remove(trackerEntryStatus.url);
-                if (errorHashesIt != m_errors.end())
-                    errorHashesIt->remove(trackerEntryStatus.url);
-
-                if (trackerErrorHashesIt == m_trackerErrors.end())
-                    trackerErrorHashesIt = m_trackerErrors.insert(id, {});
-                trackerErrorHashesIt->insert(trackerEntryStatus.url);
-            }
-            break;
-
-        case BitTorrent::TrackerEndpointState::NotContacted:
-            {
-                // remove tracker from "error", "tracker error" and  "warning" categories
-                if (warningHashesIt != m_warnings.end())
-                    warningHashesIt->remove(trackerEntryStatus.url);
-                if (errorHashesIt != m_errors.end())
-                    errorHashesIt->remove(trackerEntryStatus.url);
-                if (trackerErrorHashesIt != m_trackerErrors.end())
-                    trackerErrorHashesIt->remove(trackerEntryStatus.url);
-            }
-            break;
-        };
-    }
-
-    if ((errorHashesIt != m_errors.end()) && errorHashesIt->isEmpty())
-        m_errors.erase(errorHashesIt);
-    if ((trackerErrorHashesIt != m_trackerErrors.end()) && trackerErrorHashesIt->isEmpty())
-        m_trackerErrors.erase(trackerErrorHashesIt);
-    if ((warningHashesIt != m_warnings.end()) && warningHashesIt->isEmpty())
-        m_warnings.erase(warningHashesIt);
-
-    item(OTHERERROR_ROW)->setText(formatItemText(OTHERERROR_ROW, m_errors.size()));
-    item(TRACKERERROR_ROW)->setText(formatItemText(TRACKERERROR_ROW, m_trackerErrors.size()));
-    item(WARNING_ROW)->setText(formatItemText(WARNING_ROW, m_warnings.size()));
-
-    if (const int row = currentRow(); (row == OTHERERROR_ROW)
-        || (row == TRACKERERROR_ROW) || (row == WARNING_ROW))
-    {
-        applyFilter(row);
-    }
-}
-
 void TrackersFilterWidget::downloadFavicon(const QString &trackerHost, const QString &faviconURL)
 {
     if (!m_downloadTrackerFavicon)
@@ -502,7 +269,8 @@ void TrackersFilterWidget::downloadFavicon(const QString &trackerHost, const QSt
 
 void TrackersFilterWidget::removeTracker(const QString &tracker)
 {
-    for (const BitTorrent::TorrentID &torrentID : asConst(m_trackers.value(tracker).torrents))
+    const QSet<BitTorrent::TorrentID> torrentIDs = BitTorrent::Session::instance()->trackerIndex()->torrentsByHost(tracker);
+    for (const BitTorrent::TorrentID &torrentID : torrentIDs)
     {
         auto *torrent = BitTorrent::Session::instance()->getTorrent(torrentID);
         Q_ASSERT(torrent);
@@ -555,7 +323,7 @@ void TrackersFilterWidget::handleFavicoDownloadFinished(const Net::DownloadResul
             const QString faviconURL = QStringView(result.url).chopped(4) + u".png";
             for (const auto &trackerHost : trackerHosts)
             {
-                if (m_trackers.contains(trackerHost))
+                if (m_trackerItems.contains(trackerHost))
                     downloadFavicon(trackerHost, faviconURL);
             }
         }
@@ -566,7 +334,7 @@ void TrackersFilterWidget::handleFavicoDownloadFinished(const Net::DownloadResul
     bool matchedTrackerFound = false;
     for (const auto &trackerHost : trackerHosts)
     {
-        if (!m_trackers.contains(trackerHost))
+        if (!m_trackerItems.contains(trackerHost))
             continue;
 
         matchedTrackerFound = true;
@@ -617,39 +385,13 @@ void TrackersFilterWidget::applyFilter(const int row)
 
 void TrackersFilterWidget::handleTorrentsLoaded(const QList<BitTorrent::Torrent *> &torrents)
 {
-    QHash<QString, QList<BitTorrent::TorrentID>> torrentsPerTracker;
-    for (const BitTorrent::Torrent *torrent : torrents)
-    {
-        const BitTorrent::TorrentID torrentID = torrent->id();
-        const QList<BitTorrent::TrackerEntryStatus> trackers = torrent->trackers();
-        for (const BitTorrent::TrackerEntryStatus &tracker : trackers)
-            torrentsPerTracker[tracker.url].append(torrentID);
-
-        // Check for trackerless torrent
-        if (trackers.isEmpty())
-            torrentsPerTracker[NULL_HOST].append(torrentID);
-    }
-
-    for (const auto &[trackerURL, torrents] : asConst(torrentsPerTracker).asKeyValueRange())
-    {
-        addItems(trackerURL, torrents);
-    }
-
+    // torrents are indexed by trackers in BitTorrent::TrackerIndex
     m_totalTorrents += torrents.count();
     item(ALL_ROW)->setText(formatItemText(ALL_ROW, m_totalTorrents));
 }
 
-void TrackersFilterWidget::torrentAboutToBeDeleted(BitTorrent::Torrent *const torrent)
+void TrackersFilterWidget::torrentAboutToBeDeleted([[maybe_unused]] BitTorrent::Torrent *const torrent)
 {
-    const BitTorrent::TorrentID torrentID = torrent->id();
-    const QList<BitTorrent::TrackerEntryStatus> trackers = torrent->trackers();
-    for (const BitTorrent::TrackerEntryStatus &tracker : trackers)
-        removeItem(tracker.url, torrentID);
-
-    // Check for trackerless torrent
-    if (trackers.isEmpty())
-        removeItem(NULL_HOST, torrentID);
-
     item(ALL_ROW)->setText(formatItemText(ALL_ROW, --m_totalTorrents));
 }
 
@@ -704,17 +446,19 @@ int TrackersFilterWidget::rowFromTracker(const QString &tracker) const
 
 QSet<BitTorrent::TorrentID> TrackersFilterWidget::getTorrentIDs(const int row) const
 {
+    const BitTorrent::TrackerIndex *trackerIndex = BitTorrent::Session::instance()->trackerIndex();
+
     switch (row)
     {
     case TRACKERLESS_ROW:
-        return m_trackers.value(NULL_HOST).torrents;
+        return trackerIndex->torrentsByHost(NULL_HOST);
     case OTHERERROR_ROW:
-        return {m_errors.keyBegin(), m_errors.keyEnd()};
+        return trackerIndex->torrentsWithProblem(BitTorrent::TrackerIndex::Problem::Error);
     case TRACKERERROR_ROW:
-        return {m_trackerErrors.keyBegin(), m_trackerErrors.keyEnd()};
+        return trackerIndex->torrentsWithProblem(BitTorrent::TrackerIndex::Problem::TrackerError);
     case WARNING_ROW:
-        return {m_warnings.keyBegin(), m_warnings.keyEnd()};
+        return trackerIndex->torrentsWithProblem(BitTorrent::TrackerIndex::Problem::Warning);
     default:
-        return m_trackers.value(trackerFromRow(row)).torrents;
+        return trackerIndex->torrentsByHost(trackerFromRow(row));
     }
 }
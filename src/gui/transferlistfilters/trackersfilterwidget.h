@@ -37,12 +37,6 @@
 
 class TransferListWidget;
 
-namespace BitTorrent
-{
-    struct TrackerEntry;
-    struct TrackerEntryStatus;
-}
-
 namespace Net
 {
     struct DownloadResult;
@@ -57,11 +51,6 @@ public:
     TrackersFilterWidget(QWidget *parent, TransferListWidget *transferList, bool downloadFavicon);
     ~TrackersFilterWidget() override;
 
-    void addTrackers(const BitTorrent::Torrent *torrent, const QList<BitTorrent::TrackerEntry> &trackers);
-    void removeTrackers(const BitTorrent::Torrent *torrent, const QStringList &trackers);
-    void refreshTrackers(const BitTorrent::Torrent *torrent);
-    void handleTrackerStatusesUpdated(const BitTorrent::Torrent *torrent
-            , const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers);
     void setDownloadTrackerFavicon(bool value);
 
 private slots:
@@ -77,24 +66,17 @@ private:
 
     void onRemoveTrackerTriggered();
 
-    void addItems(const QString &trackerURL, const QList<BitTorrent::TorrentID> &torrents);
-    void removeItem(const QString &trackerURL, const BitTorrent::TorrentID &id);
+    void handleHostsUpdated(const QSet<QString> &hosts);
+    void handleHostsRemoved(const QSet<QString> &hosts);
+    void handleProblemsChanged();
+
     QString trackerFromRow(int row) const;
     int rowFromTracker(const QString &tracker) const;
     QSet<BitTorrent::TorrentID> getTorrentIDs(int row) const;
     void downloadFavicon(const QString &trackerHost, const QString &faviconURL);
     void removeTracker(const QString &tracker);
 
-    struct TrackerData
-    {
-        QSet<BitTorrent::TorrentID> torrents;
-        QListWidgetItem *item = nullptr;
-    };
-
-    QHash<QString, TrackerData> m_trackers;   // <tracker host, tracker data>
-    QHash<BitTorrent::TorrentID, QSet<QString>> m_errors;  // <torrent ID, tracker hosts>
-    QHash<BitTorrent::TorrentID, QSet<QString>> m_trackerErrors;  // <torrent ID, tracker hosts>
-    QHash<BitTorrent::TorrentID, QSet<QString>> m_warnings;  // <torrent ID, tracker hosts>
+    QHash<QString, QListWidgetItem *> m_trackerItems;   // <tracker host, item>
     PathList m_iconPaths;
     int m_totalTorrents = 0;
     bool m_downloadTrackerFavicon = false;
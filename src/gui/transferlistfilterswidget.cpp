@@ -176,27 +176,6 @@ void TransferListFiltersWidget::setDownloadTrackerFavicon(bool value)
     m_trackersFilterWidget->setDownloadTrackerFavicon(value);
 }
 
-void TransferListFiltersWidget::addTrackers(const BitTorrent::Torrent *torrent, const QList<BitTorrent::TrackerEntry> &trackers)
-{
-    m_trackersFilterWidget->addTrackers(torrent, trackers);
-}
-
-void TransferListFiltersWidget::removeTrackers(const BitTorrent::Torrent *torrent, const QStringList &trackers)
-{
-    m_trackersFilterWidget->removeTrackers(torrent, trackers);
-}
-
-void TransferListFiltersWidget::refreshTrackers(const BitTorrent::Torrent *torrent)
-{
-    m_trackersFilterWidget->refreshTrackers(torrent);
-}
-
-void TransferListFiltersWidget::trackerEntryStatusesUpdated(const BitTorrent::Torrent *torrent
-        , const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers)
-{
-    m_trackersFilterWidget->handleTrackerStatusesUpdated(torrent, updatedTrackers);
-}
-
 void TransferListFiltersWidget::onCategoryFilterStateChanged(bool enabled)
 {
     toggleCategoryFilter(enabled);
@@ -29,23 +29,14 @@
 
 #pragma once
 
-#include <QtContainerFwd>
 #include <QWidget>
 
-#include "base/bittorrent/trackerentry.h"
-
 class CategoryFilterWidget;
 class StatusFilterWidget;
 class TagFilterWidget;
 class TrackersFilterWidget;
 class TransferListWidget;
 
-namespace BitTorrent
-{
-    class Torrent;
-    struct TrackerEntryStatus;
-}
-
 class TransferListFiltersWidget final : public QWidget
 {
     Q_OBJECT
@@ -55,13 +46,6 @@ public:
     TransferListFiltersWidget(QWidget *parent, TransferListWidget *transferList, bool downloadFavicon);
     void setDownloadTrackerFavicon(bool value);
 
-public slots:
-    void addTrackers(const BitTorrent::Torrent *torrent, const QList<BitTorrent::TrackerEntry> &trackers);
-    void removeTrackers(const BitTorrent::Torrent *torrent, const QStringList &trackers);
-    void refreshTrackers(const BitTorrent::Torrent *torrent);
-    void trackerEntryStatusesUpdated(const BitTorrent::Torrent *torrent
-            , const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers);
-
 private slots:
     void onCategoryFilterStateChanged(bool enabled);
     void onTagFilterStateChanged(bool enabled);
@@ -264,6 +264,11 @@ QString TransferListModel::displayValue(const BitTorrent::Torrent *torrent, cons
                 ? QString {} : Utils::Misc::friendlyUnit(value, isSpeedUnit);
     };
 
+    const auto speedString = [&unitString](const qint64 value) -> QString
+    {
+        return unitString(value, true);
+    };
+
     const auto limitString = [hideValues](const qint64 value) -> QString
     {
         if (hideValues && (value <= 0))
@@ -297,6 +302,11 @@ QString TransferListModel::displayValue(const BitTorrent::Torrent *torrent, cons
                   ? C_INFINITY : Utils::String::fromDouble(value, 2);
     };
 
+    const auto dateString = [](const QDateTime &dateTime) -> QString
+    {
+        return QLocale().toString(dateTime.toLocalTime(), QLocale::ShortFormat);
+    };
+
     const auto queuePositionString = [](const qint64 value) -> QString
     {
         return (value >= 0) ? QString::number(value + 1) : u"*"_s;
@@ -367,6 +377,13 @@ QString TransferListModel::displayValue(const BitTorrent::Torrent *torrent, cons
         return tr("N/A");
     };
 
+    // formatting is costly so reuse the strings until the values change
+    const auto cached = [this, torrent, column, hideValues](const auto &format, const auto &...values) -> QString
+    {
+        return m_displayValueCache.value(torrent, column, [&format, &values...] { return format(values...); }
+            , hideValues, values...);
+    };
+
     switch (column)
     {
     case TR_NAME:
@@ -374,73 +391,73 @@ QString TransferListModel::displayValue(const BitTorrent::Torrent *torrent, cons
     case TR_QUEUE_POSITION:
         return queuePositionString(torrent->queuePosition());
     case TR_SIZE:
-        return unitString(torrent->wantedSize());
+        return cached(unitString, torrent->wantedSize());
     case TR_PROGRESS:
-        return progressString(torrent->progress());
+        return cached(progressString, torrent->progress());
     case TR_STATUS:
         return statusString(torrent->state(), torrent->error());
     case TR_SEEDS:
-        return amountString(torrent->seedsCount(), torrent->totalSeedsCount());
+        return cached(amountString, torrent->seedsCount(), torrent->totalSeedsCount());
     case TR_PEERS:
-        return amountString(torrent->leechsCount(), torrent->totalLeechersCount());
+        return cached(amountString, torrent->leechsCount(), torrent->totalLeechersCount());
     case TR_DLSPEED:
-        return unitString(torrent->downloadPayloadRate(), true);
+        return cached(speedString, torrent->downloadPayloadRate());
     case TR_UPSPEED:
-        return unitString(torrent->uploadPayloadRate(), true);
+        return cached(speedString, torrent->uploadPayloadRate());
     case TR_ETA:
-        return etaString(torrent->eta());
+        return cached(etaString, torrent->eta());
     case TR_RATIO:
-        return ratioString(torrent->realRatio());
+        return cached(ratioString, torrent->realRatio());
     case TR_RATIO_LIMIT:
-        return ratioString(torrent->maxRatio());
+        return cached(ratioString, torrent->maxRatio());
     case TR_POPULARITY:
-        return ratioString(torrent->popularity());
+        return cached(ratioString, torrent->popularity());
     case TR_CATEGORY:
         return torrent->category();
     case TR_TAGS:
         return Utils::String::joinIntoString(torrent->tags(), u", "_s);
     case TR_ADD_DATE:
-        return QLocale().toString(torrent->addedTime().toLocalTime(), QLocale::ShortFormat);
+        return cached(dateString, torrent->addedTime());
     case TR_SEED_DATE:
-        return QLocale().toString(torrent->completedTime().toLocalTime(), QLocale::ShortFormat);
+        return cached(dateString, torrent->completedTime());
     case TR_TRACKER:
         return torrent->currentTracker();
     case TR_DLLIMIT:
-        return limitString(torrent->downloadLimit());
+        return cached(limitString, torrent->downloadLimit());
     case TR_UPLIMIT:
-        return limitString(torrent->uploadLimit());
+        return cached(limitString, torrent->uploadLimit());
     case TR_AMOUNT_DOWNLOADED:
-        return unitString(torrent->totalDownload());
+        return cached(unitString, torrent->totalDownload());
     case TR_AMOUNT_UPLOADED:
-        return unitString(torrent->totalUpload());
+        return cached(unitString, torrent->totalUpload());
     case TR_AMOUNT_DOWNLOADED_SESSION:
-        return unitString(torrent->totalPayloadDownload());
+        return cached(unitString, torrent->totalPayloadDownload());
     case TR_AMOUNT_UPLOADED_SESSION:
-        return unitString(torrent->totalPayloadUpload());
+        return cached(unitString, torrent->totalPayloadUpload());
     case TR_AMOUNT_LEFT:
-        return unitString(torrent->remainingSize());
+        return cached(unitString, torrent->remainingSize());
     case TR_TIME_ELAPSED:
-        return timeElapsedString(torrent->activeTime(), torrent->finishedTime());
+        return cached(timeElapsedString, torrent->activeTime(), torrent->finishedTime());
     case TR_SAVE_PATH:
         return torrent->savePath().toString();
     case TR_DOWNLOAD_PATH:
         return torrent->downloadPath().toString();
     case TR_COMPLETED:
-        return unitString(torrent->completedSize());
+        return cached(unitString, torrent->completedSize());
     case TR_SEEN_COMPLETE_DATE:
-        return QLocale().toString(torrent->lastSeenComplete().toLocalTime(), QLocale::ShortFormat);
+        return cached(dateString, torrent->lastSeenComplete());
     case TR_LAST_ACTIVITY:
-        return lastActivityString(torrent->timeSinceActivity());
+        return cached(lastActivityString, torrent->timeSinceActivity());
     case TR_AVAILABILITY:
-        return availabilityString(torrent->distributedCopies());
+        return cached(availabilityString, torrent->distributedCopies());
     case TR_TOTAL_SIZE:
-        return unitString(torrent->totalSize());
+        return cached(unitString, torrent->totalSize());
     case TR_INFOHASH_V1:
         return hashString(torrent->infoHash().v1());
     case TR_INFOHASH_V2:
         return hashString(torrent->infoHash().v2());
     case TR_REANNOUNCE:
-        return reannounceString(torrent->nextAnnounce());
+        return cached(reannounceString, torrent->nextAnnounce());
     case TR_PRIVATE:
         return privateString(torrent->isPrivate(), torrent->hasMetadata());
     }
@@ -671,6 +688,7 @@ void TransferListModel::handleTorrentAboutToBeRemoved(BitTorrent::Torrent *const
     Q_ASSERT(row >= 0);
 
     beginRemoveRows({}, row, row);
+    m_displayValueCache.remove(torrent);
     m_torrentList.removeAt(row);
     m_torrentMap.remove(torrent);
     for (int &value : m_torrentMap)
@@ -712,12 +730,12 @@ void TransferListModel::handleTorrentsUpdated(const QList<BitTorrent::Torrent *>
 
 void TransferListModel::configure()
 {
-    const Preferences *pref = Preferences::instance();
+    const PreferencesSnapshot &pref = Preferences::instance()->snapshot();
 
     HideZeroValuesMode hideZeroValuesMode = HideZeroValuesMode::Never;
-    if (pref->getHideZeroValues())
+    if (pref.hideZeroValues)
     {
-        if (pref->getHideZeroComboValues() == 1)
+        if (pref.hideZeroComboValues == 1)
             hideZeroValuesMode = HideZeroValuesMode::Stopped;
         else
             hideZeroValuesMode = HideZeroValuesMode::Always;
@@ -731,7 +749,7 @@ void TransferListModel::configure()
         isDataChanged = true;
     }
 
-    if (const bool useTorrentStatesColors = pref->useTorrentStatesColors(); m_useTorrentStatesColors != useTorrentStatesColors)
+    if (const bool useTorrentStatesColors = pref.useTorrentStatesColors; m_useTorrentStatesColors != useTorrentStatesColors)
     {
         m_useTorrentStatesColors = useTorrentStatesColors;
         isDataChanged = true;
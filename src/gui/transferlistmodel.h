@@ -36,6 +36,7 @@
 #include <QList>
 
 #include "base/bittorrent/torrent.h"
+#include "displayvaluecache.h"
 
 namespace BitTorrent
 {
@@ -134,6 +135,8 @@ private:
         Always
     };
 
+    mutable DisplayValueCache<const BitTorrent::Torrent *> m_displayValueCache {NB_COLUMNS};
+
     HideZeroValuesMode m_hideZeroValuesMode = HideZeroValuesMode::Never;
     bool m_useTorrentStatesColors = false;
 
@@ -1,4 +1,4 @@
-# VERSION: 1.50
+# VERSION: 1.51
 
 # Author:
 #  Fabien Devaux <fab AT gnux DOT info>
@@ -36,11 +36,13 @@
 import importlib
 import pathlib
 import sys
+import time
 import traceback
 import urllib.parse
 import xml.etree.ElementTree as ET
 from abc import ABC, abstractmethod
 from collections.abc import Iterable
+from contextlib import nullcontext
 from enum import Enum
 from glob import glob
 from multiprocessing import Pool, cpu_count
@@ -193,6 +195,70 @@ def run_search(search_params: tuple[type[Engine], str, Category]) -> bool:
         return False
 
 
+def run_timed_search(search_params: tuple[EngineModuleName, type[Engine], str, Category]) -> tuple[EngineModuleName, bool, int]:
+    """ Run search in engine and measure its duration
+
+        @param search_params Tuple with engine module name, engine, query and category
+
+        @retval Tuple with engine module name, search result and elapsed time in milliseconds
+    """
+
+    engine_module_name, engine_class, what, cat = search_params
+    start_time = time.monotonic()
+    success = run_search((engine_class, what, cat))
+    return (engine_module_name, success, round((time.monotonic() - start_time) * 1000))
+
+
+def print_control_line(*fields: str) -> None:
+    # fd 1 is stdout
+    with open(1, 'w', encoding='utf-8', closefd=False) as utf8stdout:
+        print('\t'.join(('@@',) + fields), file=utf8stdout, flush=True)
+
+
+def serve() -> int:
+    """ Serve search requests read from stdin until it is closed
+
+        Each request is a line in the following form:
+          search<TAB>all|engine1[,engine2]*<TAB><category><TAB><keywords>
+        Search results are printed in the same format as in the command line mode,
+        followed by one line per engine:
+          @@<TAB>engine<TAB><engine module name><TAB>1|0<TAB><elapsed milliseconds>
+        and a line that terminates the response:
+          @@<TAB>done<TAB>1|0
+    """
+
+    processes = max(min(len(list_engines()), MAX_THREADS), 1)
+    # the pool is kept alive between requests to avoid paying process startup cost on every search
+    with (Pool(processes) if THREADED else nullcontext()) as pool:
+        while line := sys.stdin.readline():
+            fields = line.rstrip('\n').split('\t')
+            if (len(fields) != 4) or (fields[0] != 'search'):
+                print(f"Invalid request: {line.strip()}", file=sys.stderr, flush=True)
+                print_control_line('done', '0')
+                continue
+
+            found_engines = list_engines()
+            engs = set(e.strip().lower() for e in fields[1].split(','))
+            engines = found_engines if 'all' in engs else [e for e in found_engines if e in engs]
+
+            try:
+                category = Category[fields[2].lower()]
+            except KeyError:
+                print(f"Invalid category: {fields[2]}", file=sys.stderr, flush=True)
+                print_control_line('done', '0')
+                continue
+
+            what = urllib.parse.quote(fields[3])
+            params = [(e, engine_class, what, category) for e in engines if (engine_class := import_engine(e)) is not None]
+            results = pool.map(run_timed_search, params) if pool is not None else list(map(run_timed_search, params))
+
+            for engine_module_name, success, elapsed in results:
+                print_control_line('engine', engine_module_name, ('1' if success else '0'), str(elapsed))
+            print_control_line('done', ('1' if all(success for _, success, _ in results) else '0'))
+
+    return 0
+
+
 if __name__ == "__main__":
     def main() -> int:
         # https://docs.python.org/3/library/sys.html#sys.exit
@@ -206,8 +272,12 @@ if __name__ == "__main__":
         prog_name = sys.argv[0]
         prog_usage = (f"Usage: {prog_name} all|engine1[,engine2]* <category> <keywords>\n"
                       f"To list available engines: {prog_name} --capabilities [--names]\n"
+                      f"To serve search requests read from stdin: {prog_name} --serve\n"
                       f"Found engines: {','.join(found_engines)}")
 
+        if "--serve" in sys.argv:
+            return serve()
+
         if "--capabilities" in sys.argv:
             if "--names" in sys.argv:
                 print(",".join((e for e in found_engines if import_engine(e) is not None)))
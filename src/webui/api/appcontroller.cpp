@@ -48,9 +48,12 @@
 #include <QTimer>
 #include <QTranslator>
 
+#include "base/bittorrent/bandwidthschedule.h"
 #include "base/bittorrent/session.h"
+#include "base/externalprogramrunner.h"
 #include "base/global.h"
 #include "base/interfaces/iapplication.h"
+#include "base/memoryusagetracker.h"
 #include "base/net/downloadmanager.h"
 #include "base/net/portforwarder.h"
 #include "base/net/proxyconfigurationmanager.h"
@@ -65,6 +68,7 @@
 #include "base/utils/fs.h"
 #include "base/utils/misc.h"
 #include "base/utils/net.h"
+#include "base/utils/os.h"
 #include "base/utils/password.h"
 #include "base/utils/string.h"
 #include "base/version.h"
@@ -121,6 +125,41 @@ void AppController::buildInfoAction()
     setResult(versions);
 }
 
+void AppController::autorunStatsAction()
+{
+    const ExternalProgramStats stats = app()->externalProgramRunner()->stats();
+    setResult(QJsonObject
+    {
+        {u"started"_s, stats.startedCount},
+        {u"succeeded"_s, stats.succeededCount},
+        {u"failed"_s, stats.failedCount},
+        {u"timed_out"_s, stats.timedOutCount},
+        {u"total_run_time"_s, stats.totalRunTime},
+        {u"running"_s, stats.runningCount},
+        {u"queued"_s, stats.queuedCount}
+    });
+}
+
+void AppController::memoryUsageAction()
+{
+    QJsonObject components;
+    const QHash<QString, MemoryUsage> usage = MemoryUsageTracker::instance()->estimate();
+    for (auto it = usage.cbegin(); it != usage.cend(); ++it)
+    {
+        components[it.key()] = QJsonObject
+        {
+            {u"size"_s, it->size},
+            {u"count"_s, it->count}
+        };
+    }
+
+    setResult(QJsonObject
+    {
+        {u"resident_size"_s, Utils::OS::residentMemorySize()},
+        {u"components"_s, components}
+    });
+}
+
 void AppController::shutdownAction()
 {
     // Special handling for shutdown, we
@@ -155,6 +194,8 @@ void AppController::preferencesAction()
     data[u"file_log_delete_old"_s] = app()->isFileLoggerDeleteOld();
     data[u"file_log_age"_s] = app()->fileLoggerAge();
     data[u"file_log_age_type"_s] = app()->fileLoggerAgeType();
+    data[u"file_log_format"_s] = app()->fileLoggerFormat();
+    data[u"file_log_compress_backups"_s] = app()->isFileLoggerCompressBackups();
     // Delete torrent contents files on torrent removal
     data[u"delete_torrent_content_files"_s] = pref->removeTorrentContent();
 
@@ -214,12 +255,16 @@ void AppController::preferencesAction()
     data[u"mail_notification_auth_enabled"_s] = pref->getMailNotificationSMTPAuth();
     data[u"mail_notification_username"_s] = pref->getMailNotificationSMTPUsername();
     data[u"mail_notification_password"_s] = pref->getMailNotificationSMTPPassword();
+    data[u"mail_notification_digest_interval"_s] = pref->getMailNotificationDigestInterval();
     // Run an external program on torrent added
     data[u"autorun_on_torrent_added_enabled"_s] = pref->isAutoRunOnTorrentAddedEnabled();
     data[u"autorun_on_torrent_added_program"_s] = pref->getAutoRunOnTorrentAddedProgram();
     // Run an external program on torrent finished
     data[u"autorun_enabled"_s] = pref->isAutoRunOnTorrentFinishedEnabled();
     data[u"autorun_program"_s] = pref->getAutoRunOnTorrentFinishedProgram();
+    data[u"autorun_max_concurrent"_s] = pref->getAutoRunMaxConcurrentProcesses();
+    data[u"autorun_timeout"_s] = pref->getAutoRunTimeout();
+    data[u"autorun_batching_enabled"_s] = pref->isAutoRunBatchingEnabled();
 
     // Connection
     // Listening Port
@@ -285,6 +330,12 @@ void AppController::preferencesAction()
     data[u"schedule_to_hour"_s] = end_time.hour();
     data[u"schedule_to_min"_s] = end_time.minute();
     data[u"scheduler_days"_s] = static_cast<int>(pref->getSchedulerDays());
+    QVariantList schedulerRules;
+    for (const BitTorrent::BandwidthScheduleRule &rule : asConst(session->bandwidthSchedulerRules()))
+        schedulerRules.append(rule.toJSON().toVariantMap());
+    data[u"scheduler_rules"_s] = schedulerRules;
+    data[u"scheduler_rules_enabled"_s] = session->isBandwidthSchedulerRulesEnabled();
+    data[u"scheduler_ramp_time"_s] = session->bandwidthSchedulerRampTime();
 
     // Bittorrent
     // Privacy
@@ -295,6 +346,7 @@ void AppController::preferencesAction()
     data[u"anonymous_mode"_s] = session->isAnonymousModeEnabled();
     // Max active checking torrents
     data[u"max_active_checking_torrents"_s] = session->maxActiveCheckingTorrents();
+    data[u"recheck_jobs_per_device"_s] = session->recheckJobsPerDevice();
     // Torrent Queueing
     data[u"queueing_enabled"_s] = session->isQueueingSystemEnabled();
     data[u"max_active_downloads"_s] = session->maxActiveDownloads();
@@ -304,6 +356,12 @@ void AppController::preferencesAction()
     data[u"slow_torrent_dl_rate_threshold"_s] = session->downloadRateForSlowTorrents();
     data[u"slow_torrent_ul_rate_threshold"_s] = session->uploadRateForSlowTorrents();
     data[u"slow_torrent_inactive_timer"_s] = session->slowTorrentsInactivityTimer();
+    data[u"seeding_optimizer_enabled"_s] = session->isSeedingOptimizerEnabled();
+    data[u"seeding_optimizer_simulation"_s] = session->isSeedingOptimizerSimulationEnabled();
+    data[u"seeding_optimizer_interval"_s] = session->seedingOptimizerInterval();
+    data[u"swarm_stats_scraping_enabled"_s] = session->isSwarmStatsScrapingEnabled();
+    data[u"swarm_stats_ttl"_s] = session->swarmStatsTTL();
+    data[u"metadata_unloading_enabled"_s] = session->isMetadataUnloadingEnabled();
     // Share Ratio Limiting
     data[u"max_ratio_enabled"_s] = (session->globalMaxRatio() >= 0.);
     data[u"max_ratio"_s] = session->globalMaxRatio();
@@ -558,6 +616,10 @@ void AppController::setPreferencesAction()
         app()->setFileLoggerAge(it.value().toInt());
     if (hasKey(u"file_log_age_type"_s))
         app()->setFileLoggerAgeType(it.value().toInt());
+    if (hasKey(u"file_log_format"_s))
+        app()->setFileLoggerFormat(it.value().toInt());
+    if (hasKey(u"file_log_compress_backups"_s))
+        app()->setFileLoggerCompressBackups(it.value().toBool());
     // Delete torrent content files on torrent removal
     if (hasKey(u"delete_torrent_content_files"_s))
         pref->setRemoveTorrentContent(it.value().toBool());
@@ -681,6 +743,8 @@ void AppController::setPreferencesAction()
         pref->setMailNotificationSMTPUsername(it.value().toString());
     if (hasKey(u"mail_notification_password"_s))
         pref->setMailNotificationSMTPPassword(it.value().toString());
+    if (hasKey(u"mail_notification_digest_interval"_s))
+        pref->setMailNotificationDigestInterval(it.value().toInt());
     // Run an external program on torrent added
     if (hasKey(u"autorun_on_torrent_added_enabled"_s))
         pref->setAutoRunOnTorrentAddedEnabled(it.value().toBool());
@@ -691,6 +755,12 @@ void AppController::setPreferencesAction()
         pref->setAutoRunOnTorrentFinishedEnabled(it.value().toBool());
     if (hasKey(u"autorun_program"_s))
         pref->setAutoRunOnTorrentFinishedProgram(it.value().toString().trimmed());
+    if (hasKey(u"autorun_max_concurrent"_s))
+        pref->setAutoRunMaxConcurrentProcesses(it.value().toInt());
+    if (hasKey(u"autorun_timeout"_s))
+        pref->setAutoRunTimeout(it.value().toInt());
+    if (hasKey(u"autorun_batching_enabled"_s))
+        pref->setAutoRunBatchingEnabled(it.value().toBool());
 
     // Connection
     // Listening Port
@@ -804,6 +874,17 @@ void AppController::setPreferencesAction()
         pref->setSchedulerEndTime({hourIter.value().toInt(), minIter.value().toInt()});
     if (hasKey(u"scheduler_days"_s))
         pref->setSchedulerDays(static_cast<Scheduler::Days>(it.value().toInt()));
+    if (hasKey(u"scheduler_rules"_s))
+    {
+        QList<BitTorrent::BandwidthScheduleRule> rules;
+        for (const QVariant &ruleValue : asConst(it.value().toList()))
+            rules.append(BitTorrent::BandwidthScheduleRule::fromJSON(QJsonObject::fromVariantMap(ruleValue.toMap())));
+        session->setBandwidthSchedulerRules(rules);
+    }
+    if (hasKey(u"scheduler_rules_enabled"_s))
+        session->setBandwidthSchedulerRulesEnabled(it.value().toBool());
+    if (hasKey(u"scheduler_ramp_time"_s))
+        session->setBandwidthSchedulerRampTime(it.value().toInt());
 
     // Bittorrent
     // Privacy
@@ -820,6 +901,8 @@ void AppController::setPreferencesAction()
     // Max active checking torrents
     if (hasKey(u"max_active_checking_torrents"_s))
         session->setMaxActiveCheckingTorrents(it.value().toInt());
+    if (hasKey(u"recheck_jobs_per_device"_s))
+        session->setRecheckJobsPerDevice(it.value().toInt());
     // Torrent Queueing
     if (hasKey(u"queueing_enabled"_s))
         session->setQueueingSystemEnabled(it.value().toBool());
@@ -837,6 +920,18 @@ void AppController::setPreferencesAction()
         session->setUploadRateForSlowTorrents(it.value().toInt());
     if (hasKey(u"slow_torrent_inactive_timer"_s))
         session->setSlowTorrentsInactivityTimer(it.value().toInt());
+    if (hasKey(u"seeding_optimizer_enabled"_s))
+        session->setSeedingOptimizerEnabled(it.value().toBool());
+    if (hasKey(u"seeding_optimizer_simulation"_s))
+        session->setSeedingOptimizerSimulationEnabled(it.value().toBool());
+    if (hasKey(u"seeding_optimizer_interval"_s))
+        session->setSeedingOptimizerInterval(it.value().toInt());
+    if (hasKey(u"swarm_stats_scraping_enabled"_s))
+        session->setSwarmStatsScrapingEnabled(it.value().toBool());
+    if (hasKey(u"swarm_stats_ttl"_s))
+        session->setSwarmStatsTTL(it.value().toInt());
+    if (hasKey(u"metadata_unloading_enabled"_s))
+        session->setMetadataUnloadingEnabled(it.value().toBool());
     // Share Ratio Limiting
     if (hasKey(u"max_ratio_enabled"_s) && !it.value().toBool())
         session->setGlobalMaxRatio(-1);
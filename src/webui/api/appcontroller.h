@@ -44,6 +44,8 @@ private slots:
     void webapiVersionAction();
     void versionAction();
     void buildInfoAction();
+    void autorunStatsAction();
+    void memoryUsageAction();
     void shutdownAction();
     void preferencesAction();
     void setPreferencesAction();
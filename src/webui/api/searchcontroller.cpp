@@ -30,6 +30,7 @@
 #include "searchcontroller.h"
 
 #include <limits>
+#include <optional>
 
 #include <QHash>
 #include <QJsonArray>
@@ -43,6 +44,8 @@
 #include "base/logger.h"
 #include "base/search/searchdownloadhandler.h"
 #include "base/search/searchhandler.h"
+#include "base/search/searchresultstore.h"
+#include "base/search/searchworkerpool.h"
 #include "base/utils/datetime.h"
 #include "base/utils/foreignapps.h"
 #include "base/utils/random.h"
@@ -52,6 +55,24 @@
 
 namespace
 {
+    const QHash<QString, SearchResultStore::SortColumn> SORT_COLUMNS
+    {
+        {u"fileName"_s, SearchResultStore::SortColumn::Name},
+        {u"fileSize"_s, SearchResultStore::SortColumn::Size},
+        {u"nbSeeders"_s, SearchResultStore::SortColumn::Seeders},
+        {u"nbLeechers"_s, SearchResultStore::SortColumn::Leechers},
+        {u"engineName"_s, SearchResultStore::SortColumn::EngineName},
+        {u"siteUrl"_s, SearchResultStore::SortColumn::SiteURL},
+        {u"pubDate"_s, SearchResultStore::SortColumn::PubDate}
+    };
+
+    std::optional<qlonglong> parseLongLong(const QString &string)
+    {
+        bool ok = false;
+        const qlonglong value = string.toLongLong(&ok);
+        return ok ? std::optional(value) : std::nullopt;
+    }
+
     /**
     * Returns the search categories in JSON format.
     *
@@ -183,8 +204,8 @@ void SearchController::resultsAction()
         throw APIError(APIErrorType::NotFound);
 
     const std::shared_ptr<SearchHandler> &searchHandler = iter.value();
-    const QList<SearchResult> searchResults = searchHandler->results();
-    const qsizetype size = searchResults.size();
+    const SearchResultStore &resultStore = searchHandler->resultStore();
+    const qsizetype size = resultStore.size();
 
     if (offset > size)
         throw APIError(APIErrorType::Conflict, tr("Offset is out of range"));
@@ -197,10 +218,28 @@ void SearchController::resultsAction()
     if (limit <= 0)
         limit = -1;
 
-    if ((limit > 0) || (offset > 0))
-        setResult(getResults(searchResults.mid(offset, limit), searchHandler->isActive(), size));
-    else
-        setResult(getResults(searchResults, searchHandler->isActive(), size));
+    const QString sortBy = params()[u"sortBy"_s];
+    const auto sortColumnIter = SORT_COLUMNS.constFind(sortBy);
+    if (!sortBy.isEmpty() && (sortColumnIter == SORT_COLUMNS.cend()))
+        throw APIError(APIErrorType::BadParams, tr("Invalid `sortBy` value"));
+
+    const SearchResultStore::Query query
+    {
+        .sortColumn = (sortColumnIter != SORT_COLUMNS.cend()) ? sortColumnIter.value() : SearchResultStore::SortColumn::None,
+        .sortDescending = Utils::String::parseBool(params()[u"reverse"_s]).value_or(false),
+        .nameTerms = params()[u"filter"_s].split(u' ', Qt::SkipEmptyParts),
+        .minSize = parseLongLong(params()[u"minSize"_s]),
+        .maxSize = parseLongLong(params()[u"maxSize"_s]),
+        .minSeeders = parseLongLong(params()[u"minSeeders"_s]),
+        .maxSeeders = parseLongLong(params()[u"maxSeeders"_s]),
+        .offset = offset,
+        .limit = limit
+    };
+    const SearchResultStore::QueryResult queryResult = resultStore.query(query);
+
+    QJsonObject result = getResults(queryResult.results, searchHandler->isActive(), size);
+    result[u"matched"_s] = queryResult.matchedCount;
+    setResult(result);
 }
 
 void SearchController::deleteAction()
@@ -393,10 +432,14 @@ QJsonObject SearchController::getResults(const QList<SearchResult> &searchResult
 QJsonArray SearchController::getPluginsInfo(const QStringList &plugins) const
 {
     QJsonArray pluginsArray;
+    const QHash<QString, SearchEngineStats> engineStats = SearchPluginManager::instance()->engineStats();
 
     for (const QString &plugin : plugins)
     {
         const PluginInfo *const pluginInfo = SearchPluginManager::instance()->pluginInfo(plugin);
+        const SearchEngineStats stats = engineStats.value(plugin);
+        const qint64 averageSearchTime = (stats.searchCount > 0)
+            ? (stats.totalElapsed.count() / stats.searchCount) : 0;
 
         pluginsArray << QJsonObject
         {
@@ -405,7 +448,11 @@ QJsonArray SearchController::getPluginsInfo(const QStringList &plugins) const
             {u"fullName"_s, pluginInfo->fullName},
             {u"url"_s, pluginInfo->url},
             {u"supportedCategories"_s, getPluginCategories(pluginInfo->supportedCategories)},
-            {u"enabled"_s, pluginInfo->enabled}
+            {u"enabled"_s, pluginInfo->enabled},
+            {u"searchCount"_s, stats.searchCount},
+            {u"failureCount"_s, stats.failureCount},
+            {u"averageSearchTime"_s, averageSearchTime},
+            {u"lastSearchTime"_s, static_cast<qint64>(stats.lastElapsed.count())}
         };
     }
 
@@ -88,6 +88,7 @@ inline const QString KEY_TORRENT_INACTIVE_SEEDING_TIME_LIMIT = u"inactive_seedin
 inline const QString KEY_TORRENT_SHARE_LIMIT_ACTION = u"share_limit_action"_s;
 inline const QString KEY_TORRENT_LAST_SEEN_COMPLETE_TIME = u"seen_complete"_s;
 inline const QString KEY_TORRENT_LAST_ACTIVITY_TIME = u"last_activity"_s;
+inline const QString KEY_TORRENT_SWARM_STATS_TIME = u"swarm_stats_time"_s;
 inline const QString KEY_TORRENT_TOTAL_SIZE = u"total_size"_s;
 inline const QString KEY_TORRENT_AUTO_TORRENT_MANAGEMENT = u"auto_tmm"_s;
 inline const QString KEY_TORRENT_TIME_ACTIVE = u"time_active"_s;
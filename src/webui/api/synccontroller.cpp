@@ -28,12 +28,16 @@
 
 #include "synccontroller.h"
 
+#include <algorithm>
+
+#include <QBitArray>
 #include <QFuture>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QMetaObject>
+#include <QVariant>
 
-#include "base/algorithm.h"
 #include "base/bittorrent/cachestatus.h"
 #include "base/bittorrent/infohash.h"
 #include "base/bittorrent/peeraddress.h"
@@ -43,7 +47,9 @@
 #include "base/bittorrent/torrent.h"
 #include "base/bittorrent/torrentinfo.h"
 #include "base/bittorrent/trackerentrystatus.h"
+#include "base/bittorrent/trackerindex.h"
 #include "base/global.h"
+#include "base/memoryusagetracker.h"
 #include "base/net/geoipmanager.h"
 #include "base/preferences.h"
 #include "base/utils/string.h"
@@ -53,6 +59,8 @@
 namespace
 {
     // Sync main data keys
+    const QString KEY_SYNC_MAINDATA_ADD_TORRENTS_PROCESSED = u"add_torrents_processed"_s;
+    const QString KEY_SYNC_MAINDATA_ADD_TORRENTS_TOTAL = u"add_torrents_total"_s;
     const QString KEY_SYNC_MAINDATA_QUEUEING = u"queueing"_s;
     const QString KEY_SYNC_MAINDATA_REFRESH_INTERVAL = u"refresh_interval"_s;
     const QString KEY_SYNC_MAINDATA_USE_ALT_SPEED_LIMITS = u"use_alt_speed_limits"_s;
@@ -440,11 +448,70 @@ namespace
         serializedTorrent[KEY_TORRENT_HAS_TRACKER_ERROR] = hasTrackerError;
         serializedTorrent[KEY_TORRENT_HAS_OTHER_ANNOUNCE_ERROR] = hasOtherAnnounceError;
     }
+
+    template <typename T>
+    qint64 estimateHashMemoryUsage(const QHash<QString, T> &hash)
+    {
+        qint64 size = 0;
+        for (auto it = hash.cbegin(); it != hash.cend(); ++it)
+            size += sizeof(QString) + estimateMemoryUsage(it.key()) + estimateMemoryUsage(QVariant(it.value()));
+        return size;
+    }
+
+    // Changed torrents are tracked by their session slots
+    void markTorrent(QBitArray &torrentSlots, const BitTorrent::Torrent *torrent)
+    {
+        const int slot = torrent->slotIndex();
+        if (slot >= torrentSlots.size())
+            torrentSlots.resize(std::max<qsizetype>((slot + 1), (torrentSlots.size() * 2)));
+        torrentSlots.setBit(slot);
+    }
+
+    void unmarkTorrent(QBitArray &torrentSlots, const BitTorrent::Torrent *torrent)
+    {
+        if (const int slot = torrent->slotIndex(); slot < torrentSlots.size())
+            torrentSlots.clearBit(slot);
+    }
+
+    bool isTorrentMarked(const QBitArray &torrentSlots, const BitTorrent::Torrent *torrent)
+    {
+        const int slot = torrent->slotIndex();
+        return (slot < torrentSlots.size()) && torrentSlots.testBit(slot);
+    }
+
+    QList<BitTorrent::Torrent *> markedTorrents(const QBitArray &torrentSlots)
+    {
+        const auto *session = BitTorrent::Session::instance();
+
+        QList<BitTorrent::Torrent *> torrents;
+        for (int slot = 0; slot < torrentSlots.size(); ++slot)
+        {
+            if (!torrentSlots.testBit(slot))
+                continue;
+
+            BitTorrent::Torrent *torrent = session->torrentAt(slot);
+            Q_ASSERT(torrent);
+            torrents.append(torrent);
+        }
+
+        return torrents;
+    }
 }
 
 SyncController::SyncController(IApplication *app, QObject *parent)
     : APIController(app, parent)
 {
+    if (auto *memoryUsageTracker = MemoryUsageTracker::instance())
+    {
+        memoryUsageTracker->addEstimator(MemoryComponent::WebUISync, this, [this]
+        {
+            const qint64 size = sizeof(SyncController)
+                    + memoryUsage(m_maindataSnapshot) + memoryUsage(m_maindataSyncBuf)
+                    + estimateMemoryUsage(QVariant(m_lastPeersResponse))
+                    + estimateMemoryUsage(QVariant(m_lastAcceptedPeersResponse));
+            return MemoryUsage {.size = size, .count = 1};
+        });
+    }
 }
 
 void SyncController::updateFreeDiskSpace(const qint64 freeDiskSpace)
@@ -452,6 +519,21 @@ void SyncController::updateFreeDiskSpace(const qint64 freeDiskSpace)
     m_freeDiskSpace = freeDiskSpace;
 }
 
+void SyncController::updateAddTorrentsProgress(const int processedCount, const int totalCount)
+{
+    m_addTorrentsProcessedCount = processedCount;
+    m_addTorrentsTotalCount = totalCount;
+}
+
+qint64 SyncController::memoryUsage(const MaindataSyncBuf &buf)
+{
+    return estimateHashMemoryUsage(buf.categories) + estimateHashMemoryUsage(buf.torrents)
+            + estimateHashMemoryUsage(buf.trackers) + estimateMemoryUsage(QVariant(buf.tags))
+            + estimateMemoryUsage(QVariant(buf.removedCategories)) + estimateMemoryUsage(QVariant(buf.removedTags))
+            + estimateMemoryUsage(QVariant(buf.removedTorrents)) + estimateMemoryUsage(QVariant(buf.removedTrackers))
+            + estimateMemoryUsage(QVariant(buf.serverState));
+}
+
 // The function returns the changed data from the server to synchronize with the web client.
 // Return value is map in JSON format.
 // Map contain the key:
@@ -519,6 +601,8 @@ void SyncController::updateFreeDiskSpace(const qint64 freeDiskSpace)
 //  - "queueing": queue system usage flag
 //  - "refresh_interval": torrents table refresh interval
 //  - "free_space_on_disk": Free space on the default save path
+//  - "add_torrents_processed": number of torrents processed by the running bulk add
+//  - "add_torrents_total": total number of torrents of the running bulk add
 // GET param:
 //   - rid (int): last response id
 void SyncController::maindataAction()
@@ -549,6 +633,10 @@ void SyncController::maindataAction()
         connect(btSession, &BitTorrent::Session::trackersRemoved, this, &SyncController::onTorrentTrackersChanged);
         connect(btSession, &BitTorrent::Session::trackersChanged, this, &SyncController::onTorrentTrackersChanged);
         connect(btSession, &BitTorrent::Session::trackerEntryStatusesUpdated, this, &SyncController::onTorrentTrackerEntryStatusesUpdated);
+
+        const BitTorrent::TrackerIndex *trackerIndex = btSession->trackerIndex();
+        connect(trackerIndex, &BitTorrent::TrackerIndex::trackersUpdated, this, &SyncController::onTrackersUpdated);
+        connect(trackerIndex, &BitTorrent::TrackerIndex::trackersRemoved, this, &SyncController::onTrackersRemoved);
     }
 
     const int acceptedID = params()[u"rid"_s].toInt();
@@ -575,7 +663,6 @@ void SyncController::maindataAction()
 
 void SyncController::makeMaindataSnapshot()
 {
-    m_knownTrackers.clear();
     m_maindataAcceptedID = 0;
     m_maindataSnapshot = {};
 
@@ -589,9 +676,6 @@ void SyncController::makeMaindataSnapshot()
         serializedTorrent.remove(KEY_TORRENT_ID);
         addAnnounceStats(serializedTorrent, torrent);
 
-        for (const BitTorrent::TrackerEntryStatus &status : asConst(torrent->trackers()))
-            m_knownTrackers[status.url].insert(torrentID);
-
         m_maindataSnapshot.torrents[torrentID.toString()] = serializedTorrent;
     }
 
@@ -609,8 +693,9 @@ void SyncController::makeMaindataSnapshot()
     for (const Tag &tag : asConst(session->tags()))
         m_maindataSnapshot.tags.append(tag.toString());
 
-    for (const auto &[tracker, torrentIDs] : asConst(m_knownTrackers).asKeyValueRange())
-        m_maindataSnapshot.trackers[tracker] = asStrings(torrentIDs);
+    const BitTorrent::TrackerIndex *trackerIndex = session->trackerIndex();
+    for (const QString &tracker : asConst(trackerIndex->trackers()))
+        m_maindataSnapshot.trackers[tracker] = asStrings(trackerIndex->torrentsByTracker(tracker));
 
     m_maindataSnapshot.serverState = getTransferInfo();
     m_maindataSnapshot.serverState[KEY_TRANSFER_FREESPACEONDISK] = m_freeDiskSpace;
@@ -618,6 +703,8 @@ void SyncController::makeMaindataSnapshot()
     m_maindataSnapshot.serverState[KEY_SYNC_MAINDATA_USE_ALT_SPEED_LIMITS] = session->isAltGlobalSpeedLimitEnabled();
     m_maindataSnapshot.serverState[KEY_SYNC_MAINDATA_REFRESH_INTERVAL] = session->refreshInterval();
     m_maindataSnapshot.serverState[KEY_SYNC_MAINDATA_USE_SUBCATEGORIES] = session->isSubcategoriesEnabled();
+    m_maindataSnapshot.serverState[KEY_SYNC_MAINDATA_ADD_TORRENTS_PROCESSED] = m_addTorrentsProcessedCount;
+    m_maindataSnapshot.serverState[KEY_SYNC_MAINDATA_ADD_TORRENTS_TOTAL] = m_addTorrentsTotalCount;
 }
 
 QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fullUpdate)
@@ -633,8 +720,11 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
     for (const QString &tag : asConst(m_removedTags))
         m_maindataSyncBuf.tags.removeOne(tag);
 
-    for (const BitTorrent::TorrentID &torrentID : asConst(m_updatedTorrents))
-        m_maindataSyncBuf.removedTorrents.removeOne(torrentID.toString());
+    const QList<BitTorrent::Torrent *> updatedTorrents = markedTorrents(m_updatedTorrents);
+    const QList<BitTorrent::Torrent *> announcedTorrents = markedTorrents(m_announcedTorrents);
+
+    for (const BitTorrent::Torrent *torrent : updatedTorrents)
+        m_maindataSyncBuf.removedTorrents.removeOne(torrent->id().toString());
 
     for (const BitTorrent::TorrentID &torrentID : asConst(m_removedTorrents))
     {
@@ -687,18 +777,15 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
     }
     m_removedTags.clear();
 
-    for (const BitTorrent::TorrentID &torrentID : asConst(m_updatedTorrents))
+    for (const BitTorrent::Torrent *torrent : updatedTorrents)
     {
-        const BitTorrent::Torrent *torrent = session->getTorrent(torrentID);
-        Q_ASSERT(torrent);
-
         QVariantMap serializedTorrent = serialize(*torrent);
         serializedTorrent.remove(KEY_TORRENT_ID);
 
-        const QString torrentIDStr = torrentID.toString();
+        const QString torrentIDStr = torrent->id().toString();
         auto &torrentSnapshot = m_maindataSnapshot.torrents[torrentIDStr];
 
-        if (m_announcedTorrents.contains(torrentID))
+        if (isTorrentMarked(m_announcedTorrents, torrent))
         {
             addAnnounceStats(serializedTorrent, torrent);
         }
@@ -716,15 +803,12 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
         }
     }
 
-    for (const BitTorrent::TorrentID &torrentID : asConst(m_announcedTorrents))
+    for (const BitTorrent::Torrent *torrent : announcedTorrents)
     {
-        if (m_updatedTorrents.contains(torrentID))
+        if (isTorrentMarked(m_updatedTorrents, torrent))
             continue;
 
-        const BitTorrent::Torrent *torrent = session->getTorrent(torrentID);
-        Q_ASSERT(torrent);
-
-        const QString torrentIDStr = torrentID.toString();
+        const QString torrentIDStr = torrent->id().toString();
         auto &torrentSnapshot = m_maindataSnapshot.torrents[torrentIDStr];
 
         // Only announce stats are changed so don't need to serialize torrent again
@@ -738,8 +822,8 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
         }
     }
 
-    m_updatedTorrents.clear();
-    m_announcedTorrents.clear();
+    m_updatedTorrents.fill(false);
+    m_announcedTorrents.fill(false);
 
     for (const BitTorrent::TorrentID &torrentID : asConst(m_removedTorrents))
     {
@@ -752,7 +836,7 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
 
     for (const QString &tracker : asConst(m_updatedTrackers))
     {
-        const QStringList serializedTorrentIDs = asStrings(m_knownTrackers[tracker]);
+        const QStringList serializedTorrentIDs = asStrings(session->trackerIndex()->torrentsByTracker(tracker));
 
         m_maindataSyncBuf.trackers[tracker] = serializedTorrentIDs;
         m_maindataSnapshot.trackers[tracker] = serializedTorrentIDs;
@@ -772,6 +856,8 @@ QJsonObject SyncController::generateMaindataSyncData(const int id, const bool fu
     serverState[KEY_SYNC_MAINDATA_USE_ALT_SPEED_LIMITS] = session->isAltGlobalSpeedLimitEnabled();
     serverState[KEY_SYNC_MAINDATA_REFRESH_INTERVAL] = session->refreshInterval();
     serverState[KEY_SYNC_MAINDATA_USE_SUBCATEGORIES] = session->isSubcategoriesEnabled();
+    serverState[KEY_SYNC_MAINDATA_ADD_TORRENTS_PROCESSED] = m_addTorrentsProcessedCount;
+    serverState[KEY_SYNC_MAINDATA_ADD_TORRENTS_TOTAL] = m_addTorrentsTotalCount;
     if (const QVariantMap syncData = processMap(m_maindataSnapshot.serverState, serverState); !syncData.isEmpty())
     {
         m_maindataSyncBuf.serverState = syncData;
@@ -842,7 +928,7 @@ void SyncController::torrentPeersAction()
 
     const QList<BitTorrent::PeerInfo> peersList = torrent->fetchPeerInfo().takeResult();
 
-    bool resolvePeerCountries = Preferences::instance()->resolvePeerCountries();
+    const bool resolvePeerCountries = Preferences::instance()->snapshot().resolvePeerCountries;
 
     data[KEY_SYNC_TORRENT_PEERS_SHOW_FLAGS] = resolvePeerCountries;
 
@@ -946,153 +1032,92 @@ void SyncController::onTagRemoved(const Tag &tag)
 
 void SyncController::onTorrentAdded(BitTorrent::Torrent *torrent)
 {
-    const BitTorrent::TorrentID torrentID = torrent->id();
-
-    m_removedTorrents.remove(torrentID);
-    m_updatedTorrents.insert(torrentID);
-    m_announcedTorrents.insert(torrentID);
-
-    for (const BitTorrent::TrackerEntryStatus &status : asConst(torrent->trackers()))
-    {
-        m_knownTrackers[status.url].insert(torrentID);
-        m_updatedTrackers.insert(status.url);
-        m_removedTrackers.remove(status.url);
-    }
+    m_removedTorrents.remove(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
+    markTorrent(m_announcedTorrents, torrent);
 }
 
 void SyncController::onTorrentAboutToBeRemoved(BitTorrent::Torrent *torrent)
 {
-    const BitTorrent::TorrentID torrentID = torrent->id();
-
-    m_announcedTorrents.remove(torrentID);
-    m_updatedTorrents.remove(torrentID);
-    m_removedTorrents.insert(torrentID);
-
-    for (const BitTorrent::TrackerEntryStatus &status : asConst(torrent->trackers()))
-    {
-        const auto iter = m_knownTrackers.find(status.url);
-        Q_ASSERT(iter != m_knownTrackers.end());
-        if (iter == m_knownTrackers.end()) [[unlikely]]
-            continue;
-
-        QSet<BitTorrent::TorrentID> &torrentIDs = iter.value();
-        torrentIDs.remove(torrentID);
-        if (torrentIDs.isEmpty())
-        {
-            m_knownTrackers.erase(iter);
-            m_updatedTrackers.remove(status.url);
-            m_removedTrackers.insert(status.url);
-        }
-        else
-        {
-            m_updatedTrackers.insert(status.url);
-        }
-    }
+    // slot of removed torrent can be reused by another one
+    unmarkTorrent(m_announcedTorrents, torrent);
+    unmarkTorrent(m_updatedTorrents, torrent);
+    m_removedTorrents.insert(torrent->id());
 }
 
 void SyncController::onTorrentCategoryChanged(BitTorrent::Torrent *torrent
         , [[maybe_unused]] const QString &oldCategory)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentMetadataReceived(BitTorrent::Torrent *torrent)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentStopped(BitTorrent::Torrent *torrent)
 {
-    m_updatedTorrents.insert(torrent->id());
-    m_announcedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
+    markTorrent(m_announcedTorrents, torrent);
 }
 
 void SyncController::onTorrentStarted(BitTorrent::Torrent *torrent)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentSavePathChanged(BitTorrent::Torrent *torrent)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentSavingModeChanged(BitTorrent::Torrent *torrent)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentTagAdded(BitTorrent::Torrent *torrent, [[maybe_unused]] const Tag &tag)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentTagRemoved(BitTorrent::Torrent *torrent, [[maybe_unused]] const Tag &tag)
 {
-    m_updatedTorrents.insert(torrent->id());
+    markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentsUpdated(const QList<BitTorrent::Torrent *> &torrents)
 {
     for (const BitTorrent::Torrent *torrent : torrents)
-        m_updatedTorrents.insert(torrent->id());
+        markTorrent(m_updatedTorrents, torrent);
 }
 
 void SyncController::onTorrentTrackersChanged(BitTorrent::Torrent *torrent)
 {
-    using namespace BitTorrent;
-
-    const QList<TrackerEntryStatus> trackers = torrent->trackers();
-
-    QSet<QString> currentTrackers;
-    currentTrackers.reserve(trackers.size());
-    for (const TrackerEntryStatus &status : trackers)
-        currentTrackers.insert(status.url);
-
-    const TorrentID torrentID = torrent->id();
-    Algorithm::removeIf(m_knownTrackers
-        , [this, torrentID, currentTrackers](const QString &knownTracker, QSet<TorrentID> &torrentIDs)
-    {
-        if (auto idIter = torrentIDs.find(torrentID)
-                ; (idIter != torrentIDs.end()) && !currentTrackers.contains(knownTracker))
-        {
-            torrentIDs.erase(idIter);
-            if (torrentIDs.isEmpty())
-            {
-                m_updatedTrackers.remove(knownTracker);
-                m_removedTrackers.insert(knownTracker);
-                return true;
-            }
-
-            m_updatedTrackers.insert(knownTracker);
-            return false;
-        }
-
-        if (currentTrackers.contains(knownTracker) && !torrentIDs.contains(torrentID))
-        {
-            torrentIDs.insert(torrentID);
-            m_updatedTrackers.insert(knownTracker);
-            return false;
-        }
+    markTorrent(m_announcedTorrents, torrent);
+}
 
-        return false;
-    });
+void SyncController::onTorrentTrackerEntryStatusesUpdated(const BitTorrent::Torrent *torrent
+        , [[maybe_unused]] const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers)
+{
+    markTorrent(m_announcedTorrents, torrent);
+}
 
-    for (const QString &currentTracker : asConst(currentTrackers))
+void SyncController::onTrackersUpdated(const QSet<QString> &trackers)
+{
+    for (const QString &tracker : trackers)
     {
-        if (!m_knownTrackers.contains(currentTracker))
-        {
-            m_knownTrackers.insert(currentTracker, {torrentID});
-            m_updatedTrackers.insert(currentTracker);
-            m_removedTrackers.remove(currentTracker);
-        }
+        m_updatedTrackers.insert(tracker);
+        m_removedTrackers.remove(tracker);
     }
-
-    m_announcedTorrents.insert(torrentID);
 }
 
-void SyncController::onTorrentTrackerEntryStatusesUpdated(const BitTorrent::Torrent *torrent
-        , [[maybe_unused]] const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers)
+void SyncController::onTrackersRemoved(const QSet<QString> &trackers)
 {
-    m_announcedTorrents.insert(torrent->id());
+    for (const QString &tracker : trackers)
+    {
+        m_updatedTrackers.remove(tracker);
+        m_removedTrackers.insert(tracker);
+    }
 }
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <QBitArray>
 #include <QSet>
 #include <QVariantMap>
 
@@ -53,6 +54,7 @@ public:
 
 public slots:
     void updateFreeDiskSpace(qint64 freeDiskSpace);
+    void updateAddTorrentsProgress(int processedCount, int totalCount);
 
 private slots:
     void maindataAction();
@@ -82,22 +84,24 @@ private:
     void onTorrentTrackersChanged(BitTorrent::Torrent *torrent);
     void onTorrentTrackerEntryStatusesUpdated(const BitTorrent::Torrent *torrent
             , const QHash<QString, BitTorrent::TrackerEntryStatus> &updatedTrackers);
+    void onTrackersUpdated(const QSet<QString> &trackers);
+    void onTrackersRemoved(const QSet<QString> &trackers);
 
     qint64 m_freeDiskSpace = 0;
+    int m_addTorrentsProcessedCount = 0;
+    int m_addTorrentsTotalCount = 0;
 
     QVariantMap m_lastPeersResponse;
     QVariantMap m_lastAcceptedPeersResponse;
 
-    QHash<QString, QSet<BitTorrent::TorrentID>> m_knownTrackers;
-
     QSet<QString> m_updatedCategories;
     QSet<QString> m_removedCategories;
     QSet<QString> m_addedTags;
     QSet<QString> m_removedTags;
     QSet<QString> m_updatedTrackers;
     QSet<QString> m_removedTrackers;
-    QSet<BitTorrent::TorrentID> m_updatedTorrents;
-    QSet<BitTorrent::TorrentID> m_announcedTorrents;
+    QBitArray m_updatedTorrents;
+    QBitArray m_announcedTorrents;
     QSet<BitTorrent::TorrentID> m_removedTorrents;
 
     struct MaindataSyncBuf
@@ -117,6 +121,9 @@ private:
         QVariantMap serverState;
     };
 
+    // Approximate amount of memory held by the buffer (used for memory usage accounting)
+    static qint64 memoryUsage(const MaindataSyncBuf &buf);
+
     MaindataSyncBuf m_maindataSnapshot;
     MaindataSyncBuf m_maindataSyncBuf;
     int m_maindataLastSentID = 0;
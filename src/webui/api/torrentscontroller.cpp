@@ -40,12 +40,15 @@
 #include <QJsonObject>
 #include <QList>
 #include <QRegularExpression>
+#include <QSet>
 #include <QUrl>
 
 #include "base/addtorrentmanager.h"
 #include "base/bittorrent/categoryoptions.h"
 #include "base/bittorrent/downloadpriority.h"
 #include "base/bittorrent/infohash.h"
+#include "base/bittorrent/movestoragejobstatus.h"
+#include "base/bittorrent/recheckqueuestatus.h"
 #include "base/bittorrent/peeraddress.h"
 #include "base/bittorrent/peerinfo.h"
 #include "base/bittorrent/session.h"
@@ -62,6 +65,7 @@
 #include "base/search/searchdownloadhandler.h"
 #include "base/search/searchpluginmanager.h"
 #include "base/torrentfilter.h"
+#include "base/torrentfilterindex.h"
 #include "base/utils/datetime.h"
 #include "base/utils/fs.h"
 #include "base/utils/io.h"
@@ -575,12 +579,11 @@ void TorrentsController::infoAction()
     }
 
     const TorrentFilter torrentFilter {filter, idSet, category, tag, isPrivate};
+    const QList<BitTorrent::Torrent *> torrents = BitTorrent::Session::instance()->torrentFilterIndex()->torrents(torrentFilter);
     QVariantList torrentList;
-    for (const BitTorrent::Torrent *torrent : asConst(BitTorrent::Session::instance()->torrents()))
+    torrentList.reserve(torrents.size());
+    for (const BitTorrent::Torrent *torrent : torrents)
     {
-        if (!torrentFilter.match(torrent))
-            continue;
-
         QVariantMap serializedTorrent = serialize(*torrent);
 
         if (includeFiles && torrent->hasMetadata())
@@ -1176,24 +1179,11 @@ void TorrentsController::addAction()
     }
 
     // process uploaded .torrent files
-    for (auto it = torrents.constBegin(); it != torrents.constEnd(); ++it)
+    // they are loaded in bulk by worker threads so the result is reported asynchronously
+    if (!torrents.isEmpty())
     {
-        if (const auto loadResult = BitTorrent::TorrentDescriptor::load(it.value()))
-        {
-            const BitTorrent::TorrentDescriptor &torrentDescr = loadResult.value();
-            if (BitTorrent::Session::instance()->addTorrent(torrentDescr, addTorrentParams))
-            {
-                addedTorrentIDs.append(torrentDescr.infoHash().toTorrentID());
-            }
-            else
-            {
-                ++failure;
-            }
-        }
-        else
-        {
-            throw APIError(APIErrorType::BadData, tr("Error: '%1' is not a valid torrent file.").arg(it.key()));
-        }
+        app()->addTorrentManager()->addTorrentsData(torrents, addTorrentParams);
+        pending += torrents.size();
     }
 
     if (!addedTorrentIDs.isEmpty() || (pending > 0))
@@ -1701,6 +1691,105 @@ void TorrentsController::setDownloadPathAction()
     setResult(QString());
 }
 
+// Returns storage move jobs in JSON format, active ones are listed first.
+// The dictionary keys are:
+//   - "hash": Torrent hash (ID)
+//   - "path": Destination path
+//   - "priority": Job priority, queued jobs with higher priority are started first
+//   - "active": Whether the job is being performed
+//   - "size": Amount of data to be moved
+//   - "elapsed": Seconds passed since job was started
+//   - "throughput": Estimated speed in bytes per second, -1 if unknown
+//   - "eta": Estimated seconds remaining to finish the job, -1 if unknown
+void TorrentsController::moveJobsAction()
+{
+    QList<BitTorrent::MoveStorageJobStatus> jobs = BitTorrent::Session::instance()->moveStorageJobs();
+    std::ranges::stable_partition(jobs, &BitTorrent::MoveStorageJobStatus::isActive);
+
+    QJsonArray jobsArray;
+    for (const BitTorrent::MoveStorageJobStatus &job : asConst(jobs))
+    {
+        jobsArray << QJsonObject {
+            {u"hash"_s, job.torrentID.toString()},
+            {u"path"_s, job.path.toString()},
+            {u"priority"_s, job.priority},
+            {u"active"_s, job.isActive},
+            {u"size"_s, job.size},
+            {u"elapsed"_s, job.elapsedTime},
+            {u"throughput"_s, job.throughput},
+            {u"eta"_s, job.eta}
+        };
+    }
+
+    setResult(jobsArray);
+}
+
+void TorrentsController::setMovePriorityAction()
+{
+    requireParams({u"hashes"_s, u"priority"_s});
+
+    const QStringList hashes {params()[u"hashes"_s].split(u'|')};
+    const std::optional<int> priority = parseInt(params()[u"priority"_s]);
+    if (!priority)
+        throw APIError(APIErrorType::BadParams, tr("Priority must be an integer"));
+
+    applyToTorrents(hashes, [priority](const BitTorrent::Torrent *torrent)
+    {
+        BitTorrent::Session::instance()->setMoveStorageJobPriority(torrent->id(), *priority);
+    });
+
+    setResult(QString());
+}
+
+// Returns the state of the recheck queue in JSON format.
+// The dictionary keys are:
+//   - "paused": Whether the queue is paused
+//   - "queued": Number of jobs waiting to be started
+//   - "active": Number of jobs being performed
+//   - "total_size": Amount of data of the jobs enqueued since the queue was last empty
+//   - "checked_size": Amount of data checked so far
+//   - "rate": Checking speed in bytes per second, -1 if unknown
+//   - "eta": Estimated seconds remaining to finish all the jobs, -1 if unknown
+//   - "jobs": List of jobs, each having "hash", "size", "active" and "progress"
+void TorrentsController::recheckQueueAction()
+{
+    const BitTorrent::RecheckQueueStatus status = BitTorrent::Session::instance()->recheckQueueStatus();
+
+    QJsonArray jobsArray;
+    for (const BitTorrent::RecheckJobStatus &job : status.jobs)
+    {
+        jobsArray << QJsonObject {
+            {u"hash"_s, job.torrentID.toString()},
+            {u"size"_s, job.size},
+            {u"active"_s, job.isActive},
+            {u"progress"_s, job.progress}
+        };
+    }
+
+    setResult(QJsonObject {
+        {u"paused"_s, status.isPaused},
+        {u"queued"_s, status.queuedCount},
+        {u"active"_s, status.activeCount},
+        {u"total_size"_s, status.totalSize},
+        {u"checked_size"_s, status.checkedSize},
+        {u"rate"_s, status.rate},
+        {u"eta"_s, status.eta},
+        {u"jobs"_s, jobsArray}
+    });
+}
+
+void TorrentsController::pauseRecheckQueueAction()
+{
+    BitTorrent::Session::instance()->setRecheckQueuePaused(true);
+    setResult(QString());
+}
+
+void TorrentsController::resumeRecheckQueueAction()
+{
+    BitTorrent::Session::instance()->setRecheckQueuePaused(false);
+    setResult(QString());
+}
+
 void TorrentsController::renameAction()
 {
     requireParams({u"hash"_s, u"name"_s});
@@ -1846,6 +1935,7 @@ void TorrentsController::editCategoryAction()
 
     const Path savePath {params()[u"savePath"_s]};
     const auto useDownloadPath = parseBool(params()[u"downloadPathEnabled"_s]);
+    const BitTorrent::CategoryOptions currentOptions = BitTorrent::Session::instance()->categoryOptions(category);
     BitTorrent::CategoryOptions categoryOptions;
     categoryOptions.savePath = savePath;
     if (useDownloadPath.has_value())
@@ -1853,6 +1943,9 @@ void TorrentsController::editCategoryAction()
         const Path downloadPath {params()[u"downloadPath"_s]};
         categoryOptions.downloadPath = {useDownloadPath.value(), downloadPath};
     }
+    // speed limits are changed using "transfer/setBandwidthGroupLimits"
+    categoryOptions.downloadLimit = currentOptions.downloadLimit;
+    categoryOptions.uploadLimit = currentOptions.uploadLimit;
 
     if (!BitTorrent::Session::instance()->editCategory(category, categoryOptions))
         throw APIError(APIErrorType::Conflict, tr("Unable to edit category"));
@@ -104,6 +104,11 @@ private slots:
     void setLocationAction();
     void setSavePathAction();
     void setDownloadPathAction();
+    void moveJobsAction();
+    void setMovePriorityAction();
+    void recheckQueueAction();
+    void pauseRecheckQueueAction();
+    void resumeRecheckQueueAction();
     void setAutoManagementAction();
     void setSuperSeedingAction();
     void setForceStartAction();
@@ -28,14 +28,19 @@
 
 #include "transfercontroller.h"
 
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QList>
 
+#include "base/bittorrent/bandwidthgroup.h"
+#include "base/bittorrent/categoryoptions.h"
 #include "base/bittorrent/peeraddress.h"
 #include "base/bittorrent/peerinfo.h"
+#include "base/bittorrent/seedingoptimizer.h"
 #include "base/bittorrent/session.h"
 #include "base/bittorrent/sessionstatus.h"
 #include "base/global.h"
+#include "base/utils/datetime.h"
 #include "base/utils/string.h"
 #include "apierror.h"
 
@@ -50,6 +55,26 @@ const QString KEY_TRANSFER_LAST_EXTERNAL_ADDRESS_V6 = u"last_external_address_v6
 const QString KEY_TRANSFER_DHT_NODES = u"dht_nodes"_s;
 const QString KEY_TRANSFER_CONNECTION_STATUS = u"connection_status"_s;
 
+const QString KEY_BANDWIDTH_GROUP_TYPE = u"type"_s;
+const QString KEY_BANDWIDTH_GROUP_NAME = u"name"_s;
+const QString KEY_BANDWIDTH_GROUP_DLRATELIMIT = u"dl_rate_limit"_s;
+const QString KEY_BANDWIDTH_GROUP_UPRATELIMIT = u"up_rate_limit"_s;
+const QString KEY_BANDWIDTH_GROUP_DLSPEED = u"dl_speed"_s;
+const QString KEY_BANDWIDTH_GROUP_UPSPEED = u"up_speed"_s;
+const QString KEY_BANDWIDTH_GROUP_TORRENTS = u"torrents"_s;
+
+const QString KEY_SEEDING_OPTIMIZER_ENABLED = u"enabled"_s;
+const QString KEY_SEEDING_OPTIMIZER_SIMULATION = u"simulation"_s;
+const QString KEY_SEEDING_OPTIMIZER_LAST_RUN = u"last_run"_s;
+const QString KEY_SEEDING_OPTIMIZER_LAST_RUN_DURATION = u"last_run_duration"_s;
+const QString KEY_SEEDING_OPTIMIZER_CANDIDATES = u"candidates"_s;
+const QString KEY_SEEDING_OPTIMIZER_SLOTS = u"slots"_s;
+const QString KEY_SEEDING_OPTIMIZER_ACTIVE = u"active"_s;
+const QString KEY_SEEDING_OPTIMIZER_IDLE_ACTIVE = u"idle_active"_s;
+const QString KEY_SEEDING_OPTIMIZER_STARTED = u"started"_s;
+const QString KEY_SEEDING_OPTIMIZER_QUEUED = u"queued"_s;
+const QString KEY_SEEDING_OPTIMIZER_TOTAL_ROTATIONS = u"total_rotations"_s;
+
 // Returns the global transfer information in JSON format.
 // The return value is a JSON-formatted dictionary.
 // The dictionary keys are:
@@ -160,3 +185,96 @@ void TransferController::banPeersAction()
 
     setResult(QString());
 }
+
+// Returns the bandwidth groups formed by categories and tags with speed limits.
+// Each group contains:
+//   - "type": "category" or "tag"
+//   - "name": Category or tag name
+//   - "dl_rate_limit", "up_rate_limit": Group speed limits (0 means unlimited)
+//   - "dl_speed", "up_speed": Total payload rates of the group torrents
+//   - "torrents": Number of torrents in the group
+void TransferController::bandwidthGroupsAction()
+{
+    QJsonArray result;
+    for (const BitTorrent::BandwidthGroupStatus &group : asConst(BitTorrent::Session::instance()->bandwidthGroups()))
+    {
+        result.append(QJsonObject {
+            {KEY_BANDWIDTH_GROUP_TYPE, ((group.type == BitTorrent::BandwidthGroupType::Category) ? u"category"_s : u"tag"_s)},
+            {KEY_BANDWIDTH_GROUP_NAME, group.name},
+            {KEY_BANDWIDTH_GROUP_DLRATELIMIT, group.limits.downloadLimit},
+            {KEY_BANDWIDTH_GROUP_UPRATELIMIT, group.limits.uploadLimit},
+            {KEY_BANDWIDTH_GROUP_DLSPEED, group.downloadRate},
+            {KEY_BANDWIDTH_GROUP_UPSPEED, group.uploadRate},
+            {KEY_BANDWIDTH_GROUP_TORRENTS, group.torrentsCount}
+        });
+    }
+
+    setResult(result);
+}
+
+// Returns the statistics of the last seeding optimizer run.
+// In simulation mode "started" and "queued" hold the torrents the optimizer would have
+// started and queued, "active" and "idle_active" are projected as well.
+void TransferController::seedingOptimizerAction()
+{
+    const auto toJsonArray = [](const QList<BitTorrent::TorrentID> &torrentIDs)
+    {
+        QJsonArray result;
+        for (const BitTorrent::TorrentID &torrentID : torrentIDs)
+            result.append(torrentID.toString());
+        return result;
+    };
+
+    const BitTorrent::SeedingOptimizerStatus status = BitTorrent::Session::instance()->seedingOptimizerStatus();
+    setResult(QJsonObject {
+        {KEY_SEEDING_OPTIMIZER_ENABLED, status.isEnabled},
+        {KEY_SEEDING_OPTIMIZER_SIMULATION, status.isSimulation},
+        {KEY_SEEDING_OPTIMIZER_LAST_RUN, Utils::DateTime::toSecsSinceEpoch(status.lastRunTime)},
+        {KEY_SEEDING_OPTIMIZER_LAST_RUN_DURATION, status.lastRunDuration},
+        {KEY_SEEDING_OPTIMIZER_CANDIDATES, status.candidatesCount},
+        {KEY_SEEDING_OPTIMIZER_SLOTS, status.slotsCount},
+        {KEY_SEEDING_OPTIMIZER_ACTIVE, status.activeCount},
+        {KEY_SEEDING_OPTIMIZER_IDLE_ACTIVE, status.idleActiveCount},
+        {KEY_SEEDING_OPTIMIZER_STARTED, toJsonArray(status.lastPlan.activate)},
+        {KEY_SEEDING_OPTIMIZER_QUEUED, toJsonArray(status.lastPlan.deactivate)},
+        {KEY_SEEDING_OPTIMIZER_TOTAL_ROTATIONS, status.totalRotations}
+    });
+}
+
+void TransferController::setBandwidthGroupLimitsAction()
+{
+    const std::optional<int> downloadLimit = Utils::String::parseInt(params().value(u"dlLimit"_s, u"0"_s));
+    if (!downloadLimit || (*downloadLimit < 0))
+        throw APIError(APIErrorType::BadParams, tr("'dlLimit': invalid argument"));
+
+    const std::optional<int> uploadLimit = Utils::String::parseInt(params().value(u"upLimit"_s, u"0"_s));
+    if (!uploadLimit || (*uploadLimit < 0))
+        throw APIError(APIErrorType::BadParams, tr("'upLimit': invalid argument"));
+
+    auto *session = BitTorrent::Session::instance();
+    if (params().contains(u"category"_s))
+    {
+        const QString category = params()[u"category"_s];
+        if (!session->categories().contains(category))
+            throw APIError(APIErrorType::NotFound, tr("Category does not exist"));
+
+        BitTorrent::CategoryOptions options = session->categoryOptions(category);
+        options.downloadLimit = *downloadLimit;
+        options.uploadLimit = *uploadLimit;
+        session->editCategory(category, options);
+    }
+    else if (params().contains(u"tag"_s))
+    {
+        const Tag tag {params()[u"tag"_s]};
+        if (!session->hasTag(tag))
+            throw APIError(APIErrorType::NotFound, tr("Tag does not exist"));
+
+        session->setTagSpeedLimits(tag, {.downloadLimit = *downloadLimit, .uploadLimit = *uploadLimit});
+    }
+    else
+    {
+        throw APIError(APIErrorType::BadParams, tr("Missing required parameter: 'category' or 'tag'"));
+    }
+
+    setResult(QString());
+}
@@ -48,4 +48,7 @@ private slots:
     void setUploadLimitAction();
     void setDownloadLimitAction();
     void banPeersAction();
+    void bandwidthGroupsAction();
+    void setBandwidthGroupLimitsAction();
+    void seedingOptimizerAction();
 };
@@ -44,6 +44,7 @@
 #include <QThread>
 #include <QUrl>
 
+#include "base/addtorrentmanager.h"
 #include "base/algorithm.h"
 #include "base/bittorrent/session.h"
 #include "base/bittorrent/torrentcreationmanager.h"
@@ -824,6 +825,7 @@ void WebApplication::sessionStartImpl(const QString &sessionId, const bool useCo
     auto *syncController = new SyncController(app(), m_currentSession);
     syncController->updateFreeDiskSpace(btSession->freeDiskSpace());
     connect(btSession, &BitTorrent::Session::freeDiskSpaceChecked, syncController, &SyncController::updateFreeDiskSpace);
+    connect(app()->addTorrentManager(), &AddTorrentManager::addTorrentsProgress, syncController, &SyncController::updateAddTorrentsProgress);
     m_currentSession->registerAPIController(u"sync"_s, syncController);
 
     if (useCookie)
@@ -57,7 +57,7 @@
 
 using namespace std::chrono_literals;
 
-inline const Utils::Version<3, 2> API_VERSION {2, 14, 1};
+inline const Utils::Version<3, 2> API_VERSION {2, 14, 2};
 
 class APIController;
 class AuthController;
@@ -205,6 +205,7 @@ private:
         {{u"torrents"_s, u"filePrio"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"increasePrio"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"parseMetadata"_s}, Http::METHOD_POST},
+        {{u"torrents"_s, u"pauseRecheckQueue"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"reannounce"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"recheck"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"removeCategories"_s}, Http::METHOD_POST},
@@ -214,6 +215,7 @@ private:
         {{u"torrents"_s, u"rename"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"renameFile"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"renameFolder"_s}, Http::METHOD_POST},
+        {{u"torrents"_s, u"resumeRecheckQueue"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setAutoManagement"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setCategory"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setComment"_s}, Http::METHOD_POST},
@@ -221,12 +223,14 @@ private:
         {{u"torrents"_s, u"setDownloadPath"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setForceStart"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setLocation"_s}, Http::METHOD_POST},
+        {{u"torrents"_s, u"setMovePriority"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setSavePath"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setShareLimits"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setSSLParameters"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setSuperSeeding"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setTags"_s}, Http::METHOD_POST},
         {{u"torrents"_s, u"setUploadLimit"_s}, Http::METHOD_POST},
+        {{u"transfer"_s, u"setBandwidthGroupLimits"_s}, Http::METHOD_POST},
         {{u"transfer"_s, u"setDownloadLimit"_s}, Http::METHOD_POST},
         {{u"transfer"_s, u"setSpeedLimitsMode"_s}, Http::METHOD_POST},
         {{u"transfer"_s, u"setUploadLimit"_s}, Http::METHOD_POST},
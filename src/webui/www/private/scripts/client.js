@@ -1094,6 +1094,19 @@ window.addEventListener("DOMContentLoaded", (event) => {
                 : "")
             + window.qBittorrent.Client.mainTitle();
 
+        const addTorrentsProgressElement = document.getElementById("addTorrentsProgress");
+        if (serverState.add_torrents_processed < serverState.add_torrents_total) {
+            addTorrentsProgressElement.textContent = "QBT_TR(Adding torrents: %1/%2)QBT_TR[CONTEXT=StatusBar]"
+                .replace("%1", serverState.add_torrents_processed)
+                .replace("%2", serverState.add_torrents_total);
+            addTorrentsProgressElement.classList.remove("invisible");
+            addTorrentsProgressElement.nextElementSibling.classList.remove("invisible");
+        }
+        else {
+            addTorrentsProgressElement.classList.add("invisible");
+            addTorrentsProgressElement.nextElementSibling.classList.add("invisible");
+        }
+
         document.getElementById("freeSpaceOnDisk").textContent = "QBT_TR(Free space: %1)QBT_TR[CONTEXT=HttpServer]".replace("%1", window.qBittorrent.Misc.friendlyUnit(serverState.free_space_on_disk));
 
         const externalIPsElement = document.getElementById("externalIPs");
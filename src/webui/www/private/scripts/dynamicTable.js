@@ -1957,77 +1957,14 @@ window.qBittorrent.DynamicTable ??= (() => {
             this.columns["pubDate"].updateTd = displayDate;
         }
 
-        getFilteredAndSortedRows() {
-            const getSizeFilters = () => {
-                let minSize = (window.qBittorrent.Search.searchSizeFilter.min > 0) ? (window.qBittorrent.Search.searchSizeFilter.min * Math.pow(1024, window.qBittorrent.Search.searchSizeFilter.minUnit)) : 0;
-                let maxSize = (window.qBittorrent.Search.searchSizeFilter.max > 0) ? (window.qBittorrent.Search.searchSizeFilter.max * Math.pow(1024, window.qBittorrent.Search.searchSizeFilter.maxUnit)) : 0;
-
-                if ((minSize > maxSize) && (maxSize > 0)) {
-                    const tmp = minSize;
-                    minSize = maxSize;
-                    maxSize = tmp;
-                }
-
-                return {
-                    min: minSize,
-                    max: maxSize
-                };
-            };
-
-            const getSeedsFilters = () => {
-                let minSeeds = (window.qBittorrent.Search.searchSeedsFilter.min > 0) ? window.qBittorrent.Search.searchSeedsFilter.min : 0;
-                let maxSeeds = (window.qBittorrent.Search.searchSeedsFilter.max > 0) ? window.qBittorrent.Search.searchSeedsFilter.max : 0;
-
-                if ((minSeeds > maxSeeds) && (maxSeeds > 0)) {
-                    const tmp = minSeeds;
-                    minSeeds = maxSeeds;
-                    maxSeeds = tmp;
-                }
-
-                return {
-                    min: minSeeds,
-                    max: maxSeeds
-                };
-            };
-
-            let filteredRows = [];
-            const searchTerms = window.qBittorrent.Search.searchText.pattern.toLowerCase().split(" ");
-            const filterTerms = window.qBittorrent.Search.searchText.filterPattern.toLowerCase().split(" ");
-            const sizeFilters = getSizeFilters();
-            const seedsFilters = getSeedsFilters();
-            const searchInTorrentName = document.getElementById("searchInTorrentName").value === "names";
-
-            if (searchInTorrentName || (filterTerms.length > 0) || (window.qBittorrent.Search.searchSizeFilter.min > 0) || (window.qBittorrent.Search.searchSizeFilter.max > 0)) {
-                for (const row of this.getRowValues()) {
-
-                    if (searchInTorrentName && !window.qBittorrent.Misc.containsAllTerms(row.full_data.fileName, searchTerms))
-                        continue;
-                    if ((filterTerms.length > 0) && !window.qBittorrent.Misc.containsAllTerms(row.full_data.fileName, filterTerms))
-                        continue;
-                    if ((sizeFilters.min > 0) && (row.full_data.fileSize < sizeFilters.min))
-                        continue;
-                    if ((sizeFilters.max > 0) && (row.full_data.fileSize > sizeFilters.max))
-                        continue;
-                    if ((seedsFilters.min > 0) && (row.full_data.nbSeeders < seedsFilters.min))
-                        continue;
-                    if ((seedsFilters.max > 0) && (row.full_data.nbSeeders > seedsFilters.max))
-                        continue;
-
-                    filteredRows.push(row);
-                }
-            }
-            else {
-                filteredRows = [...this.getRowValues()];
-            }
-
-            const column = this.columns[this.sortedColumn];
-            const isReverseSort = (this.reverseSort === "0");
-            filteredRows.sort((row1, row2) => {
-                const result = column.compareRows(row1, row2);
-                return isReverseSort ? result : -result;
-            });
+        setSortedColumn(column, reverse = null) {
+            super.setSortedColumn(column, reverse);
+            window.qBittorrent.Search?.searchSortChanged();
+        }
 
-            return filteredRows;
+        getFilteredAndSortedRows() {
+            // rows are filtered and sorted by the server
+            return [...this.getRowValues()];
         }
     }
 
@@ -42,6 +42,7 @@ window.qBittorrent.Search ??= (() => {
             searchSeedsFilterChanged: searchSeedsFilterChanged,
             searchSizeFilterChanged: searchSizeFilterChanged,
             searchSizeFilterPrefixChanged: searchSizeFilterPrefixChanged,
+            searchSortChanged: searchFilterChanged,
             closeSearchTab: closeSearchTab,
         };
     };
@@ -66,8 +67,9 @@ window.qBittorrent.Search ??= (() => {
      * sizeFilter: {min: number, minUnit: number, max: number, maxUnit: number},
      * searchIn: string,
      * rows: [],
-     * rowId: number,
-     * selectedRowIds: number[],
+     * total: number,
+     * matched: number,
+     * selectedRowIds: string[],
      * running: boolean,
      * loadResultsTimer: Timer,
      * sort: {column: string, reverse: string},
@@ -226,7 +228,8 @@ window.qBittorrent.Search ??= (() => {
             sizeFilter: { min: searchSizeFilter.min, minUnit: searchSizeFilter.minUnit, max: searchSizeFilter.max, maxUnit: searchSizeFilter.maxUnit },
             searchIn: getSearchInTorrentName(),
             rows: [],
-            rowId: 0,
+            total: 0,
+            matched: 0,
             selectedRowIds: [],
             running: true,
             loadResultsTimer: -1,
@@ -259,7 +262,8 @@ window.qBittorrent.Search ??= (() => {
         // copy over relevant state
         const state = searchState.get(oldSearchId);
         state.rows = [];
-        state.rowId = 0;
+        state.total = 0;
+        state.matched = 0;
         state.selectedRowIds = [];
         state.running = true;
         state.loadResultsTimer = -1;
@@ -407,8 +411,8 @@ window.qBittorrent.Search ??= (() => {
         if (rowsToSelect.length > 0)
             searchResultsTable.reselectRows(rowsToSelect);
 
-        document.getElementById("numSearchResultsVisible").textContent = searchResultsTable.getFilteredAndSortedRows().length;
-        document.getElementById("numSearchResultsTotal").textContent = searchResultsTable.getRowSize();
+        document.getElementById("numSearchResultsVisible").textContent = state ? state.matched : 0;
+        document.getElementById("numSearchResultsTotal").textContent = state ? state.total : 0;
     };
 
     const getStatusIconElement = (text, image) => {
@@ -828,18 +832,74 @@ window.qBittorrent.Search ??= (() => {
     };
 
     const searchFilterChanged = () => {
+        // results are filtered and sorted by the server
+        const searchId = getSelectedSearchId();
+        if (searchState.has(searchId))
+            updateSearchResultsData(searchId);
+    };
+
+    const getSearchResultsQuery = (searchId) => {
+        if (searchId === getSelectedSearchId())
+            saveCurrentTabState();
+
+        const state = searchState.get(searchId);
+        const query = {
+            id: searchId
+        };
+
+        const sortColumn = searchResultsTable.columns[state.sort.column];
+        if (sortColumn) {
+            query.sortBy = sortColumn.name;
+            query.reverse = (state.sort.reverse === "1");
+        }
+
+        const filterTerms = [state.filterPattern];
+        if (state.searchIn === "names")
+            filterTerms.push(state.searchPattern);
+        query.filter = filterTerms.join(" ");
+
+        let minSize = (state.sizeFilter.min > 0) ? Math.round(state.sizeFilter.min * Math.pow(1024, state.sizeFilter.minUnit)) : 0;
+        let maxSize = (state.sizeFilter.max > 0) ? Math.round(state.sizeFilter.max * Math.pow(1024, state.sizeFilter.maxUnit)) : 0;
+        if ((minSize > maxSize) && (maxSize > 0))
+            [minSize, maxSize] = [maxSize, minSize];
+        if (minSize > 0)
+            query.minSize = minSize;
+        if (maxSize > 0)
+            query.maxSize = maxSize;
+
+        let minSeeds = (state.seedsFilter.min > 0) ? Number(state.seedsFilter.min) : 0;
+        let maxSeeds = (state.seedsFilter.max > 0) ? Number(state.seedsFilter.max) : 0;
+        if ((minSeeds > maxSeeds) && (maxSeeds > 0))
+            [minSeeds, maxSeeds] = [maxSeeds, minSeeds];
+        if (minSeeds > 0)
+            query.minSeeders = minSeeds;
+        if (maxSeeds > 0)
+            query.maxSeeders = maxSeeds;
+
+        return query;
+    };
+
+    const showSearchResults = (state) => {
+        // rows are identified by download link so they can be reselected after the results are reordered
+        const selectedRowIds = [...searchResultsTable.selectedRows];
+
+        searchResultsTable.clear();
+        for (const row of state.rows)
+            searchResultsTable.updateRowData(row);
         searchResultsTable.updateTable();
-        document.getElementById("numSearchResultsVisible").textContent = searchResultsTable.getFilteredAndSortedRows().length;
+
+        const rowsToSelect = selectedRowIds.filter((rowId) => searchResultsTable.rows.has(rowId));
+        if (rowsToSelect.length > 0)
+            searchResultsTable.reselectRows(rowsToSelect);
+
+        document.getElementById("numSearchResultsVisible").textContent = state.matched;
+        document.getElementById("numSearchResultsTotal").textContent = state.total;
     };
 
     const loadSearchResultsData = (searchId) => {
         const state = searchState.get(searchId);
         const url = new URL("api/v2/search/results", window.location);
-        url.search = new URLSearchParams({
-            id: searchId,
-            limit: 500,
-            offset: state.rowId
-        });
+        url.search = new URLSearchParams(getSearchResultsQuery(searchId));
         fetch(url, {
                 method: "GET",
                 cache: "no-store"
@@ -861,52 +921,36 @@ window.qBittorrent.Search ??= (() => {
                 document.getElementById("error_div").textContent = "";
 
                 const state = searchState.get(searchId);
-                // check if user stopped the search prior to receiving the response
-                if (!state.running) {
-                    clearTimeout(state.loadResultsTimer);
-                    updateStatusIconElement(searchId, "QBT_TR(Search aborted)QBT_TR[CONTEXT=SearchJobWidget]", "images/task-reject.svg");
+                // the search tab was closed prior to receiving the response
+                if (!state)
                     return;
-                }
 
                 const responseJSON = await response.json();
                 if (responseJSON) {
-                    const state = searchState.get(searchId);
-                    const newRows = [];
-
-                    if (responseJSON.results) {
-                        const results = responseJSON.results;
-                        for (const result of results) {
-                            const row = {
-                                rowId: state.rowId,
-                                descrLink: result.descrLink,
-                                fileName: result.fileName,
-                                fileSize: result.fileSize,
-                                fileUrl: result.fileUrl,
-                                nbLeechers: result.nbLeechers,
-                                nbSeeders: result.nbSeeders,
-                                engineName: result.engineName,
-                                siteUrl: result.siteUrl,
-                                pubDate: result.pubDate,
-                            };
-
-                            newRows.push(row);
-                            state.rows.push(row);
-                            state.rowId += 1;
-                        }
-                    }
+                    state.rows = responseJSON.results.map((result) => ({
+                        rowId: result.fileUrl,
+                        descrLink: result.descrLink,
+                        fileName: result.fileName,
+                        fileSize: result.fileSize,
+                        fileUrl: result.fileUrl,
+                        nbLeechers: result.nbLeechers,
+                        nbSeeders: result.nbSeeders,
+                        engineName: result.engineName,
+                        siteUrl: result.siteUrl,
+                        pubDate: result.pubDate,
+                    }));
+                    state.total = responseJSON.total;
+                    state.matched = responseJSON.matched;
 
                     // only update table if this search is currently being displayed
-                    if (searchId === getSelectedSearchId()) {
-                        for (const row of newRows)
-                            searchResultsTable.updateRowData(row);
+                    if (searchId === getSelectedSearchId())
+                        showSearchResults(state);
 
-                        document.getElementById("numSearchResultsVisible").textContent = searchResultsTable.getFilteredAndSortedRows().length;
-                        document.getElementById("numSearchResultsTotal").textContent = searchResultsTable.getRowSize();
-
-                        searchResultsTable.updateTable();
-                    }
+                    // results of the stopped search are only reloaded when the filters are changed
+                    if (!state.running)
+                        return;
 
-                    if ((responseJSON.status === "Stopped") && (state.rowId >= responseJSON.total)) {
+                    if (responseJSON.status === "Stopped") {
                         resetSearchState(searchId);
                         updateStatusIconElement(searchId, "QBT_TR(Search has finished)QBT_TR[CONTEXT=SearchJobWidget]", "images/task-complete.svg");
                         return;
@@ -0,0 +1,268 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <algorithm>
+
+#include <QAbstractTableModel>
+#include <QApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QList>
+#include <QLocale>
+#include <QObject>
+#include <QScrollBar>
+#include <QTableView>
+#include <QTest>
+
+#include "base/global.h"
+#include "base/utils/misc.h"
+#include "base/utils/string.h"
+#include "gui/displayvaluecache.h"
+
+namespace
+{
+    const int ROW_COUNT = 20000;
+    const int FRAME_COUNT = 300;
+    // as the transfer list is refreshed every 1.5 s by default, while scrolling is much more frequent
+    const int REFRESH_INTERVAL = 5;
+
+    struct Row
+    {
+        qint64 size = 0;
+        qint64 downloaded = 0;
+        qint64 uploaded = 0;
+        qint64 downloadSpeed = 0;
+        qint64 uploadSpeed = 0;
+        qint64 eta = 0;
+        qreal progress = 0;
+        qreal ratio = 0;
+        QDateTime addedTime;
+    };
+
+    // Mimics the columns of the transfer list which values require formatting
+    class BenchmarkModel final : public QAbstractTableModel
+    {
+    public:
+        enum Column
+        {
+            Size,
+            Progress,
+            Downloaded,
+            Uploaded,
+            DownloadSpeed,
+            UploadSpeed,
+            ETA,
+            Ratio,
+            AddedTime,
+
+            ColumnCount
+        };
+
+        explicit BenchmarkModel(const bool useCache)
+            : m_useCache {useCache}
+        {
+            m_rows.reserve(ROW_COUNT);
+            const QDateTime now = QDateTime::currentDateTime();
+            for (int i = 0; i < ROW_COUNT; ++i)
+            {
+                const qint64 size = (i + 1) * 7'340'033LL;
+                m_rows.append({.size = size, .downloaded = (size / 3), .uploaded = (size / 5)
+                    , .downloadSpeed = (i * 1031), .uploadSpeed = (i * 517), .eta = (i * 13)
+                    , .progress = ((i % 100) / 100.0), .ratio = ((i % 300) / 100.0), .addedTime = now.addSecs(-i * 60)});
+            }
+        }
+
+        int rowCount(const QModelIndex &parent = {}) const override
+        {
+            return parent.isValid() ? 0 : m_rows.size();
+        }
+
+        int columnCount(const QModelIndex &parent = {}) const override
+        {
+            return parent.isValid() ? 0 : ColumnCount;
+        }
+
+        QVariant data(const QModelIndex &index, const int role) const override
+        {
+            if (!index.isValid() || (role != Qt::DisplayRole))
+                return {};
+
+            const Row &row = m_rows[index.row()];
+            const int column = index.column();
+            const auto display = [this, &index, column](const auto &format, const auto &value) -> QString
+            {
+                if (!m_useCache)
+                    return format(value);
+                return m_cache.value(index.row(), column, [&format, &value] { return format(value); }, value);
+            };
+
+            const auto unitString = [](const qint64 value) { return Utils::Misc::friendlyUnit(value); };
+            const auto speedString = [](const qint64 value) { return Utils::Misc::friendlyUnit(value, true); };
+            const auto etaString = [](const qint64 value) { return Utils::Misc::userFriendlyDuration(value); };
+            const auto progressString = [](const qreal value) { return (Utils::String::fromDouble((value * 100), 1) + u'%'); };
+            const auto ratioString = [](const qreal value) { return Utils::String::fromDouble(value, 2); };
+            const auto dateString = [](const QDateTime &value) { return QLocale().toString(value.toLocalTime(), QLocale::ShortFormat); };
+
+            switch (column)
+            {
+            case Size:
+                return display(unitString, row.size);
+            case Progress:
+                return display(progressString, row.progress);
+            case Downloaded:
+                return display(unitString, row.downloaded);
+            case Uploaded:
+                return display(unitString, row.uploaded);
+            case DownloadSpeed:
+                return display(speedString, row.downloadSpeed);
+            case UploadSpeed:
+                return display(speedString, row.uploadSpeed);
+            case ETA:
+                return display(etaString, row.eta);
+            case Ratio:
+                return display(ratioString, row.ratio);
+            case AddedTime:
+                return display(dateString, row.addedTime);
+            default:
+                return {};
+            }
+        }
+
+        // Updates the transient values of the visible rows like the session does for active torrents
+        void refresh(const int firstRow, const int lastRow)
+        {
+            for (int i = firstRow; i <= lastRow; ++i)
+            {
+                Row &row = m_rows[i];
+                row.downloadSpeed = (row.downloadSpeed + 1024) % (10 * 1024 * 1024);
+                row.eta = std::max<qint64>((row.eta - 1), 0);
+            }
+
+            emit dataChanged(index(firstRow, 0), index(lastRow, (ColumnCount - 1)));
+        }
+
+    private:
+        const bool m_useCache = false;
+        QList<Row> m_rows;
+        mutable DisplayValueCache<int> m_cache {ColumnCount};
+    };
+
+    struct FrameStats
+    {
+        double mean = 0;
+        double median = 0;
+        double p95 = 0;
+        double max = 0;
+    };
+
+    FrameStats measureFrames(const bool useCache)
+    {
+        BenchmarkModel model {useCache};
+        QTableView view;
+        view.setModel(&model);
+        view.resize(1280, 800);
+        view.show();
+        QCoreApplication::processEvents();
+
+        QScrollBar *scrollBar = view.verticalScrollBar();
+        QList<double> frameTimes;
+        frameTimes.reserve(FRAME_COUNT);
+
+        QElapsedTimer timer;
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            timer.start();
+
+            // scroll back and forth by a few rows, as the user would do with the mouse wheel
+            const int step = (((frame / 50) % 2) == 0) ? 3 : -3;
+            scrollBar->setValue(std::clamp((scrollBar->value() + step), scrollBar->minimum(), scrollBar->maximum()));
+
+            if ((frame % REFRESH_INTERVAL) == 0)
+            {
+                const int firstRow = std::max(view.rowAt(0), 0);
+                const int lastRow = view.rowAt(view.viewport()->height() - 1);
+                model.refresh(firstRow, ((lastRow >= firstRow) ? lastRow : (ROW_COUNT - 1)));
+            }
+
+            view.viewport()->repaint();
+            frameTimes.append(timer.nsecsElapsed() / 1'000'000.0);
+        }
+
+        std::ranges::sort(frameTimes);
+        double total = 0;
+        for (const double time : asConst(frameTimes))
+            total += time;
+
+        return {
+            .mean = (total / frameTimes.size()),
+            .median = frameTimes[frameTimes.size() / 2],
+            .p95 = frameTimes[(frameTimes.size() * 95) / 100],
+            .max = frameTimes.last()
+        };
+    }
+
+    void report(const char *name, const FrameStats &stats)
+    {
+        qInfo("%s: mean %.3f ms, median %.3f ms, p95 %.3f ms, max %.3f ms"
+            , name, stats.mean, stats.median, stats.p95, stats.max);
+    }
+}
+
+class BenchTransferListView final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(BenchTransferListView)
+
+public:
+    BenchTransferListView() = default;
+
+private slots:
+    void testCachedValues() const
+    {
+        const BenchmarkModel uncachedModel {false};
+        const BenchmarkModel cachedModel {true};
+        for (int row = 0; row < ROW_COUNT; row += 997)
+        {
+            for (int column = 0; column < BenchmarkModel::ColumnCount; ++column)
+            {
+                QCOMPARE(cachedModel.index(row, column).data(), uncachedModel.index(row, column).data());
+                // second read is served from the cache
+                QCOMPARE(cachedModel.index(row, column).data(), uncachedModel.index(row, column).data());
+            }
+        }
+    }
+
+    void benchScrollAndRefresh() const
+    {
+        report("Uncached display values", measureFrames(false));
+        report("Cached display values", measureFrames(true));
+    }
+};
+
+QTEST_MAIN(BenchTransferListView)
+#include "benchtransferlistview.moc"
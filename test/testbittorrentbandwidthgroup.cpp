@@ -0,0 +1,70 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QObject>
+#include <QTest>
+
+#include "base/bittorrent/bandwidthgroup.h"
+#include "base/global.h"
+
+class TestBittorrentBandwidthGroup final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestBittorrentBandwidthGroup)
+
+public:
+    TestBittorrentBandwidthGroup() = default;
+
+private slots:
+    void testShareBandwidthEmpty() const
+    {
+        QCOMPARE(BitTorrent::shareBandwidth(100, {}), QList<int>());
+    }
+
+    void testShareBandwidthSaturated() const
+    {
+        // the smallest demand is satisfied, the others share the rest equally
+        QCOMPARE(BitTorrent::shareBandwidth(100, {50, 10, 80}), (QList<int> {45, 10, 45}));
+        QCOMPARE(BitTorrent::shareBandwidth(90, {100, 100, 100}), (QList<int> {30, 30, 30}));
+    }
+
+    void testShareBandwidthUnsaturated() const
+    {
+        // unused bandwidth is spread over all the members
+        QCOMPARE(BitTorrent::shareBandwidth(100, {10, 20}), (QList<int> {45, 55}));
+    }
+
+    void testShareBandwidthNeverUnlimited() const
+    {
+        // zero share would mean "unlimited" for libtorrent
+        QCOMPARE(BitTorrent::shareBandwidth(1, {0, 0, 0}), (QList<int> {1, 1, 1}));
+    }
+};
+
+QTEST_APPLESS_MAIN(TestBittorrentBandwidthGroup)
+#include "testbittorrentbandwidthgroup.moc"
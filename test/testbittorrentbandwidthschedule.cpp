@@ -0,0 +1,116 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+
+#include <QDateTime>
+#include <QObject>
+#include <QTest>
+#include <QTimeZone>
+
+#include "base/bittorrent/bandwidthschedule.h"
+#include "base/global.h"
+
+using namespace BitTorrent;
+
+namespace
+{
+    // 2024-01-01 is Monday
+    QDateTime dateTime(const int day, const int hour, const int minute = 0)
+    {
+        return {QDate(2024, 1, day), QTime(hour, minute), QTimeZone::UTC};
+    }
+
+    BandwidthScheduleRule overnightRule()
+    {
+        return {.days = 0x01, .startTime = QTime(22, 0), .endTime = QTime(6, 0)
+                , .limits = {.downloadLimit = 1000, .uploadLimit = -1}};
+    }
+}
+
+class TestBittorrentBandwidthSchedule final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestBittorrentBandwidthSchedule)
+
+public:
+    TestBittorrentBandwidthSchedule() = default;
+
+private slots:
+    void testIsActiveAt() const
+    {
+        const BandwidthScheduleRule rule = overnightRule();
+        QVERIFY(!rule.isActiveAt(dateTime(1, 21, 59)));
+        QVERIFY(rule.isActiveAt(dateTime(1, 22)));
+        QVERIFY(rule.isActiveAt(dateTime(2, 5, 59)));
+        QVERIFY(!rule.isActiveAt(dateTime(2, 6)));
+        QVERIFY(!rule.isActiveAt(dateTime(2, 23)));
+    }
+
+    void testScheduledLimits() const
+    {
+        const QList<BandwidthScheduleRule> rules {
+            {.limits = {.downloadLimit = 1000, .uploadLimit = 2000}},
+            {.days = 0x1F, .startTime = QTime(9, 0), .endTime = QTime(17, 0), .limits = {.downloadLimit = 500}},
+            {.scope = BandwidthScheduleScope::Category, .groupName = u"Linux"_s, .limits = {.uploadLimit = 0}}
+        };
+
+        const BandwidthScheduleState workTime = scheduledLimits(rules, dateTime(1, 10));
+        QCOMPARE(workTime.global, (BandwidthScheduleLimits {.downloadLimit = 500, .uploadLimit = 2000}));
+        QCOMPARE(workTime.categories.value(u"Linux"_s), (BandwidthScheduleLimits {.downloadLimit = -1, .uploadLimit = 0}));
+        QVERIFY(workTime.tags.isEmpty());
+
+        const BandwidthScheduleState weekend = scheduledLimits(rules, dateTime(6, 10));
+        QCOMPARE(weekend.global, (BandwidthScheduleLimits {.downloadLimit = 1000, .uploadLimit = 2000}));
+    }
+
+    void testNextScheduleTransition() const
+    {
+        const QList<BandwidthScheduleRule> rules {overnightRule()};
+        QCOMPARE(nextScheduleTransition(rules, dateTime(1, 12)), dateTime(1, 22));
+        QCOMPARE(nextScheduleTransition(rules, dateTime(1, 22)), dateTime(2, 6));
+        QCOMPARE(nextScheduleTransition(rules, dateTime(2, 7)), dateTime(8, 22));
+        QVERIFY(!nextScheduleTransition({}, dateTime(1, 12)).isValid());
+    }
+
+    void testRampScheduledLimits() const
+    {
+        const BandwidthScheduleState from {.global = {.downloadLimit = 1000, .uploadLimit = -1}
+                , .categories = {{u"Linux"_s, {.downloadLimit = 100}}}};
+        const BandwidthScheduleState to {.global = {.downloadLimit = 2000, .uploadLimit = 0}};
+
+        // changes from or to non-explicit limits are not ramped
+        const BandwidthScheduleState state = rampScheduledLimits(from, to, 0.25);
+        QCOMPARE(state.global, (BandwidthScheduleLimits {.downloadLimit = 1250, .uploadLimit = 0}));
+        QVERIFY(state.categories.isEmpty());
+
+        QCOMPARE(rampScheduledLimits(from, to, 1), to);
+    }
+};
+
+QTEST_APPLESS_MAIN(TestBittorrentBandwidthSchedule)
+#include "testbittorrentbandwidthschedule.moc"
@@ -0,0 +1,155 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QTest>
+
+#include "base/bittorrent/infohash.h"
+#include "base/bittorrent/queuepositions.h"
+#include "base/global.h"
+
+using namespace BitTorrent;
+
+namespace
+{
+    TorrentID makeID(const int value)
+    {
+        return TorrentID::fromString(u"%1"_s.arg(value, 40, 16, u'0'));
+    }
+
+    bool isInQueueOrder(const QHash<TorrentID, qint64> &positions, const QList<TorrentID> &queue)
+    {
+        if (positions.size() != queue.size())
+            return false;
+
+        qint64 previousKey = -1;
+        for (const TorrentID &torrentID : queue)
+        {
+            const qint64 key = positions.value(torrentID, -1);
+            if (key <= previousKey)
+                return false;
+            previousKey = key;
+        }
+        return true;
+    }
+}
+
+class TestBittorrentQueuePositions final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestBittorrentQueuePositions)
+
+public:
+    TestBittorrentQueuePositions() = default;
+
+private slots:
+    void testInitialAssignment() const
+    {
+        const QList<TorrentID> queue {makeID(1), makeID(2), makeID(3)};
+        QHash<TorrentID, qint64> positions;
+
+        const QueuePositions changed = updateQueuePositions(positions, queue);
+        QCOMPARE(changed.size(), 3);
+        QCOMPARE(positions.value(makeID(1)), QUEUE_POSITION_BASE);
+        QCOMPARE(positions.value(makeID(2)), QUEUE_POSITION_BASE + QUEUE_POSITION_STEP);
+        QCOMPARE(positions.value(makeID(3)), QUEUE_POSITION_BASE + (2 * QUEUE_POSITION_STEP));
+    }
+
+    void testUnchangedQueue() const
+    {
+        const QList<TorrentID> queue {makeID(1), makeID(2), makeID(3)};
+        QHash<TorrentID, qint64> positions;
+        updateQueuePositions(positions, queue);
+        const QHash<TorrentID, qint64> oldPositions = positions;
+
+        QVERIFY(updateQueuePositions(positions, queue).isEmpty());
+        QCOMPARE(positions, oldPositions);
+    }
+
+    void testMoveToTop() const
+    {
+        QHash<TorrentID, qint64> positions;
+        updateQueuePositions(positions, {makeID(1), makeID(2), makeID(3)});
+
+        const QList<TorrentID> queue {makeID(3), makeID(1), makeID(2)};
+        const QueuePositions changed = updateQueuePositions(positions, queue);
+        QCOMPARE(changed.size(), 1);
+        QCOMPARE(changed[0].first, makeID(3));
+        QVERIFY(isInQueueOrder(positions, queue));
+    }
+
+    void testMoveToBottom() const
+    {
+        QHash<TorrentID, qint64> positions;
+        updateQueuePositions(positions, {makeID(1), makeID(2), makeID(3)});
+
+        const QList<TorrentID> queue {makeID(2), makeID(3), makeID(1)};
+        const QueuePositions changed = updateQueuePositions(positions, queue);
+        QCOMPARE(changed.size(), 1);
+        QCOMPARE(changed[0].first, makeID(1));
+        QVERIFY(isInQueueOrder(positions, queue));
+    }
+
+    void testMoveWithinQueue() const
+    {
+        QHash<TorrentID, qint64> positions;
+        updateQueuePositions(positions, {makeID(1), makeID(2), makeID(3), makeID(4)});
+
+        const QList<TorrentID> queue {makeID(1), makeID(3), makeID(2), makeID(4)};
+        QCOMPARE(updateQueuePositions(positions, queue).size(), 1);
+        QVERIFY(isInQueueOrder(positions, queue));
+    }
+
+    void testAddAndRemove() const
+    {
+        QHash<TorrentID, qint64> positions;
+        updateQueuePositions(positions, {makeID(1), makeID(2), makeID(3)});
+
+        const QList<TorrentID> queue {makeID(1), makeID(3), makeID(4)};
+        const QueuePositions changed = updateQueuePositions(positions, queue);
+        QCOMPARE(changed.size(), 1);
+        QCOMPARE(changed[0].first, makeID(4));
+        QVERIFY(!positions.contains(makeID(2)));
+        QVERIFY(isInQueueOrder(positions, queue));
+    }
+
+    void testRenumber() const
+    {
+        QHash<TorrentID, qint64> positions {{makeID(1), 10}, {makeID(2), 11}};
+
+        const QList<TorrentID> queue {makeID(1), makeID(3), makeID(2)};
+        QCOMPARE(updateQueuePositions(positions, queue).size(), 3);
+        QCOMPARE(positions.value(makeID(1)), QUEUE_POSITION_BASE);
+        QVERIFY(isInQueueOrder(positions, queue));
+    }
+};
+
+QTEST_APPLESS_MAIN(TestBittorrentQueuePositions)
+#include "testbittorrentqueuepositions.moc"
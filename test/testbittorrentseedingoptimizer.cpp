@@ -0,0 +1,155 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <chrono>
+
+#include <QList>
+#include <QObject>
+#include <QTest>
+
+#include "base/bittorrent/infohash.h"
+#include "base/bittorrent/seedingoptimizer.h"
+#include "base/global.h"
+
+using namespace std::chrono_literals;
+using namespace BitTorrent;
+
+namespace
+{
+    TorrentID makeID(const int value)
+    {
+        return TorrentID::fromString(u"%1"_s.arg(value, 40, 16, u'0'));
+    }
+
+    SeedingCandidate makeCandidate(const int id, const int seedsCount, const int leechersCount, const bool isActive = false)
+    {
+        return {.id = makeID(id), .seedsCount = seedsCount, .leechersCount = leechersCount, .isActive = isActive};
+    }
+}
+
+class TestBittorrentSeedingOptimizer final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestBittorrentSeedingOptimizer)
+
+public:
+    TestBittorrentSeedingOptimizer() = default;
+
+private slots:
+    void testScoreOrder() const
+    {
+        // more leechers per seed mean higher demand
+        QVERIFY(SeedingOptimizer::score(makeCandidate(1, 1, 10), 0) > SeedingOptimizer::score(makeCandidate(2, 10, 10), 0));
+        QCOMPARE(SeedingOptimizer::score(makeCandidate(1, 0, 0), 0), 0.0);
+
+        // past upload rate is taken into account
+        QVERIFY(SeedingOptimizer::score(makeCandidate(1, 1, 1), 100 * 1024) > SeedingOptimizer::score(makeCandidate(1, 1, 1), 0));
+
+        // torrents far from their ratio limit come first, the ones that reached it come last
+        SeedingCandidate farFromLimit = makeCandidate(1, 1, 10);
+        farFromLimit.ratio = 0.5;
+        farFromLimit.ratioLimit = 2;
+        SeedingCandidate closeToLimit = farFromLimit;
+        closeToLimit.ratio = 1.5;
+        SeedingCandidate reachedLimit = farFromLimit;
+        reachedLimit.ratio = 2;
+        const qreal noLimitScore = SeedingOptimizer::score(makeCandidate(1, 1, 10), 0);
+        QVERIFY(SeedingOptimizer::score(farFromLimit, 0) > SeedingOptimizer::score(closeToLimit, 0));
+        QVERIFY(SeedingOptimizer::score(closeToLimit, 0) > noLimitScore);
+        QVERIFY(SeedingOptimizer::score(reachedLimit, 0) < noLimitScore);
+    }
+
+    void testSlotsLimit() const
+    {
+        const QList<SeedingCandidate> candidates {makeCandidate(1, 0, 1), makeCandidate(2, 0, 10), makeCandidate(3, 0, 5)};
+
+        SeedingOptimizer optimizer;
+        SeedingPlan plan = optimizer.plan(candidates, 2, 0s);
+        QCOMPARE(plan.activate, (QList<TorrentID> {makeID(2), makeID(3)}));
+        QVERIFY(plan.deactivate.isEmpty());
+
+        optimizer.reset();
+        plan = optimizer.plan(candidates, 0, 0s);
+        QVERIFY(plan.activate.isEmpty());
+        QVERIFY(plan.deactivate.isEmpty());
+
+        optimizer.reset();
+        plan = optimizer.plan(candidates, 5, 0s);
+        QCOMPARE(plan.activate.size(), 3);
+    }
+
+    void testRotation() const
+    {
+        const QList<SeedingCandidate> candidates {makeCandidate(1, 0, 1, true), makeCandidate(2, 0, 10)};
+
+        SeedingOptimizer optimizer;
+        // active torrent keeps its slot until it gets a chance to connect to the swarm
+        SeedingPlan plan = optimizer.plan(candidates, 1, 0s);
+        QVERIFY(plan.activate.isEmpty());
+        QVERIFY(plan.deactivate.isEmpty());
+
+        plan = optimizer.plan(candidates, 1, 1h);
+        QCOMPARE(plan.activate, QList<TorrentID> {makeID(2)});
+        QCOMPARE(plan.deactivate, QList<TorrentID> {makeID(1)});
+    }
+
+    void testActiveBonus() const
+    {
+        // active torrent isn't replaced by the one that is only slightly better
+        const QList<SeedingCandidate> candidates {makeCandidate(1, 0, 8, true), makeCandidate(2, 0, 9)};
+
+        SeedingOptimizer optimizer;
+        optimizer.plan(candidates, 1, 0s);
+        const SeedingPlan plan = optimizer.plan(candidates, 1, 1h);
+        QVERIFY(plan.activate.isEmpty());
+        QVERIFY(plan.deactivate.isEmpty());
+    }
+
+    void testSimulation() const
+    {
+        // In simulation mode the plan isn't applied, so the same state is passed again
+        // and the optimizer must come to the same decision instead of assuming it is applied
+        const QList<SeedingCandidate> candidates {makeCandidate(1, 0, 1, true), makeCandidate(2, 0, 10), makeCandidate(3, 0, 5)};
+
+        SeedingOptimizer optimizer;
+        optimizer.plan(candidates, 1, 0s);
+        const SeedingPlan firstPlan = optimizer.plan(candidates, 1, 1h);
+        QCOMPARE(firstPlan.activate, QList<TorrentID> {makeID(2)});
+        QCOMPARE(firstPlan.deactivate, QList<TorrentID> {makeID(1)});
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            const SeedingPlan plan = optimizer.plan(candidates, 1, (1h + (i * 1min)));
+            QCOMPARE(plan.activate, firstPlan.activate);
+            QCOMPARE(plan.deactivate, firstPlan.deactivate);
+        }
+    }
+};
+
+QTEST_APPLESS_MAIN(TestBittorrentSeedingOptimizer)
+#include "testbittorrentseedingoptimizer.moc"
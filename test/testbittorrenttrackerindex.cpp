@@ -0,0 +1,130 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "base/bittorrent/infohash.h"
+#include "base/bittorrent/trackerentrystatus.h"
+#include "base/bittorrent/trackerindex.h"
+#include "base/global.h"
+
+using namespace BitTorrent;
+
+namespace
+{
+    const QString TRACKER_URL = u"http://tracker.example.com/announce"_s;
+
+    TorrentID makeID(const int value)
+    {
+        return TorrentID::fromString(u"%1"_s.arg(value, 40, 16, u'0'));
+    }
+
+    QHash<QString, TrackerEntryStatus> makeStatuses(const TrackerEndpointState state, const bool isUpdating = false)
+    {
+        TrackerEntryStatus status;
+        status.url = TRACKER_URL;
+        status.state = state;
+        status.isUpdating = isUpdating;
+        return {{status.url, status}};
+    }
+}
+
+class TestBittorrentTrackerIndex final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestBittorrentTrackerIndex)
+
+public:
+    TestBittorrentTrackerIndex() = default;
+
+private slots:
+    void testHosts() const
+    {
+        TrackerIndex index;
+        index.setTorrentTrackers(makeID(1), {TRACKER_URL, u"udp://tracker.example.com:80"_s});
+        index.setTorrentTrackers(makeID(2), {});
+
+        QCOMPARE(index.torrentsCountByHost(u"tracker.example.com"_s), 1);
+        QCOMPARE(index.trackersByHost(u"tracker.example.com"_s).size(), 2);
+        QCOMPARE(index.torrentsByHost({}), QSet<TorrentID> {makeID(2)});
+
+        index.removeTorrent(makeID(1));
+        QVERIFY(!index.hosts().contains(u"tracker.example.com"_s));
+        QVERIFY(index.trackers().isEmpty());
+    }
+
+    void testProblems() const
+    {
+        TrackerIndex index;
+        index.setTorrentTrackers(makeID(1), {TRACKER_URL});
+
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::NotWorking));
+        QCOMPARE(index.torrentsWithProblem(TrackerIndex::Problem::Error), QSet<TorrentID> {makeID(1)});
+
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::TrackerError));
+        QCOMPARE(index.torrentsWithProblemCount(TrackerIndex::Problem::Error), 0);
+        QCOMPARE(index.torrentsWithProblem(TrackerIndex::Problem::TrackerError), QSet<TorrentID> {makeID(1)});
+
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::Working));
+        QCOMPARE(index.torrentsWithProblemCount(TrackerIndex::Problem::TrackerError), 0);
+    }
+
+    void testProblemKeptWhileUpdating() const
+    {
+        TrackerIndex index;
+        index.setTorrentTrackers(makeID(1), {TRACKER_URL});
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::NotWorking));
+
+        QSignalSpy spy {&index, &TrackerIndex::problemsChanged};
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::NotWorking, true));
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::NotContacted, true));
+        QCOMPARE(index.torrentsWithProblem(TrackerIndex::Problem::Error), QSet<TorrentID> {makeID(1)});
+        QCOMPARE(spy.count(), 0);
+
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::Working));
+        QCOMPARE(index.torrentsWithProblemCount(TrackerIndex::Problem::Error), 0);
+        QCOMPARE(spy.count(), 1);
+    }
+
+    void testProblemsClearedWithTracker() const
+    {
+        TrackerIndex index;
+        index.setTorrentTrackers(makeID(1), {TRACKER_URL});
+        index.updateTrackerStatuses(makeID(1), makeStatuses(TrackerEndpointState::NotWorking));
+
+        index.setTorrentTrackers(makeID(1), {});
+        QCOMPARE(index.torrentsWithProblemCount(TrackerIndex::Problem::Error), 0);
+    }
+};
+
+QTEST_APPLESS_MAIN(TestBittorrentTrackerIndex)
+#include "testbittorrenttrackerindex.moc"
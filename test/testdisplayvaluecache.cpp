@@ -0,0 +1,96 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QObject>
+#include <QString>
+#include <QTest>
+
+#include "base/global.h"
+#include "gui/displayvaluecache.h"
+
+class TestDisplayValueCache final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestDisplayValueCache)
+
+public:
+    TestDisplayValueCache() = default;
+
+private slots:
+    void testValueChange() const
+    {
+        DisplayValueCache<int> cache {2};
+        int formatCount = 0;
+        const auto format = [&formatCount](const qint64 value)
+        {
+            ++formatCount;
+            return QString::number(value);
+        };
+        const auto display = [&cache, &format](const int row, const int column, const qint64 value)
+        {
+            return cache.value(row, column, [&format, value] { return format(value); }, false, value);
+        };
+
+        QCOMPARE(display(0, 0, 10), u"10"_s);
+        QCOMPARE(display(0, 0, 10), u"10"_s);
+        QCOMPARE(formatCount, 1);
+
+        QCOMPARE(display(0, 0, 20), u"20"_s);
+        QCOMPARE(formatCount, 2);
+
+        // columns and rows are cached separately
+        QCOMPARE(display(0, 1, 20), u"20"_s);
+        QCOMPARE(display(1, 0, 20), u"20"_s);
+        QCOMPARE(formatCount, 4);
+
+        cache.remove(0);
+        QCOMPARE(display(0, 0, 20), u"20"_s);
+        QCOMPARE(formatCount, 5);
+    }
+
+    void testHideZeroChange() const
+    {
+        DisplayValueCache<int> cache {1};
+        const auto display = [&cache](const bool hideZero, const qreal value)
+        {
+            const auto format = [hideZero, value]
+            {
+                return (hideZero && (value == 0)) ? QString() : QString::number(value);
+            };
+            return cache.value(0, 0, format, hideZero, value);
+        };
+
+        QCOMPARE(display(false, 0), u"0"_s);
+        QCOMPARE(display(true, 0), QString());
+        QCOMPARE(display(false, 0), u"0"_s);
+        QCOMPARE(display(true, 0.5), u"0.5"_s);
+    }
+};
+
+QTEST_APPLESS_MAIN(TestDisplayValueCache)
+#include "testdisplayvaluecache.moc"
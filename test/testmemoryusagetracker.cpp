@@ -0,0 +1,91 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+
+#include <QObject>
+#include <QString>
+#include <QTest>
+#include <QVariantMap>
+
+#include "base/global.h"
+#include "base/memoryusagetracker.h"
+
+class TestMemoryUsageTracker final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestMemoryUsageTracker)
+
+public:
+    TestMemoryUsageTracker() = default;
+
+private slots:
+    void initTestCase() const
+    {
+        MemoryUsageTracker::initInstance();
+    }
+
+    void cleanupTestCase() const
+    {
+        MemoryUsageTracker::freeInstance();
+    }
+
+    void testEstimate() const
+    {
+        auto *tracker = MemoryUsageTracker::instance();
+        QVERIFY(tracker->estimate().isEmpty());
+
+        {
+            const QObject first;
+            const QObject second;
+            tracker->addEstimator(MemoryComponent::Logs, &first, [] { return MemoryUsage {.size = 100, .count = 1}; });
+            tracker->addEstimator(MemoryComponent::WebUISync, &first, [] { return MemoryUsage {.size = 10, .count = 1}; });
+            tracker->addEstimator(MemoryComponent::WebUISync, &second, [] { return MemoryUsage {.size = 20, .count = 1}; });
+
+            const QHash<QString, MemoryUsage> usage = tracker->estimate();
+            QCOMPARE(usage.size(), 2);
+            QCOMPARE(usage[MemoryComponent::Logs].size, 100);
+            QCOMPARE(usage[MemoryComponent::WebUISync].size, 30);
+            QCOMPARE(usage[MemoryComponent::WebUISync].count, 2);
+        }
+
+        QVERIFY(tracker->estimate().isEmpty());
+    }
+
+    void testEstimateMemoryUsage() const
+    {
+        QCOMPARE(estimateMemoryUsage(QString()), 0);
+        QVERIFY(estimateMemoryUsage(u"abc"_s) >= static_cast<qint64>(3 * sizeof(QChar)));
+
+        const QString value = u"value"_s;
+        const QVariantMap map {{u"key"_s, value}};
+        QVERIFY(estimateMemoryUsage(QVariant(map)) > estimateMemoryUsage(QVariant(value)));
+    }
+};
+
+QTEST_APPLESS_MAIN(TestMemoryUsageTracker)
+#include "testmemoryusagetracker.moc"
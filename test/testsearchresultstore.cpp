@@ -0,0 +1,192 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QObject>
+#include <QRegularExpression>
+#include <QTest>
+
+#include "base/global.h"
+#include "base/search/searchresultstore.h"
+
+namespace
+{
+    SearchResult makeResult(const QString &name, const QString &url, const qlonglong size, const qlonglong seeders)
+    {
+        SearchResult result;
+        result.fileName = name;
+        result.fileUrl = url;
+        result.fileSize = size;
+        result.nbSeeders = seeders;
+        return result;
+    }
+
+    QStringList names(const QList<SearchResult> &results)
+    {
+        QStringList list;
+        for (const SearchResult &result : results)
+            list.append(result.fileName);
+        return list;
+    }
+}
+
+class TestSearchResultStore final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestSearchResultStore)
+
+public:
+    TestSearchResultStore() = default;
+
+private slots:
+    void testDeduplication() const
+    {
+        SearchResultStore store;
+        const QList<SearchResult> newResults1 = store.append({
+            makeResult(u"a"_s, u"magnet:?xt=urn:btih:0123456789ABCDEF0123456789ABCDEF01234567&dn=a"_s, 10, 1),
+            makeResult(u"b"_s, u"http://example.com/b.torrent"_s, 20, 2)
+        });
+        QCOMPARE(newResults1.size(), 2);
+
+        const QList<SearchResult> newResults2 = store.append({
+            makeResult(u"a (other engine)"_s, u"magnet:?xt=urn:btih:0123456789abcdef0123456789abcdef01234567"_s, 10, 5),
+            makeResult(u"b"_s, u"http://example.com/b.torrent"_s, 20, 1),
+            makeResult(u"c"_s, u"http://example.com/c.torrent"_s, 30, 3)
+        });
+        QCOMPARE(names(newResults2), QStringList {u"c"_s});
+        QCOMPARE(store.size(), 3);
+        QCOMPARE(store.results().at(0).nbSeeders, 5);
+        QCOMPARE(store.results().at(1).nbSeeders, 2);
+    }
+
+    void testInfoHashEncoding() const
+    {
+        SearchResultStore store;
+        store.append({makeResult(u"a"_s, u"magnet:?xt=urn:btih:0123456789abcdef0123456789abcdef01234567"_s, 10, 1)});
+
+        // the same info hash encoded in base32
+        const QList<SearchResult> newResults = store.append({
+            makeResult(u"a (base32)"_s, u"magnet:?xt=urn:btih:AERUKZ4JVPG66AJDIVTYTK6N54ASGRLH&dn=a"_s, 10, 3)
+        });
+        QVERIFY(newResults.isEmpty());
+        QCOMPARE(store.size(), 1);
+        QCOMPARE(store.results().at(0).nbSeeders, 3);
+        QCOMPARE(SearchResultStore::resultKey(store.results().at(0)), u"0123456789abcdef0123456789abcdef01234567"_s);
+
+        // malformed magnet links are told apart by URL
+        store.append({
+            makeResult(u"b"_s, u"magnet:?xt=urn:btih:AAAA"_s, 10, 1),
+            makeResult(u"c"_s, u"magnet:?xt=urn:btih:aaaa"_s, 10, 1)
+        });
+        QCOMPARE(store.size(), 3);
+    }
+
+    void testSort() const
+    {
+        SearchResultStore store;
+        store.append({
+            makeResult(u"b"_s, u"1"_s, 20, 2),
+            makeResult(u"c"_s, u"2"_s, 10, 3)
+        });
+
+        SearchResultStore::Query query {.sortColumn = SearchResultStore::SortColumn::Size};
+        QCOMPARE(names(store.query(query).results), (QStringList {u"c"_s, u"b"_s}));
+
+        // sort index is updated incrementally
+        store.append({makeResult(u"a"_s, u"3"_s, 15, 1)});
+        QCOMPARE(names(store.query(query).results), (QStringList {u"c"_s, u"a"_s, u"b"_s}));
+
+        query.sortColumn = SearchResultStore::SortColumn::Name;
+        query.sortDescending = true;
+        QCOMPARE(names(store.query(query).results), (QStringList {u"c"_s, u"b"_s, u"a"_s}));
+    }
+
+    void testSortBySeeders() const
+    {
+        SearchResultStore store;
+        store.append({
+            makeResult(u"a"_s, u"1"_s, 10, 1),
+            makeResult(u"b"_s, u"2"_s, 10, 2)
+        });
+
+        const SearchResultStore::Query query {.sortColumn = SearchResultStore::SortColumn::Seeders};
+        QCOMPARE(names(store.query(query).results), (QStringList {u"a"_s, u"b"_s}));
+
+        store.append({makeResult(u"c"_s, u"3"_s, 10, 0)});
+        QCOMPARE(names(store.query(query).results), (QStringList {u"c"_s, u"a"_s, u"b"_s}));
+
+        // merged duplicate changes the order
+        store.append({makeResult(u"a"_s, u"1"_s, 10, 3)});
+        QCOMPARE(names(store.query(query).results), (QStringList {u"c"_s, u"b"_s, u"a"_s}));
+    }
+
+    void testFilter() const
+    {
+        SearchResultStore store;
+        store.append({
+            makeResult(u"Foo 1"_s, u"1"_s, 10, 0),
+            makeResult(u"Bar"_s, u"2"_s, 20, 5),
+            makeResult(u"foo 2"_s, u"3"_s, 30, 10),
+            makeResult(u"Foo 3"_s, u"4"_s, 40, 15)
+        });
+
+        SearchResultStore::Query query {.nameTerms = {u"foo"_s}, .minSeeders = 1};
+        SearchResultStore::QueryResult result = store.query(query);
+        QCOMPARE(result.matchedCount, 2);
+        QCOMPARE(names(result.results), (QStringList {u"foo 2"_s, u"Foo 3"_s}));
+
+        query.offset = 1;
+        query.limit = 1;
+        result = store.query(query);
+        QCOMPARE(result.matchedCount, 2);
+        QCOMPARE(names(result.results), QStringList {u"Foo 3"_s});
+
+        query = {.maxSize = 20};
+        QCOMPARE(store.query(query).matchedCount, 2);
+
+        query = {.nameTerms = {u"3"_s, u"foo"_s}};
+        QCOMPARE(names(store.query(query).results), QStringList {u"Foo 3"_s});
+
+        query = {.namePattern = QRegularExpression(u"^foo \\d$"_s)};
+        QCOMPARE(names(store.query(query).results), QStringList {u"foo 2"_s});
+    }
+
+    void testNaturalSort() const
+    {
+        SearchResultStore store;
+        store.append({
+            makeResult(u"Foo 10"_s, u"1"_s, 10, 0),
+            makeResult(u"foo 9"_s, u"2"_s, 10, 0)
+        });
+
+        const SearchResultStore::Query query {.sortColumn = SearchResultStore::SortColumn::Name};
+        QCOMPARE(names(store.query(query).results), (QStringList {u"foo 9"_s, u"Foo 10"_s}));
+    }
+};
+
+QTEST_APPLESS_MAIN(TestSearchResultStore)
+#include "testsearchresultstore.moc"
@@ -0,0 +1,184 @@
+/*
+ * Bittorrent Client using Qt and libtorrent.
+ * Copyright (C) 2026  qBittorrent project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * In addition, as a special exception, the copyright holders give permission to
+ * link this program with the OpenSSL project's "OpenSSL" library (or with
+ * modified versions of it that use the same license as the "OpenSSL" library),
+ * and distribute the linked executables. You must obey the GNU General Public
+ * License in all respects for all of the code used other than "OpenSSL".  If you
+ * modify file(s), you may extend this exception to your version of the file(s),
+ * but you are not obligated to do so. If you do not wish to do so, delete this
+ * exception statement from your version.
+ */
+
+#include <QList>
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+#include "base/bittorrent/infohash.h"
+#include "base/global.h"
+#include "base/tag.h"
+#include "base/tagset.h"
+#include "base/torrentfilter.h"
+#include "base/torrentfilterindex.h"
+
+namespace
+{
+    BitTorrent::TorrentID makeID(const int value)
+    {
+        return BitTorrent::TorrentID::fromString(u"%1"_s.arg(value, 40, 16, u'0'));
+    }
+
+    TorrentFilterIndex::States makeStates(const QList<TorrentFilter::Type> &types)
+    {
+        TorrentFilterIndex::States states;
+        for (const TorrentFilter::Type type : types)
+            states.set(type);
+        return states;
+    }
+
+    void addTorrent(TorrentFilterIndex &index, const int slot, const QString &category = {}, const TagSet &tags = {}
+            , const bool isPrivate = false, const QList<TorrentFilter::Type> &types = {})
+    {
+        index.addTorrent(slot, makeID(slot), category, tags, isPrivate, makeStates(types));
+    }
+}
+
+class TestTorrentFilterIndex final : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY_MOVE(TestTorrentFilterIndex)
+
+public:
+    TestTorrentFilterIndex() = default;
+
+private slots:
+    void testStates() const
+    {
+        TorrentFilterIndex index;
+        addTorrent(index, 0, {}, {}, false, {TorrentFilter::Downloading, TorrentFilter::Running});
+        addTorrent(index, 1, {}, {}, false, {TorrentFilter::Stopped});
+        addTorrent(index, 2, {}, {}, false, {TorrentFilter::Downloading, TorrentFilter::Running});
+
+        QCOMPARE(index.torrentsCount(TorrentFilter::All), 3);
+        QCOMPARE(index.torrentsCount(TorrentFilter::Downloading), 2);
+        QCOMPARE(index.torrentSlots(TorrentFilter::DownloadingTorrent), (QList<int> {0, 2}));
+
+        index.setTorrentStates(0, makeStates({TorrentFilter::Stopped}));
+        QCOMPARE(index.torrentSlots(TorrentFilter::StoppedTorrent), (QList<int> {0, 1}));
+        QCOMPARE(index.torrentsCount(TorrentFilter::Downloading), 1);
+
+        index.removeTorrent(1);
+        QCOMPARE(index.torrentsCount(TorrentFilter::All), 2);
+        QCOMPARE(index.torrentSlots(TorrentFilter::StoppedTorrent), QList<int> {0});
+    }
+
+    void testStatesUpdatedSignal() const
+    {
+        TorrentFilterIndex index;
+        QSignalSpy spy {&index, &TorrentFilterIndex::statesUpdated};
+
+        addTorrent(index, 0, {}, {}, false, {TorrentFilter::Running});
+        QCOMPARE(spy.count(), 1);
+
+        // nothing is emitted until some state bit is changed
+        index.setTorrentStates(0, makeStates({TorrentFilter::Running}));
+        index.setTorrentCategory(0, u"category"_s);
+        index.addTorrentTag(0, Tag(u"tag"_s));
+        QCOMPARE(spy.count(), 1);
+
+        index.setTorrentStates(0, makeStates({TorrentFilter::Stopped}));
+        QCOMPARE(spy.count(), 2);
+
+        // unknown slots are ignored
+        index.setTorrentStates(5, makeStates({TorrentFilter::Stopped}));
+        index.removeTorrent(5);
+        QCOMPARE(spy.count(), 2);
+
+        index.removeTorrent(0);
+        QCOMPARE(spy.count(), 3);
+    }
+
+    void testCategories() const
+    {
+        TorrentFilterIndex index;
+        addTorrent(index, 0, u"movies"_s);
+        addTorrent(index, 1, u"movies/hd"_s);
+        addTorrent(index, 2);
+
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, u"movies"_s)), QList<int> {0});
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, QString())), QList<int> {2});
+
+        index.setSubcategoriesEnabled(true);
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, u"movies"_s)), (QList<int> {0, 1}));
+
+        index.setTorrentCategory(1, {});
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, u"movies"_s)), QList<int> {0});
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, QString())), (QList<int> {1, 2}));
+    }
+
+    void testTags() const
+    {
+        const Tag tag1 {u"tag1"_s};
+        const Tag tag2 {u"tag2"_s};
+
+        TorrentFilterIndex index;
+        addTorrent(index, 0, {}, {tag1, tag2});
+        addTorrent(index, 1, {}, {tag2});
+        addTorrent(index, 2);
+
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, tag2)), (QList<int> {0, 1}));
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, Tag())), QList<int> {2});
+
+        index.removeTorrentTag(0, tag2);
+        index.removeTorrentTag(1, tag2);
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, tag2)), QList<int> {});
+        // torrent still having another tag isn't considered untagged
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, Tag())), (QList<int> {1, 2}));
+
+        index.addTorrentTag(2, tag1);
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, tag1)), (QList<int> {0, 2}));
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, Tag())), QList<int> {1});
+    }
+
+    void testPrivateAndIDs() const
+    {
+        TorrentFilterIndex index;
+        addTorrent(index, 0, {}, {}, true);
+        addTorrent(index, 1);
+        addTorrent(index, 2, {}, {}, true);
+
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, TorrentFilter::AnyTag, true)), (QList<int> {0, 2}));
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentFilter::AnyID, TorrentFilter::AnyCategory, TorrentFilter::AnyTag, false)), QList<int> {1});
+
+        // requested torrents are listed in slot order, unknown IDs are skipped
+        const TorrentIDSet idSet {makeID(2), makeID(1), makeID(7)};
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, idSet)), (QList<int> {1, 2}));
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, idSet, TorrentFilter::AnyCategory, TorrentFilter::AnyTag, true)), QList<int> {2});
+
+        // removed slot can be reused by another torrent
+        index.removeTorrent(2);
+        index.addTorrent(2, makeID(9), {}, {}, false, {});
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, idSet)), QList<int> {1});
+        QCOMPARE(index.torrentSlots(TorrentFilter(TorrentFilter::All, TorrentIDSet {makeID(9)})), QList<int> {2});
+    }
+};
+
+QTEST_APPLESS_MAIN(TestTorrentFilterIndex)
+#include "testtorrentfilterindex.moc"